@@ -0,0 +1,229 @@
+/**
+ * @file bench_driver.c
+ * @brief Driver Microbenchmarks
+ *
+ * Runs each API variant BENCH_ITERATIONS times and prints one JSON object
+ * per line (JSON Lines), so results can be diffed across versions:
+ *
+ *   {"suite":"i2c_driver","version":1,"backend":"mock",...}
+ *   {"bench":"i2c_write","n":100,"p50_ns":...,"bytes_per_s":...,"mmio_rd":...}
+ *
+ * Latency is measured on the timebase counter (the IP TICKS register, core
+ * clock) on target and on the simulated clock on the host. MMIO / poll
+ * counts need the host model (I2C_HOST_MOCK): on target they are omitted.
+ *
+ * The tail (hardware done stamp to return) is taken from the same end
+ * timestamp, so it assumes the default timebase (TICKS). Only operations
+ * that moved DONE_TICKS count; with none, tail_p50_ns is null.
+ */
+
+#include "i2c_driver.h"
+#include "i2c_regs.h"
+#include "timebase.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef I2C_HOST_MOCK
+#include "i2c_mock.h"
+#endif
+
+//==============================================================================
+// Configuration
+//==============================================================================
+#define BENCH_ITERATIONS    100
+#define BENCH_VERSION       2           // Bump when the output format changes
+
+typedef struct {
+    const char *name;
+    int (*run)(void);           // One operation, returns I2C_SUCCESS
+    uint32_t bytes;             // Payload bytes per operation
+} bench_t;
+
+//==============================================================================
+// Operations
+//==============================================================================
+static uint8_t bench_buf[I2C_FIFO_DEPTH];
+static volatile int bench_async_done;
+
+static int op_write(void) {
+    return i2c_write(I2C_ADDR_LED, 0x5A);
+}
+
+static int op_read(void) {
+    return i2c_read(I2C_ADDR_SWITCH, &bench_buf[0]);
+}
+
+static int op_write_bytes(void) {
+    return i2c_write_bytes(I2C_ADDR_LED, bench_buf, 4);
+}
+
+static int op_read_bytes(void) {
+    return i2c_read_bytes(I2C_ADDR_SWITCH, bench_buf, 4);
+}
+
+static int op_write_led_fnd(void) {
+    return i2c_write_led_fnd(0xA5, 0x5);
+}
+
+static int op_cache_hit(void) {
+    return i2c_cache_write(I2C_ADDR_LED, 0xA5);     // Shadow set by i2c_write_led_fnd
+}
+
+static int op_transfer(void) {
+    struct i2c_msg msgs[2] = {
+        { I2C_ADDR_SWITCH, 0,        1, &bench_buf[0] },
+        { I2C_ADDR_SWITCH, I2C_M_RD, 1, &bench_buf[1] }
+    };
+    return (i2c_transfer(msgs, 2) == 2) ? I2C_SUCCESS : I2C_ERR_NACK;
+}
+
+static void on_async_done(int handle, int result, void *ctx) {
+    (void)handle;
+    (void)ctx;
+    bench_async_done = (result == I2C_SUCCESS) ? 1 : -1;
+}
+
+static int op_async(void) {
+    static const uint8_t led = 0x5A;
+    const i2c_op_t op = { I2C_ADDR_LED, 0, 1, 0, &led, NULL };
+
+    bench_async_done = 0;
+    if (i2c_submit(&op, on_async_done, NULL) < 0) {
+        return I2C_ERR_BUSY;
+    }
+    while (i2c_poll() > 0);
+    return (bench_async_done == 1) ? I2C_SUCCESS : I2C_ERR_NACK;
+}
+
+static int op_probe(void) {
+    return i2c_probe(I2C_ADDR_FND);
+}
+
+static const bench_t benches[] = {
+    { "i2c_write",         op_write,         1 },
+    { "i2c_read",          op_read,          1 },
+    { "i2c_write_bytes_4", op_write_bytes,   4 },
+    { "i2c_read_bytes_4",  op_read_bytes,    4 },
+    { "i2c_write_led_fnd", op_write_led_fnd, 2 },
+    { "i2c_cache_hit",     op_cache_hit,     0 },
+    { "i2c_transfer_wr_rd", op_transfer,     2 },
+    { "i2c_submit_poll",   op_async,         1 },
+    { "i2c_probe",         op_probe,         0 },
+};
+
+//==============================================================================
+// Measurement
+//==============================================================================
+static uint32_t lat[BENCH_ITERATIONS];      // Ticks per operation
+static uint32_t tail[BENCH_ITERATIONS];     // Ticks from done to return (bus ops only)
+
+static void sort_ticks(uint32_t *v, int n) {
+    for (int i = 1; i < n; i++) {
+        uint32_t x = v[i];
+        int j = i - 1;
+        while (j >= 0 && v[j] > x) {
+            v[j + 1] = v[j];
+            j--;
+        }
+        v[j + 1] = x;
+    }
+}
+
+static unsigned long pct_ns(const uint32_t *sorted, int n, int pct) {
+    int idx = (n * pct + 99) / 100 - 1;
+    return timebase_ticks_to_ns(sorted[idx < 0 ? 0 : idx]);
+}
+
+static void bench_one(const bench_t *b) {
+    uint64_t total = 0;
+    int      errors = 0;
+    int      tails = 0;
+#ifdef I2C_HOST_MOCK
+    i2c_mock_stats_t st, sum = { 0 };
+#endif
+
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        uint32_t stamp = I2C_READ_REG(I2C_REG_DONE_TICKS);
+        uint32_t t0 = timebase_now();
+#ifdef I2C_HOST_MOCK
+        i2c_mock_get_stats(NULL, 1);
+#endif
+        int result = b->run();
+#ifdef I2C_HOST_MOCK
+        i2c_mock_get_stats(&st, 0);
+#endif
+        uint32_t t1 = timebase_now();
+
+        if (result != I2C_SUCCESS) {
+            errors++;
+        }
+#ifdef I2C_HOST_MOCK
+        sum.reads         += st.reads;
+        sum.writes        += st.writes;
+        sum.status_reads  += st.status_reads;
+        sum.counter_reads += st.counter_reads;
+#endif
+        lat[i] = t1 - t0;
+        total += lat[i];
+
+        // No transaction ended during the operation: no tail sample
+        uint32_t done = I2C_READ_REG(I2C_REG_DONE_TICKS);
+        if (done != stamp) {
+            tail[tails++] = t1 - done;
+        }
+    }
+
+    sort_ticks(lat, BENCH_ITERATIONS);
+    sort_ticks(tail, tails);
+
+    uint64_t total_ns = (uint64_t)timebase_ticks_to_ns(1000) * total / 1000;
+    unsigned long bps = total_ns ?
+        (unsigned long)((uint64_t)b->bytes * BENCH_ITERATIONS * 1000000000ULL / total_ns) : 0;
+
+    printf("{\"bench\":\"%s\",\"n\":%d,\"errors\":%d,"
+           "\"p50_ns\":%lu,\"p90_ns\":%lu,\"p99_ns\":%lu,\"max_ns\":%lu,",
+           b->name, BENCH_ITERATIONS, errors,
+           pct_ns(lat, BENCH_ITERATIONS, 50), pct_ns(lat, BENCH_ITERATIONS, 90),
+           pct_ns(lat, BENCH_ITERATIONS, 99), pct_ns(lat, BENCH_ITERATIONS, 100));
+    if (tails > 0) {
+        printf("\"tail_p50_ns\":%lu,", pct_ns(tail, tails, 50));
+    } else {
+        printf("\"tail_p50_ns\":null,");
+    }
+    printf("\"bytes_per_s\":%lu", bps);
+#ifdef I2C_HOST_MOCK
+    // Per operation, rounded
+    printf(",\"mmio_rd\":%lu,\"mmio_wr\":%lu,\"polls\":%lu,\"tick_rd\":%lu",
+           (unsigned long)((sum.reads + BENCH_ITERATIONS / 2) / BENCH_ITERATIONS),
+           (unsigned long)((sum.writes + BENCH_ITERATIONS / 2) / BENCH_ITERATIONS),
+           (unsigned long)((sum.status_reads + BENCH_ITERATIONS / 2) / BENCH_ITERATIONS),
+           (unsigned long)((sum.counter_reads + BENCH_ITERATIONS / 2) / BENCH_ITERATIONS));
+#endif
+    printf("}\n");
+}
+
+//==============================================================================
+// Entry Point
+//==============================================================================
+
+/**
+ * @brief Run every benchmark (i2c_init must have been called)
+ */
+void bench_driver_main(void) {
+#ifdef I2C_HOST_MOCK
+    const char *backend = "mock";
+#else
+    const char *backend = "target";
+#endif
+
+    printf("{\"suite\":\"i2c_driver\",\"version\":%d,\"backend\":\"%s\","
+           "\"clk_hz\":%lu,\"iterations\":%d}\n",
+           BENCH_VERSION, backend, (unsigned long)I2C_CORE_CLK_HZ, BENCH_ITERATIONS);
+
+    i2c_cache_set_window(0);
+
+    for (size_t i = 0; i < sizeof(benches) / sizeof(benches[0]); i++) {
+        bench_one(&benches[i]);
+    }
+}
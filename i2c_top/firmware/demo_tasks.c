@@ -0,0 +1,259 @@
+/**
+ * @file demo_tasks.c
+ * @brief Concurrent LED / FND / Switch Demo on the Scheduler
+ *
+ * The LED / FND / switch demos as tasks that share the bus through the
+ * async queue and run at the same time:
+ *  - LED: running light, blink, binary counter, pattern table
+ *  - FND: count up, countdown, rapid count
+ *  - Switch: polled every 20 ms, overrides LED / FND while non-zero,
+ *    changes and special patterns printed
+ *  - Report: statistics and down slaves every 20 s
+ * Each LED / FND mode keeps the step period of the old blocking demo.
+ * Frames go through the shadow cache: a value the device already shows
+ * (switches held still) is not written again.
+ */
+
+#include "i2c_driver.h"
+#include "sched.h"
+#include "timebase.h"
+#include <stdio.h>
+#include <stddef.h>
+
+//==============================================================================
+// Shared State
+//==============================================================================
+#define EV_SWITCH       SCHED_EV_USER(0)    // Switch value changed
+
+static int task_sw, task_led, task_fnd, task_report;
+static uint8_t sw_value;
+static uint32_t frames, frames_merged, sw_reads, sw_changes;
+static uint8_t led_mode, fnd_mode;
+static uint16_t led_step, fnd_step;
+
+// Animation modes: step period and steps before moving to the next mode
+typedef struct {
+    const char *name;
+    uint32_t step_us;
+    uint16_t steps;
+} demo_mode_t;
+
+static const demo_mode_t led_modes[] = {
+    { "running light", 100000,  40 },
+    { "blink",         500000,  20 },
+    { "counter",        50000, 256 },
+    { "patterns",      500000,   8 },
+};
+
+static const demo_mode_t fnd_modes[] = {
+    { "count",         500000,  16 },
+    { "countdown",     400000,  16 },
+    { "rapid count",   100000,  48 },
+};
+
+#define N_MODES(t)      ((uint8_t)(sizeof(t) / sizeof((t)[0])))
+
+static const uint8_t led_patterns[] = { 0xAA, 0x55, 0xF0, 0x0F, 0xCC, 0x33, 0xFF, 0x00 };
+
+/**
+ * @brief Advance a mode's step, switch to the next mode (and period) at its end
+ */
+static void mode_step(int task, const demo_mode_t *modes, uint8_t n,
+                      uint8_t *mode, uint16_t *step) {
+    if (++*step < modes[*mode].steps) {
+        return;
+    }
+    *step = 0;
+    *mode = (uint8_t)((*mode + 1) % n);
+    sched_every_us(task, modes[*mode].step_us);
+    printf("  [%s]\n", modes[*mode].name);
+}
+
+static uint8_t led_frame(uint8_t mode, uint16_t step) {
+    switch (mode) {
+    case 0:  return (uint8_t)(1 << (step & 0x07));
+    case 1:  return (step & 1) ? 0x00 : 0xFF;
+    case 2:  return (uint8_t)step;
+    default: return led_patterns[step & 0x07];
+    }
+}
+
+static uint8_t fnd_frame(uint8_t mode, uint16_t step) {
+    return (mode == 1) ? (uint8_t)(15 - step) : (uint8_t)(step & 0x0F);
+}
+
+static void print_switch(uint8_t v) {
+    printf("  SW: 0x%02X (", v);
+    for (int bit = 7; bit >= 0; bit--) {
+        printf("%d", (v >> bit) & 1);
+    }
+    printf(")%s\n", (v == 0xFF) ? " ALL ON" :
+                    (v == 0x00) ? " ALL OFF" :
+                    (v == 0xAA) ? " ALTERNATING 1" :
+                    (v == 0x55) ? " ALTERNATING 2" : "");
+}
+
+//==============================================================================
+// Tasks
+//==============================================================================
+
+/**
+ * @brief Switch task: read every 20 ms, tell LED / FND on a change
+ */
+static void switch_task(int task, uint32_t events, void *ctx) {
+    static uint8_t rx;
+    static const i2c_op_t rd = { I2C_ADDR_SWITCH, 1, 1, 0, NULL, &rx };
+    (void)ctx;
+
+    if ((events & SCHED_EV_TIMER) && sched_i2c_pending(task) == 0) {
+        sched_i2c_submit(task, &rd);
+    }
+
+    if ((events & SCHED_EV_I2C) && sched_i2c_result(task) == I2C_SUCCESS) {
+        sw_reads++;
+        if (rx != sw_value) {
+            sw_value = rx;
+            sw_changes++;
+            print_switch(rx);
+            sched_signal(task_led, EV_SWITCH);
+            sched_signal(task_fnd, EV_SWITCH);
+        }
+    }
+}
+
+/**
+ * @brief LED task: led_modes in turn, switches when any is on
+ */
+static void led_task(int task, uint32_t events, void *ctx) {
+    static uint8_t tx;
+    static uint8_t stale;               // Update arrived while a frame was queued
+    static const i2c_op_t wr = { I2C_ADDR_LED, 0, 1, 0, &tx, NULL };
+    (void)ctx;
+
+    if (events & SCHED_EV_TIMER) {
+        mode_step(task, led_modes, N_MODES(led_modes), &led_mode, &led_step);
+    }
+    if (events & (SCHED_EV_TIMER | EV_SWITCH)) {
+        stale = 1;
+    }
+    if (!stale) {
+        return;
+    }
+    if (sched_i2c_pending(task)) {
+        frames_merged++;                // Sent when the queued frame is done
+        return;
+    }
+
+    tx = sw_value ? sw_value : led_frame(led_mode, led_step);
+    if (!i2c_cache_needed(I2C_ADDR_LED, tx)) {
+        stale = 0;                      // LED already shows it
+        return;
+    }
+    if (sched_i2c_submit(task, &wr) >= 0) {
+        stale = 0;
+        frames++;
+    }
+}
+
+/**
+ * @brief FND task: fnd_modes in turn, lower switch nibble when set
+ */
+static void fnd_task(int task, uint32_t events, void *ctx) {
+    static uint8_t tx;
+    static uint8_t stale;
+    static const i2c_op_t wr = { I2C_ADDR_FND, 0, 1, 0, &tx, NULL };
+    (void)ctx;
+
+    if (events & SCHED_EV_TIMER) {
+        mode_step(task, fnd_modes, N_MODES(fnd_modes), &fnd_mode, &fnd_step);
+    }
+    if (events & (SCHED_EV_TIMER | EV_SWITCH)) {
+        stale = 1;
+    }
+    if (!stale || sched_i2c_pending(task)) {
+        return;                         // Retried on SCHED_EV_I2C
+    }
+
+    tx = (sw_value & 0x0F) ? (sw_value & 0x0F) : fnd_frame(fnd_mode, fnd_step);
+    if (!i2c_cache_needed(I2C_ADDR_FND, tx)) {
+        stale = 0;
+        return;
+    }
+    if (sched_i2c_submit(task, &wr) >= 0) {
+        stale = 0;
+    }
+}
+
+/**
+ * @brief Report task: statistics every 20 s, slaves marked down
+ */
+static void report_task(int task, uint32_t events, void *ctx) {
+    static const uint8_t slaves[] = { I2C_ADDR_LED, I2C_ADDR_FND, I2C_ADDR_SWITCH };
+    (void)task;
+    (void)ctx;
+
+    if (!(events & SCHED_EV_TIMER)) {
+        return;
+    }
+
+    printf("  %lu switch reads (%lu changes), %lu LED frames (%lu merged)\n",
+           (unsigned long)sw_reads, (unsigned long)sw_changes,
+           (unsigned long)frames, (unsigned long)frames_merged);
+    i2c_cache_stats_t cs;
+    i2c_cache_get_stats(&cs, 1);
+    printf("  %lu repeated frames skipped\n", (unsigned long)cs.hits);
+    printf("  Worst timer lateness: %lu ns\n",
+           (unsigned long)timebase_ticks_to_ns(sched_max_lateness(1)));
+
+    // Unplugged boards fail fast instead of stalling the other tasks
+    for (unsigned i = 0; i < sizeof(slaves); i++) {
+        i2c_health_t h;
+        if (i2c_health_get(slaves[i], &h) == I2C_SUCCESS && h.state == I2C_HEALTH_DOWN) {
+            printf("  Slave 0x%02X down: %lu calls skipped, %lu re-probes\n", slaves[i],
+                   (unsigned long)h.fast_fails, (unsigned long)h.probes);
+        }
+    }
+}
+
+//==============================================================================
+// Demo
+//==============================================================================
+
+/**
+ * @brief Start the tasks (for callers that run the loop themselves)
+ */
+void demo_tasks_start(void) {
+    sched_reset();
+    frames = frames_merged = sw_reads = sw_changes = 0;
+    i2c_cache_get_stats(NULL, 1);
+    sw_value = 0;
+    led_mode = fnd_mode = 0;
+    led_step = fnd_step = 0;
+
+    task_sw     = sched_task(switch_task, NULL);
+    task_led    = sched_task(led_task, NULL);
+    task_fnd    = sched_task(fnd_task, NULL);
+    task_report = sched_task(report_task, NULL);
+
+    sched_every_us(task_sw, 20000);
+    sched_every_us(task_led, led_modes[0].step_us);
+    sched_every_us(task_fnd, fnd_modes[0].step_us);
+    sched_every_us(task_report, 20000000UL);
+}
+
+/**
+ * @brief Run the tasks forever (main loop)
+ */
+void demo_tasks_main(void) {
+    printf("\n========================================\n");
+    printf("Scheduler Demo (LED / FND / Switch tasks)\n");
+    printf("========================================\n");
+    printf("LED: running light / blink / counter / patterns\n");
+    printf("FND: count / countdown / rapid count\n");
+    printf("Switches override both, report every 20 seconds\n");
+
+    demo_tasks_start();
+    while (1) {
+        sched_run_for(1000);
+    }
+}
@@ -0,0 +1,97 @@
+/**
+ * @file bench_hpp.cpp
+ * @brief i2c_driver.hpp Microbenchmarks on the Host Model
+ *
+ * Build: sim/run_firmware_bench.sh (g++ -std=c++17 -DI2C_HOST_MOCK)
+ *
+ * Same JSON Lines fields as bench_driver.c for the operations both
+ * drivers have, names prefixed with "cpp_". mmio_rd counts register loads
+ * other than the counter, as in bench_driver.c (TICKS loads are tick_rd).
+ */
+
+#include "i2c_driver.hpp"
+#include "i2c_mock.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+using bus = i2c::master<0x44A00000>;
+
+constexpr int iterations = 100;
+
+struct bench {
+    const char *name;
+    int (*run)();
+    uint32_t bytes;
+};
+
+uint8_t buf[4] = { 0x11, 0x22, 0x33, 0x44 };
+
+int op_write()         { return bus::write<i2c::led>(0x5A); }
+int op_read()          { return bus::read<i2c::sw>(buf[0]); }
+int op_write_bytes()   { return bus::write<i2c::led>(buf); }
+int op_read_bytes()    { return bus::read<i2c::sw>(buf); }
+int op_write_led_fnd() { return bus::write_led_fnd(0xA5, 0x5); }
+
+const bench benches[] = {
+    { "cpp_write",         op_write,         1 },
+    { "cpp_read",          op_read,          1 },
+    { "cpp_write_bytes_4", op_write_bytes,   4 },
+    { "cpp_read_bytes_4",  op_read_bytes,    4 },
+    { "cpp_write_led_fnd", op_write_led_fnd, 2 },
+};
+
+unsigned long per_op(uint64_t sum) {
+    return static_cast<unsigned long>((sum + iterations / 2) / iterations);
+}
+
+void bench_one(const bench &b) {
+    uint64_t lat[iterations];
+    uint64_t rd = 0, wr = 0, polls = 0, ticks = 0;
+    int errors = 0;
+
+    for (int i = 0; i < iterations; i++) {
+        i2c_mock_stats_t st;
+        const uint64_t t0 = i2c_mock_cycles();
+
+        i2c_mock_get_stats(nullptr, 1);
+        if (b.run() != i2c::SUCCESS) {
+            errors++;
+        }
+        i2c_mock_get_stats(&st, 0);
+        lat[i] = i2c_mock_cycles() - t0;
+
+        rd    += st.reads - st.counter_reads;
+        wr    += st.writes;
+        polls += st.status_reads;
+        ticks += st.counter_reads;
+    }
+    std::sort(lat, lat + iterations);
+
+    const unsigned long ns_per_clk = 1000000000UL / I2C_CORE_CLK_HZ;
+    std::printf("{\"bench\":\"%s\",\"n\":%d,\"errors\":%d,\"p50_ns\":%lu,"
+                "\"mmio_rd\":%lu,\"mmio_wr\":%lu,\"polls\":%lu,\"tick_rd\":%lu}\n",
+                b.name, iterations, errors,
+                static_cast<unsigned long>(lat[iterations / 2 - 1]) * ns_per_clk,
+                per_op(rd), per_op(wr), per_op(polls), per_op(ticks));
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    i2c_mock_config_t cfg = { 100000, 8 };
+
+    if (argc > 1) {
+        cfg.scl_hz = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 0));
+    }
+
+    i2c_mock_reset(&cfg);
+    i2c_mock_set_switch(0x3C);
+
+    for (const bench &b : benches) {
+        bench_one(b);
+    }
+    return 0;
+}
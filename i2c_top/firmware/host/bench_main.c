@@ -0,0 +1,27 @@
+/**
+ * @file bench_main.c
+ * @brief Host Entry Point for bench_driver.c
+ *
+ * Build: sim/run_firmware_bench.sh [scl_hz] (gcc -DI2C_HOST_MOCK)
+ */
+
+#include "i2c_driver.h"
+#include "i2c_mock.h"
+#include <stdlib.h>
+
+extern void bench_driver_main(void);
+
+int main(int argc, char **argv) {
+    i2c_mock_config_t cfg = { 100000, 8 };
+
+    if (argc > 1) {
+        cfg.scl_hz = (uint32_t)strtoul(argv[1], NULL, 0);
+    }
+
+    i2c_mock_reset(&cfg);
+    i2c_mock_set_switch(0x3C);
+    i2c_init(0x44A00000);
+
+    bench_driver_main();
+    return 0;
+}
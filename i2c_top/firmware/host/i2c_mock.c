@@ -0,0 +1,508 @@
+/**
+ * @file i2c_mock.c
+ * @brief Host Model of the AXI I2C Master IP and Board Slaves
+ */
+
+#include "i2c_mock.h"
+#include "i2c_regs.h"
+#include <stddef.h>
+#include <string.h>
+
+//==============================================================================
+// Model State
+//==============================================================================
+#define NEVER       UINT64_MAX
+#define STRETCH_MAX 500000      // i2c_master STRETCH_TIMEOUT default (clk)
+
+#define GC_OP_WRITE 0x1
+#define GC_OP_STAGE 0x2
+#define GC_OP_LATCH 0x3
+
+typedef struct {
+    i2c_mock_config_t cfg;
+    uint64_t now;               // Core clock cycles
+
+    // CONTROL path
+    int      busy;
+    uint64_t done_at;           // Transaction end (NEVER while stuck)
+    uint32_t control;           // Running command
+    uint8_t  tx[I2C_FIFO_DEPTH];
+    uint8_t  tx_level;
+    uint8_t  rx[I2C_FIFO_DEPTH];
+    uint8_t  rx_head;
+    uint8_t  rx_level;
+    uint8_t  rx_data;
+    int      done;
+    int      ack_error;
+    int      timeout;           // Last CONTROL transaction hit STRETCH_MAX
+    int      win_error;
+    int      held;              // Bus kept after a hold transaction
+    uint32_t done_ticks;
+
+    // Other registers
+    uint32_t config;
+    uint32_t arb_prio;
+    uint8_t  speed[128];        // SCL quarter per address, 0 = scl_hz
+    uint8_t  speed_sel;
+    uint32_t scan_ctrl;
+    uint32_t scan_map[4];
+
+    // Slaves and faults
+    uint8_t  led, fnd, sw;
+    uint8_t  led_shadow, fnd_shadow;
+    uint8_t  nack[128];
+    uint8_t  stretch[128];
+    int      stuck;
+    uint32_t transactions;
+    i2c_mock_stats_t stats;
+} mock_t;
+
+static mock_t m;
+
+static const i2c_mock_config_t mock_defaults = {
+    100000,                     // scl_hz
+    8                           // access_cycles
+};
+
+//==============================================================================
+// Slaves
+//==============================================================================
+
+/**
+ * @brief Address ACKed?
+ */
+static int slave_present(uint8_t addr) {
+    if (m.nack[addr & 0x7F]) {
+        return 0;
+    }
+    return addr == I2C_ADDR_LED || addr == I2C_ADDR_FND ||
+           addr == I2C_ADDR_SWITCH || addr == I2C_ADDR_GENERAL_CALL;
+}
+
+/**
+ * @brief General call: [CMD][DATA...], data byte k to the k-th selected device
+ * @return 1 if every byte was ACKed
+ */
+static int slave_gc(const uint8_t *data, uint8_t len) {
+    uint8_t op   = data[0] >> 4;
+    uint8_t mask = data[0] & 0x0F;
+    uint8_t k    = 1;
+
+    if (op != GC_OP_WRITE && op != GC_OP_STAGE && op != GC_OP_LATCH) {
+        return 0;               // Unknown command NACKed
+    }
+
+    if (op != GC_OP_LATCH) {
+        for (uint8_t bit = 0; bit < 4 && k < len; bit++) {
+            if (!(mask & (1 << bit))) {
+                continue;
+            }
+            if (bit == 0) m.led_shadow = data[k];
+            if (bit == 1) m.fnd_shadow = data[k];
+            k++;
+        }
+    }
+
+    // Outputs follow at STOP (WRITE, LATCH)
+    if (op != GC_OP_STAGE) {
+        if (mask & 0x1) m.led = m.led_shadow;
+        if (mask & 0x2) m.fnd = m.fnd_shadow;
+    }
+    return 1;
+}
+
+/**
+ * @brief Bytes written after the address (single-byte slaves keep the last)
+ * @return 1 if every byte was ACKed
+ */
+static int slave_write(uint8_t addr, const uint8_t *data, uint8_t len) {
+    if (len == 0) {
+        return 1;
+    }
+
+    switch (addr) {
+    case I2C_ADDR_GENERAL_CALL:
+        return slave_gc(data, len);
+    case I2C_ADDR_LED:
+        m.led = m.led_shadow = data[len - 1];
+        return 1;
+    case I2C_ADDR_FND:
+        m.fnd = m.fnd_shadow = data[len - 1] & 0x0F;
+        return 1;
+    default:
+        return 1;               // Switch: address setup, data ignored
+    }
+}
+
+/**
+ * @brief Byte driven by the slave in a read (0xFF = SDA released)
+ */
+static uint8_t slave_read(uint8_t addr) {
+    return (addr == I2C_ADDR_SWITCH) ? m.sw : 0xFF;
+}
+
+//==============================================================================
+// Bus Timing
+//==============================================================================
+
+/**
+ * @brief Core clock cycles per SCL period for an address
+ */
+static uint64_t scl_cycles(uint8_t addr) {
+    uint32_t q = m.speed[addr & 0x7F];
+    if (q == 0) {
+        q = I2C_CORE_CLK_HZ / (m.cfg.scl_hz * 4UL);
+    }
+    return 4ULL * (q ? q : 1);
+}
+
+/**
+ * @brief Bus time of one transaction
+ * @param bytes Bytes after the address (address + ACK = 9 SCL each)
+ * @param stop  1 = ends with STOP
+ */
+static uint64_t xfer_cycles(uint8_t addr, uint32_t bytes, int stop) {
+    return scl_cycles(addr) * (1 + 9 * (1 + bytes) + (stop ? 1 : 0));
+}
+
+//==============================================================================
+// CONTROL Path
+//==============================================================================
+
+static void rx_push(uint8_t byte) {
+    if (m.rx_level < I2C_FIFO_DEPTH) {
+        m.rx[(m.rx_head + m.rx_level) % I2C_FIFO_DEPTH] = byte;
+        m.rx_level++;
+    }
+    m.rx_data = byte;
+}
+
+/**
+ * @brief Run the latched command on the slaves (at its end)
+ * @param abort 1 = dropped by a STATUS abort, no slave sees it
+ */
+static void control_finish(int abort) {
+    uint32_t c     = m.control;
+    uint8_t  addr  = (c >> I2C_CTRL_ADDR_SHIFT) & 0x7F;
+    int      rw    = (c & I2C_CTRL_RW_BIT) != 0;
+    uint32_t count = (c >> I2C_CTRL_CNT_SHIFT) & 0xFF;
+    uint8_t  data[I2C_FIFO_DEPTH + 1];
+    int      ack   = !abort && slave_present(addr) && !m.stuck;
+
+    if (count == 0) {
+        count = 1;
+    }
+
+    // SCL held past STRETCH_MAX: the master released the lines, no STOP
+    m.timeout = ack && m.stretch[addr];
+    if (m.timeout) {
+        ack = 0;
+    }
+
+    if (ack && !(c & I2C_CTRL_PROBE)) {
+        if (rw) {
+            for (uint32_t i = 0; i < count; i++) {
+                rx_push(slave_read(addr));
+            }
+        } else {
+            data[0] = (c >> I2C_CTRL_DATA_SHIFT) & 0xFF;
+            for (uint32_t i = 1; i < count; i++) {
+                data[i] = (i - 1 < m.tx_level) ? m.tx[i - 1] : 0xFF;
+            }
+            ack = slave_write(addr, data, (uint8_t)count);
+        }
+    } else if (!ack && rw) {
+        m.rx_data = 0xFF;
+    }
+
+    m.tx_level   = 0;
+    m.busy       = 0;
+    m.done       = 1;
+    m.ack_error  = !ack;
+    m.held       = ack && (c & I2C_CTRL_HOLD);
+    m.done_ticks = (uint32_t)m.done_at;
+}
+
+/**
+ * @brief Let simulated time pass, finishing work that ends meanwhile
+ */
+static void advance(uint64_t cycles) {
+    m.now += cycles;
+
+    if (m.busy && m.now >= m.done_at) {
+        if (m.scan_ctrl & I2C_SCAN_START) {
+            m.scan_ctrl &= ~I2C_SCAN_START;
+            m.busy = 0;
+        } else {
+            control_finish(0);
+        }
+    }
+}
+
+static void control_start(uint32_t value) {
+    uint8_t  addr  = (value >> I2C_CTRL_ADDR_SHIFT) & 0x7F;
+    uint32_t count = (value >> I2C_CTRL_CNT_SHIFT) & 0xFF;
+
+    if (m.busy) {
+        return;                 // Ignored while running
+    }
+    if (count == 0 || (value & I2C_CTRL_PROBE)) {
+        count = (value & I2C_CTRL_PROBE) ? 0 : 1;
+    }
+
+    m.control = value;
+    m.busy    = 1;
+    m.done    = 0;
+    m.transactions++;
+
+    if (m.stuck) {
+        m.done_at = NEVER;
+    } else if (!slave_present(addr)) {
+        m.done_at = m.now + xfer_cycles(addr, 0, 1);
+    } else if (m.stretch[addr]) {
+        m.done_at = m.now + xfer_cycles(addr, 0, 0) + STRETCH_MAX;
+    } else {
+        m.done_at = m.now + xfer_cycles(addr, count, !(value & I2C_CTRL_HOLD));
+    }
+    m.held = 0;                 // Repeated START continues the held bus
+}
+
+static void scan_start(uint32_t value) {
+    uint8_t first = (value >> I2C_SCAN_FIRST_SHIFT) & 0x7F;
+    uint8_t last  = (value >> I2C_SCAN_LAST_SHIFT) & 0x7F;
+
+    if (m.busy) {
+        return;
+    }
+
+    memset(m.scan_map, 0, sizeof(m.scan_map));
+    m.scan_ctrl = value;
+    m.busy      = 1;
+    m.done_at   = m.now;
+
+    for (uint32_t a = first; a <= last; a++) {
+        if (!m.stuck && slave_present((uint8_t)a) && a != I2C_ADDR_GENERAL_CALL) {
+            m.scan_map[a / 32] |= 1u << (a % 32);
+        }
+        m.done_at += xfer_cycles((uint8_t)a, 0, 1);
+        m.transactions++;
+    }
+    if (m.stuck) {
+        m.done_at = NEVER;
+    }
+}
+
+static uint32_t status_read(void) {
+    uint32_t s = 0;
+
+    if (m.busy)                         s |= I2C_STAT_BUSY;
+    if (m.done)                         s |= I2C_STAT_DONE;
+    if (m.ack_error)                    s |= I2C_STAT_ACK_ERROR;
+    if (m.tx_level >= I2C_FIFO_DEPTH)   s |= I2C_STAT_TX_FULL;
+    if (m.rx_level == 0)                s |= I2C_STAT_RX_EMPTY;
+    if (m.win_error)                    s |= I2C_STAT_WIN_ERROR;
+    if (m.busy || m.held)               s |= I2C_STAT_BUS_BUSY;
+    if (m.held)                         s |= I2C_STAT_HELD;
+    if (m.timeout)                      s |= I2C_STAT_TIMEOUT;
+
+    return s | ((uint32_t)m.tx_level << 8) | ((uint32_t)m.rx_level << 16);
+}
+
+//==============================================================================
+// Register Backend (I2C_HOST_MOCK hooks)
+//==============================================================================
+
+uint32_t i2c_mock_read(uint32_t offset) {
+    advance(m.cfg.access_cycles);
+    m.stats.reads++;
+
+    switch (offset) {
+    case I2C_REG_CONTROL:    return m.control;
+    case I2C_REG_STATUS:
+        m.stats.status_reads++;
+        return status_read();
+    case I2C_REG_RX_DATA:    return m.rx_data;
+    case I2C_REG_RX_FIFO: {
+        uint8_t byte = 0;
+        if (m.rx_level > 0) {
+            byte = m.rx[m.rx_head];
+            m.rx_head = (m.rx_head + 1) % I2C_FIFO_DEPTH;
+            m.rx_level--;
+        }
+        return byte;
+    }
+    case I2C_REG_CONFIG:     return m.config;
+    case I2C_REG_SPEED:
+        return ((uint32_t)m.speed_sel << I2C_SPEED_ADDR_SHIFT) | m.speed[m.speed_sel];
+    case I2C_REG_SCAN_CTRL:
+        return (m.scan_ctrl & ~0xFFu) |
+               ((m.scan_ctrl & I2C_SCAN_START) ? I2C_SCAN_BUSY : 0);
+    case I2C_REG_ARB_PRIO:   return m.arb_prio & 0xFFF;
+    case I2C_REG_TICKS:
+        m.stats.counter_reads++;
+        return (uint32_t)m.now;
+    case I2C_REG_DONE_TICKS: return m.done_ticks;
+    default:
+        if (offset >= I2C_REG_SCAN_MAP && offset < I2C_REG_SCAN_MAP + 16) {
+            return m.scan_map[(offset - I2C_REG_SCAN_MAP) / 4];
+        }
+        return 0;
+    }
+}
+
+void i2c_mock_write(uint32_t offset, uint32_t value) {
+    advance(m.cfg.access_cycles);
+    m.stats.writes++;
+
+    switch (offset) {
+    case I2C_REG_CONTROL:
+        control_start(value);
+        break;
+    case I2C_REG_STATUS:
+        if ((value & I2C_STAT_RELEASE) && m.held && !m.busy) {
+            m.held = 0;
+            advance(scl_cycles((m.control >> I2C_CTRL_ADDR_SHIFT) & 0x7F));
+        }
+        if (value & I2C_STAT_WIN_ERROR) {
+            m.win_error = 0;
+        }
+        if (value & I2C_STAT_ABORT) {
+            if (m.busy && !(m.scan_ctrl & I2C_SCAN_START)) {
+                m.done_at = m.now;
+                control_finish(1);
+            }
+            m.held = 0;
+        }
+        break;
+    case I2C_REG_TX_FIFO:
+        if (m.tx_level < I2C_FIFO_DEPTH) {
+            m.tx[m.tx_level++] = value & 0xFF;
+        }
+        break;
+    case I2C_REG_CONFIG:
+        m.config = value;
+        break;
+    case I2C_REG_SPEED:
+        m.speed_sel = (value >> I2C_SPEED_ADDR_SHIFT) & 0x7F;
+        m.speed[m.speed_sel] = value & I2C_SPEED_Q_MASK;
+        break;
+    case I2C_REG_SCAN_CTRL:
+        if (value & I2C_SCAN_START) {
+            scan_start(value);
+        }
+        break;
+    case I2C_REG_ARB_PRIO:
+        m.arb_prio = value;
+        break;
+    default:
+        break;
+    }
+}
+
+void i2c_mock_write8(uint32_t offset, uint8_t value) {
+    // Only the speed table select is written by byte lane
+    if (offset == I2C_REG_SPEED + 1) {
+        advance(m.cfg.access_cycles);
+        m.stats.writes++;
+        m.speed_sel = value & 0x7F;
+    }
+}
+
+uint32_t i2c_mock_win_read(uint32_t offset) {
+    uint8_t addr = (offset >> 10) & 0x7F;
+    uint8_t reg  = (offset >> 2) & 0xFF;
+    int     ack  = slave_present(addr) && !m.stuck;
+
+    // [ADDR+W][REG][Sr][ADDR+R][DATA]: the load stalls for the whole transfer
+    advance(m.cfg.access_cycles + xfer_cycles(addr, 1, 0) + xfer_cycles(addr, 1, 1));
+    m.transactions++;
+    m.stats.win_accesses++;
+
+    if (ack) {
+        ack = slave_write(addr, &reg, 1);
+    }
+    return ack ? slave_read(addr) : (I2C_WIN_NACK | 0xFF);
+}
+
+void i2c_mock_win_write(uint32_t offset, uint32_t value) {
+    uint8_t addr    = (offset >> 10) & 0x7F;
+    uint8_t data[2] = { (uint8_t)((offset >> 2) & 0xFF), (uint8_t)value };
+    int     ack     = slave_present(addr) && !m.stuck;
+
+    // [ADDR+W][REG][DATA]: stalls unless posted
+    advance(m.cfg.access_cycles +
+            ((m.config & I2C_CFG_WIN_POST) ? 0 : xfer_cycles(addr, 2, 1)));
+    m.transactions++;
+    m.stats.win_accesses++;
+
+    if (!ack || !slave_write(addr, data, 2)) {
+        m.win_error = 1;
+    }
+}
+
+uint32_t i2c_mock_counter_read(volatile uint32_t *counter) {
+    (void)counter;
+    advance(m.cfg.access_cycles);
+    m.stats.counter_reads++;
+    return (uint32_t)m.now;
+}
+
+//==============================================================================
+// Test Controls
+//==============================================================================
+
+void i2c_mock_reset(const i2c_mock_config_t *cfg) {
+    memset(&m, 0, sizeof(m));
+    m.cfg = cfg ? *cfg : mock_defaults;
+    if (m.cfg.scl_hz == 0) {
+        m.cfg.scl_hz = mock_defaults.scl_hz;
+    }
+    m.arb_prio = I2C_ARB_PRIO_RESET;
+}
+
+void i2c_mock_set_switch(uint8_t value) {
+    m.sw = value;
+}
+
+uint8_t i2c_mock_led(void) {
+    return m.led;
+}
+
+uint8_t i2c_mock_fnd(void) {
+    return m.fnd;
+}
+
+void i2c_mock_nack(uint8_t addr, int on) {
+    m.nack[addr & 0x7F] = on ? 1 : 0;
+}
+
+void i2c_mock_stuck(int on) {
+    // Released: the hung transaction ends (address not ACKed)
+    if (!on && m.busy && m.done_at == NEVER) {
+        m.done_at = m.now;
+        advance(0);
+    }
+
+    m.stuck = on;
+}
+
+void i2c_mock_stretch(uint8_t addr, int on) {
+    m.stretch[addr & 0x7F] = on ? 1 : 0;
+}
+
+uint32_t i2c_mock_transactions(void) {
+    return m.transactions;
+}
+
+uint64_t i2c_mock_cycles(void) {
+    return m.now;
+}
+
+void i2c_mock_get_stats(i2c_mock_stats_t *stats, int clear) {
+    if (stats != NULL) {
+        *stats = m.stats;
+    }
+    if (clear) {
+        memset(&m.stats, 0, sizeof(m.stats));
+    }
+}
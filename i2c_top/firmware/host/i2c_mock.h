@@ -0,0 +1,110 @@
+/**
+ * @file i2c_mock.h
+ * @brief Host Model of the AXI I2C Master IP and Board Slaves
+ *
+ * Build the driver with -DI2C_HOST_MOCK and link i2c_mock.c: register
+ * accesses (I2C_READ_REG / I2C_WRITE_REG / window / timebase counter) go
+ * to a simulated register file instead of the AXI bus.
+ *
+ * Model:
+ *  - Time counts core clock cycles; every register access costs
+ *    access_cycles, a transaction takes its SCL periods at the bus speed
+ *    (speed table entry of the address or scl_hz)
+ *  - CONTROL path with TX / RX FIFO, PEC flag accepted (no CRC), probe,
+ *    hold / repeated START, STATUS abort, bus scan, register window,
+ *    TICKS / DONE_TICKS
+ *  - Slaves: LED 0x55, FND 0x56 (write, general call WRITE / STAGE /
+ *    LATCH), switch 0x57 (read); other addresses NACK
+ *  - Faults: forced NACK per address, stuck bus (SDA held low), slave
+ *    holding SCL low (CONTROL path ends with the stretch timeout)
+ *  - Not modelled: SPI transport, command ports, link test
+ */
+
+#ifndef I2C_MOCK_H
+#define I2C_MOCK_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t scl_hz;            // Default bus speed (speed table entry 0)
+    uint32_t access_cycles;     // Core clock cycles per register access
+} i2c_mock_config_t;
+
+typedef struct {
+    uint32_t reads;             // Register loads (STATUS and TICKS included)
+    uint32_t writes;            // Register stores
+    uint32_t status_reads;      // STATUS loads (polls)
+    uint32_t counter_reads;     // Timebase counter loads, TICKS register loads
+    uint32_t win_accesses;      // Register window loads / stores
+} i2c_mock_stats_t;
+
+/**
+ * @brief Reset the IP and the slaves
+ * @param cfg Configuration (NULL = 100 kHz, 8 cycles per access)
+ */
+void i2c_mock_reset(const i2c_mock_config_t *cfg);
+
+/**
+ * @brief Switch positions returned by the switch slave
+ */
+void i2c_mock_set_switch(uint8_t value);
+
+/**
+ * @brief LED outputs
+ */
+uint8_t i2c_mock_led(void);
+
+/**
+ * @brief FND digit
+ */
+uint8_t i2c_mock_fnd(void);
+
+/**
+ * @brief Force NACK of a slave address
+ * @param addr 7-bit address
+ * @param on 1 = NACK, 0 = normal
+ */
+void i2c_mock_nack(uint8_t addr, int on);
+
+/**
+ * @brief Stuck bus: transactions started while on never finish
+ * @param on 1 = SDA held low, 0 = released (a hung transaction ends NACKed)
+ */
+void i2c_mock_stuck(int on);
+
+/**
+ * @brief Slave holds SCL low after its address ACK
+ *
+ * CONTROL transactions to addr end after the master's stretch timeout
+ * (500000 clk) with ACK_ERROR and TIMEOUT set in STATUS.
+ * @param addr 7-bit address
+ * @param on 1 = stretch forever, 0 = normal
+ */
+void i2c_mock_stretch(uint8_t addr, int on);
+
+/**
+ * @brief Transactions put on the bus since reset (probes, scans, window included)
+ */
+uint32_t i2c_mock_transactions(void);
+
+/**
+ * @brief Simulated core clock cycles since reset
+ */
+uint64_t i2c_mock_cycles(void);
+
+/**
+ * @brief Read the access counters
+ * @param stats Counters (NULL = only clear)
+ * @param clear 1 = reset the counters after reading
+ */
+void i2c_mock_get_stats(i2c_mock_stats_t *stats, int clear);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // I2C_MOCK_H
@@ -0,0 +1,601 @@
+/**
+ * @file test_driver.c
+ * @brief Driver Unit Tests against the Host Model (i2c_mock.c)
+ *
+ * Build: sim/run_firmware_host.sh (gcc -DI2C_HOST_MOCK)
+ */
+
+#include "i2c_driver.h"
+#include "i2c_regs.h"
+#include "timebase.h"
+#include "i2c_mock.h"
+#include <stdio.h>
+#include <stddef.h>
+
+//==============================================================================
+// Test Helpers
+//==============================================================================
+static int pass_count = 0;
+static int fail_count = 0;
+
+#define CHECK(cond) do {                                                \
+    if (cond) {                                                         \
+        pass_count++;                                                   \
+    } else {                                                            \
+        fail_count++;                                                   \
+        printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);        \
+    }                                                                   \
+} while (0)
+
+static void setup(uint32_t scl_hz) {
+    i2c_mock_config_t cfg = { scl_hz, 8 };
+
+    i2c_mock_reset(&cfg);
+    i2c_init(0x44A00000);
+    i2c_cache_invalidate();
+    i2c_cache_set_window(0);
+    i2c_health_set_policy(I2C_HEALTH_THRESHOLD, I2C_HEALTH_BACKOFF_MIN,
+                          I2C_HEALTH_BACKOFF_MAX);
+    i2c_health_reset(0xFF);
+}
+
+//==============================================================================
+// Tests
+//==============================================================================
+
+static void test_single_byte(void) {
+    uint8_t sw = 0;
+
+    printf("Test 1: LED / FND write, switch read\n");
+    setup(100000);
+
+    CHECK(i2c_write_led(0xA5) == I2C_SUCCESS);
+    CHECK(i2c_mock_led() == 0xA5);
+    CHECK(i2c_write_fnd(0x3C) == I2C_SUCCESS);
+    CHECK(i2c_mock_fnd() == 0x0C);
+
+    i2c_mock_set_switch(0x5A);
+    CHECK(i2c_read_switch(&sw) == I2C_SUCCESS);
+    CHECK(sw == 0x5A);
+    CHECK(i2c_mock_transactions() == 3);
+}
+
+static void test_general_call(void) {
+    printf("Test 2: General call WRITE / STAGE / LATCH\n");
+    setup(100000);
+
+    CHECK(i2c_write_led_fnd(0x81, 0x7) == I2C_SUCCESS);
+    CHECK(i2c_mock_led() == 0x81 && i2c_mock_fnd() == 0x7);
+    CHECK(i2c_mock_transactions() == 1);
+
+    uint8_t data[2] = { 0x42, 0x9 };
+    CHECK(i2c_gc_write(I2C_GC_DEV_LED | I2C_GC_DEV_FND, data, 1) == I2C_SUCCESS);
+    CHECK(i2c_mock_led() == 0x81);              // Staged only
+    CHECK(i2c_gc_latch(I2C_GC_DEV_LED | I2C_GC_DEV_FND) == I2C_SUCCESS);
+    CHECK(i2c_mock_led() == 0x42 && i2c_mock_fnd() == 0x9);
+}
+
+static void test_nack(void) {
+    uint8_t sw = 0;
+
+    printf("Test 3: NACK fault\n");
+    setup(100000);
+
+    i2c_mock_nack(I2C_ADDR_LED, 1);
+    CHECK(i2c_write_led(0x11) == I2C_ERR_NACK);
+    CHECK(i2c_mock_led() == 0x00);
+    CHECK(i2c_probe(I2C_ADDR_LED) == I2C_ERR_NACK);
+    CHECK(i2c_probe(I2C_ADDR_FND) == I2C_SUCCESS);
+
+    i2c_mock_nack(I2C_ADDR_SWITCH, 1);
+    CHECK(i2c_read_switch(&sw) == I2C_ERR_NACK);
+
+    i2c_mock_nack(I2C_ADDR_LED, 0);
+    CHECK(i2c_write_led(0x11) == I2C_SUCCESS);
+    CHECK(i2c_mock_led() == 0x11);
+}
+
+static void test_stuck_bus(void) {
+    printf("Test 4: Stuck bus times out\n");
+    setup(100000);
+
+    i2c_mock_stuck(1);
+    uint64_t t0 = i2c_mock_cycles();
+    CHECK(i2c_write_led(0x22) == I2C_ERR_TIMEOUT);
+    uint64_t waited = i2c_mock_cycles() - t0;
+
+    // 10 ms driver timeout at the 100 MHz core clock
+    CHECK(waited >= 1000000ULL && waited < 1100000ULL);
+    CHECK(i2c_write_led(0x22) == I2C_ERR_BUSY);
+
+    i2c_mock_stuck(0);
+    CHECK(i2c_write_led(0x22) == I2C_SUCCESS);
+    CHECK(i2c_mock_led() == 0x22);
+}
+
+static void test_bus_speed(void) {
+    uint64_t t100, t400;
+
+    printf("Test 5: Bus speed (global and speed table)\n");
+    setup(100000);
+    uint64_t t0 = i2c_mock_cycles();
+    i2c_write_led(0x01);
+    t100 = i2c_mock_cycles() - t0;
+
+    setup(400000);
+    t0 = i2c_mock_cycles();
+    i2c_write_led(0x01);
+    t400 = i2c_mock_cycles() - t0;
+
+    // 2 bytes + START / STOP = 20 SCL periods
+    CHECK(t100 >= 20000 && t100 < 21000);
+    CHECK(t400 >= 4900 && t400 < 6000);      // Quarter rounds down
+
+    setup(100000);
+    CHECK(i2c_set_speed(I2C_ADDR_LED, 1000000) == I2C_SUCCESS);
+    CHECK(i2c_get_speed(I2C_ADDR_LED) == 1000000);
+    t0 = i2c_mock_cycles();
+    i2c_write_led(0x01);
+    CHECK(i2c_mock_cycles() - t0 < 2500);
+}
+
+static void test_shadow_cache(void) {
+    i2c_cache_stats_t st;
+
+    printf("Test 6: Shadow cache drops repeats, merges LED + FND\n");
+    setup(100000);
+    i2c_cache_get_stats(NULL, 1);
+
+    CHECK(i2c_cache_write(I2C_ADDR_LED, 0x0F) == I2C_SUCCESS);
+    CHECK(i2c_cache_write(I2C_ADDR_LED, 0x0F) == I2C_SUCCESS);
+    CHECK(i2c_mock_transactions() == 1);
+    CHECK(i2c_mock_led() == 0x0F);
+
+    i2c_cache_set_window(1000);
+    CHECK(i2c_cache_write(I2C_ADDR_LED, 0x10) == I2C_SUCCESS);
+    CHECK(i2c_cache_write(I2C_ADDR_LED, 0x20) == I2C_SUCCESS);
+    CHECK(i2c_cache_write(I2C_ADDR_FND, 0x3) == I2C_SUCCESS);
+    CHECK(i2c_mock_transactions() == 1);        // Still staged
+
+    timebase_delay_us(1000);
+    CHECK(i2c_cache_poll() == I2C_SUCCESS);
+    CHECK(i2c_mock_transactions() == 2);        // One general call
+    CHECK(i2c_mock_led() == 0x20 && i2c_mock_fnd() == 0x3);
+
+    i2c_cache_get_stats(&st, 0);
+    CHECK(st.hits == 1 && st.misses == 4 && st.suppressed == 1);
+    CHECK(st.transfers == 2);
+}
+
+static int async_result;
+static int async_calls;
+
+static void on_done(int handle, int result, void *ctx) {
+    (void)handle;
+    (void)ctx;
+    async_result = result;
+    async_calls++;
+}
+
+static void test_async(void) {
+    uint8_t sw = 0;
+    uint8_t led[1] = { 0x77 };
+
+    printf("Test 7: Async submit / poll\n");
+    setup(100000);
+    i2c_mock_set_switch(0x3E);
+
+    const i2c_op_t rd = { I2C_ADDR_SWITCH, 1, 1, 0, NULL, &sw };
+    const i2c_op_t wr = { I2C_ADDR_LED, 0, 1, 0, led, NULL };
+
+    CHECK(i2c_submit(&rd, on_done, NULL) >= 0);
+    CHECK(i2c_submit(&wr, on_done, NULL) >= 0);
+
+    int spins = 0;
+    while (i2c_poll() > 0 && spins < 100000) {
+        spins++;
+    }
+    CHECK(async_calls == 2 && async_result == I2C_SUCCESS);
+    CHECK(sw == 0x3E);
+    CHECK(i2c_mock_led() == 0x77);
+}
+
+static void test_transfer(void) {
+    uint8_t cmd = 0x00;
+    uint8_t sw  = 0;
+
+    printf("Test 8: i2c_transfer with repeated START\n");
+    setup(100000);
+    i2c_mock_set_switch(0xC3);
+
+    struct i2c_msg msgs[2] = {
+        { I2C_ADDR_SWITCH, 0,        1, &cmd },
+        { I2C_ADDR_SWITCH, I2C_M_RD, 1, &sw  }
+    };
+    CHECK(i2c_transfer(msgs, 2) == 2);
+    CHECK(sw == 0xC3);
+    CHECK((I2C_READ_REG(I2C_REG_STATUS) & I2C_STAT_HELD) == 0);
+}
+
+static void test_scan_window(void) {
+    uint32_t map[4];
+    uint8_t  v = 0;
+
+    printf("Test 9: Bus scan and register window\n");
+    setup(400000);
+
+    CHECK(i2c_scan(0x08, 0x77, map, 100000) == I2C_SUCCESS);
+    CHECK(i2c_scan_present(map, I2C_ADDR_LED));
+    CHECK(i2c_scan_present(map, I2C_ADDR_SWITCH));
+    CHECK(!i2c_scan_present(map, 0x50));
+
+    i2c_window_init(0x44A20000);
+    i2c_mock_set_switch(0x99);
+    CHECK(i2c_window_read(I2C_ADDR_SWITCH, 0, &v) == I2C_SUCCESS);
+    CHECK(v == 0x99);
+    CHECK(i2c_window_read(0x50, 0, &v) == I2C_ERR_NACK);
+    CHECK(i2c_window_write(I2C_ADDR_LED, 0x00, 0x5D) == I2C_SUCCESS);
+    CHECK(i2c_mock_led() == 0x5D);
+}
+
+static void test_app_loop(void) {
+    i2c_cache_stats_t st;
+
+    printf("Test 10: Switch -> LED / FND loop (2 s simulated)\n");
+    setup(100000);
+    i2c_cache_set_window(100000);
+    i2c_cache_get_stats(NULL, 1);
+
+    // Switch mirror loop: read, stage, flush every 100 ms
+    for (int i = 0; i < 20; i++) {
+        uint8_t sw;
+
+        i2c_mock_set_switch((i < 10) ? 0x12 : 0x34);
+        if (i2c_read_switch(&sw) == I2C_SUCCESS) {
+            i2c_cache_write(I2C_ADDR_LED, sw);
+            i2c_cache_write(I2C_ADDR_FND, sw & 0x0F);
+            i2c_cache_flush();
+        }
+        timebase_delay_ms(100);
+    }
+
+    i2c_cache_get_stats(&st, 0);
+    CHECK(i2c_mock_led() == 0x34 && i2c_mock_fnd() == 0x4);
+    CHECK(st.transfers == 2);                   // One general call per change
+    CHECK(i2c_mock_transactions() == 22);       // 20 switch reads + 2 writes
+    CHECK(i2c_mock_cycles() >= 200000000ULL);
+}
+
+static void test_health(void) {
+    i2c_health_t h;
+    uint8_t sw = 0;
+    uint32_t tr;
+
+    printf("Test 11: Slave health, fail fast, backoff re-probe\n");
+    setup(100000);
+
+    // Three NACKs in a row mark the switch down
+    i2c_mock_nack(I2C_ADDR_SWITCH, 1);
+    CHECK(i2c_read_switch(&sw) == I2C_ERR_NACK);
+    CHECK(i2c_health_get(I2C_ADDR_SWITCH, &h) == I2C_SUCCESS);
+    CHECK(h.state == I2C_HEALTH_SUSPECT && h.fails == 1);
+    CHECK(i2c_read_switch(&sw) == I2C_ERR_NACK);
+    CHECK(i2c_read_switch(&sw) == I2C_ERR_NACK);
+    i2c_health_get(I2C_ADDR_SWITCH, &h);
+    CHECK(h.state == I2C_HEALTH_DOWN && h.backoff_us == I2C_HEALTH_BACKOFF_MIN);
+
+    // Down: no bus traffic, returns within a few register accesses
+    tr = i2c_mock_transactions();
+    uint64_t t0 = i2c_mock_cycles();
+    CHECK(i2c_read_switch(&sw) == I2C_ERR_DOWN);
+    CHECK(i2c_mock_cycles() - t0 < 1000);
+    CHECK(i2c_mock_transactions() == tr);
+
+    // Healthy slaves are not affected
+    CHECK(i2c_write_led(0x3C) == I2C_SUCCESS);
+    CHECK(i2c_health_get(I2C_ADDR_LED, &h) == I2C_SUCCESS && h.state == I2C_HEALTH_UP);
+
+    // Backoff passed: one probe, still absent, interval doubles
+    timebase_delay_ms(10);
+    tr = i2c_mock_transactions();
+    CHECK(i2c_read_switch(&sw) == I2C_ERR_DOWN);
+    CHECK(i2c_mock_transactions() == tr + 1);
+    i2c_health_get(I2C_ADDR_SWITCH, &h);
+    CHECK(h.backoff_us == 2 * I2C_HEALTH_BACKOFF_MIN && h.probes == 1);
+    CHECK(h.retry_us > 0 && h.retry_us <= h.backoff_us);
+    CHECK(h.fast_fails == 1);
+
+    // Board back: refused until the next probe, then probe + read
+    i2c_mock_nack(I2C_ADDR_SWITCH, 0);
+    i2c_mock_set_switch(0x81);
+    CHECK(i2c_read_switch(&sw) == I2C_ERR_DOWN);
+    timebase_delay_ms(20);
+    tr = i2c_mock_transactions();
+    CHECK(i2c_read_switch(&sw) == I2C_SUCCESS && sw == 0x81);
+    CHECK(i2c_mock_transactions() == tr + 2);
+    i2c_health_get(I2C_ADDR_SWITCH, &h);
+    CHECK(h.state == I2C_HEALTH_UP && h.fails == 0);
+
+    // Interval cap
+    i2c_health_set_policy(1, 1000, 3000);
+    i2c_mock_nack(I2C_ADDR_FND, 1);
+    CHECK(i2c_write_fnd(0x1) == I2C_ERR_NACK);
+    for (int i = 0; i < 3; i++) {
+        timebase_delay_ms(3);
+        i2c_write_fnd(0x1);
+    }
+    i2c_health_get(I2C_ADDR_FND, &h);
+    CHECK(h.state == I2C_HEALTH_DOWN && h.backoff_us == 3000 && h.probes == 3);
+
+    // Async requests and combined transfers fail fast too
+    const i2c_op_t op = { I2C_ADDR_FND, 0, 1, 0, &sw, NULL };
+    CHECK(i2c_submit(&op, NULL, NULL) == I2C_ERR_DOWN);
+    struct i2c_msg msg = { I2C_ADDR_FND, 0, 1, &sw };
+    CHECK(i2c_transfer(&msg, 1) == I2C_ERR_DOWN);
+
+    // A probe ACK or a reset marks it up
+    i2c_mock_nack(I2C_ADDR_FND, 0);
+    CHECK(i2c_probe(I2C_ADDR_FND) == I2C_SUCCESS);
+    i2c_health_get(I2C_ADDR_FND, &h);
+    CHECK(h.state == I2C_HEALTH_UP);
+    i2c_mock_nack(I2C_ADDR_LED, 1);
+    i2c_write_led(0x01);
+    i2c_health_get(I2C_ADDR_LED, &h);
+    CHECK(h.state == I2C_HEALTH_DOWN);
+    i2c_health_reset(I2C_ADDR_LED);
+    i2c_health_get(I2C_ADDR_LED, &h);
+    CHECK(h.state == I2C_HEALTH_UP);
+
+    // Timeouts count as failures
+    i2c_health_set_policy(I2C_HEALTH_THRESHOLD, I2C_HEALTH_BACKOFF_MIN,
+                          I2C_HEALTH_BACKOFF_MAX);
+    i2c_mock_nack(I2C_ADDR_LED, 0);
+    i2c_mock_stuck(1);
+    CHECK(i2c_write_led(0x02) == I2C_ERR_TIMEOUT);
+    i2c_health_get(I2C_ADDR_LED, &h);
+    CHECK(h.state == I2C_HEALTH_SUSPECT && h.fails == 1);
+    i2c_mock_stuck(0);
+}
+
+static void test_dead_switch_loop(void) {
+    printf("Test 12: Loop with the switch board unplugged (2 s simulated)\n");
+    setup(100000);
+    i2c_mock_nack(I2C_ADDR_SWITCH, 1);
+
+    // Switch reads stop reaching the bus, the LED keeps its 100 ms rate
+    int led_ok = 0;
+    for (int i = 0; i < 20; i++) {
+        uint8_t sw;
+
+        i2c_read_switch(&sw);
+        if (i2c_write_led((uint8_t)i) == I2C_SUCCESS) {
+            led_ok++;
+        }
+        timebase_delay_ms(100);
+    }
+
+    // 20 LED writes, 3 switch NACKs (each checked by a probe), probes at
+    // 10, 20, 40 ... ms intervals
+    CHECK(led_ok == 20);
+    CHECK(i2c_mock_transactions() < 20 + 3 * 2 + 10);
+}
+
+static void test_health_classify(void) {
+    static const uint8_t bad_gc[2] = { 0x40, 0x12 };    // Unknown GC command
+    const i2c_op_t gc_op = { I2C_ADDR_GENERAL_CALL, 0, 2, 0, bad_gc, NULL };
+    i2c_health_t h;
+    uint32_t tr;
+    uint8_t sw;
+
+    printf("Test 13: Only absent slaves count (data NACK, training)\n");
+    setup(100000);
+
+    // Data byte NACKed: the address probe ACKs, the slave stays up
+    for (int i = 0; i < I2C_HEALTH_THRESHOLD + 1; i++) {
+        tr = i2c_mock_transactions();
+        CHECK(i2c_write_bytes(I2C_ADDR_GENERAL_CALL, bad_gc, 2) == I2C_ERR_NACK);
+        CHECK(i2c_mock_transactions() == tr + 2);
+    }
+    i2c_health_get(I2C_ADDR_GENERAL_CALL, &h);
+    CHECK(h.state == I2C_HEALTH_UP && h.fails == 0);
+
+    // Same on the async path: the probe runs before the next request
+    for (int i = 0; i < I2C_HEALTH_THRESHOLD + 1; i++) {
+        CHECK(i2c_submit(&gc_op, NULL, NULL) >= 0);
+        while (i2c_poll() > 0);
+    }
+    i2c_health_get(I2C_ADDR_GENERAL_CALL, &h);
+    CHECK(h.state == I2C_HEALTH_UP);
+    CHECK(i2c_write_led(0x5A) == I2C_SUCCESS);
+
+    // Address NACKed on the async path still counts
+    const i2c_op_t rd = { I2C_ADDR_SWITCH, 1, 1, 0, NULL, &sw };
+    i2c_mock_nack(I2C_ADDR_SWITCH, 1);
+    for (int i = 0; i < I2C_HEALTH_THRESHOLD; i++) {
+        CHECK(i2c_submit(&rd, NULL, NULL) >= 0);
+        while (i2c_poll() > 0);
+    }
+    i2c_health_get(I2C_ADDR_SWITCH, &h);
+    CHECK(h.state == I2C_HEALTH_DOWN);
+
+    // Failed speed training leaves the table alone
+    i2c_health_reset(0xFF);
+    uint32_t hz = 1;
+    CHECK(i2c_train_speed(I2C_ADDR_SWITCH, NULL, &hz) == I2C_ERR_NACK && hz == 0);
+    i2c_health_get(I2C_ADDR_SWITCH, &h);
+    CHECK(h.state == I2C_HEALTH_UP && h.fails == 0);
+    i2c_mock_nack(I2C_ADDR_SWITCH, 0);
+}
+
+static void test_cache_coherence(void) {
+    static const uint8_t gc_wr[3] = { I2C_GC_OP_WRITE | 0x3, 0x66, 0x7 };
+    static const uint8_t async_tx[1] = { 0x99 };
+    const i2c_op_t wr = { I2C_ADDR_LED, 0, 1, 0, async_tx, NULL };
+    struct i2c_msg msg = { I2C_ADDR_FND, 0, 1, (uint8_t *)&async_tx[0] };
+    uint32_t tr;
+
+    printf("Test 14: Shadow cache follows writes outside the cache API\n");
+    setup(100000);
+
+    // Raw write behind the cache: the old value must go out again
+    CHECK(i2c_cache_write(I2C_ADDR_LED, 0x11) == I2C_SUCCESS);
+    CHECK(i2c_write(I2C_ADDR_LED, 0x22) == I2C_SUCCESS);
+    CHECK(i2c_cache_write(I2C_ADDR_LED, 0x11) == I2C_SUCCESS);
+    CHECK(i2c_mock_led() == 0x11);
+
+    // Decoded: a repeat of what the general call wrote is dropped
+    CHECK(i2c_write_bytes(I2C_ADDR_GENERAL_CALL, gc_wr, 3) == I2C_SUCCESS);
+    tr = i2c_mock_transactions();
+    CHECK(i2c_cache_write(I2C_ADDR_LED, 0x66) == I2C_SUCCESS);
+    CHECK(i2c_cache_write(I2C_ADDR_FND, 0x7) == I2C_SUCCESS);
+    CHECK(i2c_mock_transactions() == tr);
+
+    // Latch: outputs unknown, written again
+    CHECK(i2c_gc_latch(I2C_GC_DEV_LED) == I2C_SUCCESS);
+    tr = i2c_mock_transactions();
+    CHECK(i2c_cache_write(I2C_ADDR_LED, 0x66) == I2C_SUCCESS);
+    CHECK(i2c_mock_transactions() == tr + 1);
+
+    // Async write: unknown while queued, recorded when done
+    CHECK(i2c_submit(&wr, NULL, NULL) >= 0);
+    CHECK(i2c_cache_needed(I2C_ADDR_LED, 0x99) == 1);
+    while (i2c_poll() > 0);
+    CHECK(i2c_cache_needed(I2C_ADDR_LED, 0x99) == 0);
+    CHECK(i2c_cache_write(I2C_ADDR_LED, 0x66) == I2C_SUCCESS);
+    CHECK(i2c_mock_led() == 0x66);
+
+    // Combined transfer and window store are not decoded
+    CHECK(i2c_cache_write(I2C_ADDR_FND, 0x4) == I2C_SUCCESS);
+    CHECK(i2c_transfer(&msg, 1) == 1);
+    CHECK(i2c_cache_write(I2C_ADDR_FND, 0x4) == I2C_SUCCESS);
+    CHECK(i2c_mock_fnd() == 0x4);
+    i2c_window_init(0x44A20000);
+    CHECK(i2c_window_write(I2C_ADDR_LED, 0x00, 0x5D) == I2C_SUCCESS);
+    CHECK(i2c_cache_write(I2C_ADDR_LED, 0x66) == I2C_SUCCESS);
+    CHECK(i2c_mock_led() == 0x66);
+
+    // A failed write leaves the value unknown
+    i2c_mock_nack(I2C_ADDR_LED, 1);
+    CHECK(i2c_write(I2C_ADDR_LED, 0x01) == I2C_ERR_NACK);
+    i2c_mock_nack(I2C_ADDR_LED, 0);
+    CHECK(i2c_cache_needed(I2C_ADDR_LED, 0x66) == 1);
+}
+
+//==============================================================================
+// Main
+//==============================================================================
+
+static void test_stretch_timeout(void) {
+    uint8_t sw = 0;
+    uint8_t led[1] = { 0x33 };
+    const i2c_op_t wr = { I2C_ADDR_LED, 0, 1, 0, led, NULL };
+    int spins = 0;
+
+    printf("Test 15: SCL stretch timeout reported as I2C_ERR_TIMEOUT\n");
+    setup(100000);
+    CHECK(i2c_write_led(0x11) == I2C_SUCCESS);
+    i2c_mock_stretch(I2C_ADDR_LED, 1);
+
+    // Ended by the master (5 ms), not by the driver's 10 ms wait
+    uint64_t t0 = i2c_mock_cycles();
+    CHECK(i2c_write(I2C_ADDR_LED, 0x22) == I2C_ERR_TIMEOUT);
+    CHECK(i2c_mock_cycles() - t0 < 1000000);
+    CHECK(I2C_READ_REG(I2C_REG_STATUS) & I2C_STAT_TIMEOUT);
+    CHECK(!i2c_bus_is_busy());
+    CHECK(i2c_mock_led() == 0x11);
+
+    // Bus free again; the next start clears TIMEOUT
+    i2c_mock_set_switch(0x5A);
+    CHECK(i2c_read_switch(&sw) == I2C_SUCCESS && sw == 0x5A);
+    CHECK((I2C_READ_REG(I2C_REG_STATUS) & I2C_STAT_TIMEOUT) == 0);
+
+    // Async path
+    async_calls = 0;
+    CHECK(i2c_submit(&wr, on_done, NULL) >= 0);
+    while (i2c_poll() > 0 && spins < 1000000) {
+        spins++;
+    }
+    CHECK(async_calls == 1 && async_result == I2C_ERR_TIMEOUT);
+
+    i2c_mock_stretch(I2C_ADDR_LED, 0);
+    CHECK(i2c_write(I2C_ADDR_LED, 0x22) == I2C_SUCCESS);
+    CHECK(i2c_mock_led() == 0x22);
+}
+
+static void test_async_deadline(void) {
+    uint8_t led1[1] = { 0x5A };
+    uint8_t led2[1] = { 0x6B };
+    const i2c_op_t wr1 = { I2C_ADDR_LED, 0, 1, 0, led1, NULL };
+    const i2c_op_t wr2 = { I2C_ADDR_LED, 0, 1, 0, led2, NULL };
+    int spins = 0;
+
+    printf("Test 16: Async deadline and cancel abort a hung transfer\n");
+    setup(100000);
+    CHECK(i2c_write_led(0x11) == I2C_SUCCESS);
+
+    // Hung head: completed with a timeout after 10 ms, bus free again
+    i2c_mock_stuck(1);
+    async_calls = 0;
+    uint64_t t0 = i2c_mock_cycles();
+    CHECK(i2c_submit(&wr1, on_done, NULL) >= 0);
+    while (i2c_poll() > 0 && spins < 1000000) {
+        spins++;
+    }
+    uint64_t dt = i2c_mock_cycles() - t0;
+    CHECK(async_calls == 1 && async_result == I2C_ERR_TIMEOUT);
+    CHECK(dt >= 1000000 && dt < 1010000);
+    CHECK(!i2c_bus_is_busy());
+    CHECK(i2c_mock_led() == 0x11);
+
+    // Cancel the running head: aborted, the next one goes on the bus
+    async_calls = 0;
+    int h1 = i2c_submit(&wr1, on_done, NULL);
+    int h2 = i2c_submit(&wr2, on_done, NULL);
+    CHECK(h1 >= 0 && h2 >= 0);
+    CHECK(i2c_cancel(h1) == I2C_SUCCESS);
+    CHECK(i2c_cancel(h1) == I2C_ERR_PARAM);
+    CHECK(i2c_bus_is_busy());                   // h2 started, still hung
+    CHECK(i2c_cancel(h2) == I2C_SUCCESS);
+    CHECK(!i2c_bus_is_busy() && i2c_poll() == 0);
+    CHECK(async_calls == 0 && i2c_mock_led() == 0x11);
+
+    // Aborted writes left the LED unknown: the cached value goes out again
+    i2c_mock_stuck(0);
+    uint32_t tr = i2c_mock_transactions();
+    CHECK(i2c_cache_write(I2C_ADDR_LED, 0x11) == I2C_SUCCESS);
+    CHECK(i2c_mock_transactions() == tr + 1);
+    CHECK(i2c_submit(&wr2, on_done, NULL) >= 0);
+    while (i2c_poll() > 0) {
+    }
+    CHECK(async_calls == 1 && async_result == I2C_SUCCESS);
+    CHECK(i2c_mock_led() == 0x6B);
+}
+
+int main(void) {
+    printf("========================================\n");
+    printf("I2C Driver Host Tests (mock backend)\n");
+    printf("========================================\n");
+
+    test_single_byte();
+    test_general_call();
+    test_nack();
+    test_stuck_bus();
+    test_bus_speed();
+    test_shadow_cache();
+    test_async();
+    test_transfer();
+    test_scan_window();
+    test_app_loop();
+    test_health();
+    test_dead_switch_loop();
+    test_health_classify();
+    test_cache_coherence();
+    test_stretch_timeout();
+    test_async_deadline();
+
+    printf("========================================\n");
+    printf("Checks passed: %d, failed: %d\n", pass_count, fail_count);
+    printf("========================================\n");
+
+    return fail_count ? 1 : 0;
+}
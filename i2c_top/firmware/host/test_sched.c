@@ -0,0 +1,200 @@
+/**
+ * @file test_sched.c
+ * @brief Scheduler Unit Tests against the Host Model (i2c_mock.c)
+ *
+ * Build: sim/run_firmware_host.sh (gcc -DI2C_HOST_MOCK)
+ */
+
+#include "i2c_driver.h"
+#include "sched.h"
+#include "timebase.h"
+#include "i2c_mock.h"
+#include <stdio.h>
+#include <stddef.h>
+
+extern void demo_tasks_start(void);
+
+//==============================================================================
+// Test Helpers
+//==============================================================================
+static int pass_count = 0;
+static int fail_count = 0;
+
+#define CHECK(cond) do {                                                \
+    if (cond) {                                                         \
+        pass_count++;                                                   \
+    } else {                                                            \
+        fail_count++;                                                   \
+        printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);        \
+    }                                                                   \
+} while (0)
+
+static void setup(void) {
+    i2c_mock_reset(NULL);
+    i2c_init(0x44A00000);
+    sched_reset();
+}
+
+//==============================================================================
+// Tests
+//==============================================================================
+static int ticks_a, ticks_b, oneshot, user_events;
+
+static void task_a(int task, uint32_t events, void *ctx) {
+    (void)task; (void)ctx;
+    if (events & SCHED_EV_TIMER) ticks_a++;
+}
+
+static void task_b(int task, uint32_t events, void *ctx) {
+    int *peer = (int *)ctx;
+    (void)task;
+    if (events & SCHED_EV_TIMER) {
+        ticks_b++;
+        sched_signal(*peer, SCHED_EV_USER(3));
+    }
+}
+
+static void task_c(int task, uint32_t events, void *ctx) {
+    (void)task; (void)ctx;
+    if (events & SCHED_EV_TIMER) oneshot++;
+    if (events & SCHED_EV_USER(3)) user_events++;
+}
+
+static void test_timers(void) {
+    int a, b, c;
+
+    printf("Test 1: Periodic / one-shot timers, user events\n");
+    setup();
+    ticks_a = ticks_b = oneshot = user_events = 0;
+
+    a = sched_task(task_a, NULL);
+    c = sched_task(task_c, NULL);
+    b = sched_task(task_b, &c);
+    CHECK(a == 0 && c == 1 && b == 2);
+
+    sched_every_us(a, 10000);       // 10 ms
+    sched_every_us(b, 250000);      // 250 ms
+    sched_after_us(c, 500000);      // once at 500 ms
+
+    sched_run_for(1005);
+    CHECK(ticks_a == 100);
+    CHECK(ticks_b == 4);
+    CHECK(oneshot == 1);
+    CHECK(user_events == 4);
+    CHECK(sched_max_lateness(0) < timebase_us_to_ticks(10));
+
+    sched_stop_timer(a);
+    sched_run_for(100);
+    CHECK(ticks_a == 100);
+}
+
+static int io_task, io_done, io_result;
+static uint8_t io_rx;
+
+static void task_io(int task, uint32_t events, void *ctx) {
+    static const i2c_op_t rd = { I2C_ADDR_SWITCH, 1, 1, 0, NULL, &io_rx };
+    (void)ctx;
+    if (events & SCHED_EV_TIMER) {
+        sched_i2c_submit(task, &rd);
+    }
+    if (events & SCHED_EV_I2C) {
+        io_done++;
+        io_result = sched_i2c_result(task);
+    }
+}
+
+static void test_i2c_events(void) {
+    printf("Test 2: I2C completion events\n");
+    setup();
+    io_done = 0;
+    i2c_mock_set_switch(0x6B);
+
+    io_task = sched_task(task_io, NULL);
+    sched_after_us(io_task, 1000);
+    sched_run_for(5);
+    CHECK(io_done == 1 && io_result == I2C_SUCCESS && io_rx == 0x6B);
+    CHECK(sched_i2c_pending(io_task) == 0);
+
+    i2c_mock_nack(I2C_ADDR_SWITCH, 1);
+    sched_after_us(io_task, 1000);
+    sched_run_for(5);
+    CHECK(io_done == 2 && io_result == I2C_ERR_NACK);
+}
+
+static void test_concurrent_demo(void) {
+    uint8_t led_seen = 0;
+    int led_changes = 0;
+
+    printf("Test 3: LED / FND / switch tasks share the bus\n");
+    setup();
+    demo_tasks_start();
+
+    // Running light and counter advance together
+    for (int i = 0; i < 22; i++) {
+        sched_run_for(50);
+        if (i2c_mock_led() != led_seen) {
+            led_seen = i2c_mock_led();
+            led_changes++;
+        }
+    }
+    CHECK(led_changes >= 10);
+    CHECK(i2c_mock_fnd() == 2);
+
+    // A switch change reaches LED and FND within one poll period + transfers
+    i2c_mock_set_switch(0xC5);
+    sched_run_for(21);
+    CHECK(i2c_mock_led() == 0xC5);
+    CHECK(i2c_mock_fnd() == 0x5);
+
+    // Switches held still: only switch reads reach the bus (cache hits)
+    uint32_t tr = i2c_mock_transactions();
+    sched_run_for(500);
+    CHECK(i2c_mock_transactions() - tr <= 500 / 20 + 1);
+    CHECK(i2c_mock_led() == 0xC5);
+
+    // Bus traffic never delays a timer by more than one transfer
+    CHECK(sched_max_lateness(0) < timebase_us_to_ticks(300));
+
+    while (i2c_poll() > 0);
+}
+
+static void test_demo_modes(void) {
+    printf("Test 4: Demo modes follow the old blocking sequences\n");
+    setup();
+    demo_tasks_start();
+
+    // Running light: 40 steps of 100 ms, then blink at 500 ms
+    sched_run_for(4250);
+    CHECK(i2c_mock_led() == 0xFF);
+    sched_run_for(500);
+    CHECK(i2c_mock_led() == 0x00);
+
+    // FND: count 16 x 500 ms (8 s), then countdown from F every 400 ms
+    sched_run_for(8000 - 4750 + 100);
+    CHECK(i2c_mock_fnd() == 0xF);
+    sched_run_for(400);
+    CHECK(i2c_mock_fnd() == 0xE);
+
+    while (i2c_poll() > 0);
+}
+
+//==============================================================================
+// Main
+//==============================================================================
+
+int main(void) {
+    printf("========================================\n");
+    printf("Scheduler Host Tests (mock backend)\n");
+    printf("========================================\n");
+
+    test_timers();
+    test_i2c_events();
+    test_concurrent_demo();
+    test_demo_modes();
+
+    printf("========================================\n");
+    printf("Checks passed: %d, failed: %d\n", pass_count, fail_count);
+    printf("========================================\n");
+
+    return fail_count ? 1 : 0;
+}
@@ -17,6 +17,16 @@
 #define I2C_ADDR_FND        0x56    // 7-Segment Display Slave (Write-only)
 #define I2C_ADDR_SWITCH     0x57    // Switch Slave (Read-only)
 
+//==============================================================================
+// General Call (address 0x00): command = opcode | device mask
+//==============================================================================
+#define I2C_GC_OP_WRITE     0x10    // Data -> selected devices, update at STOP
+#define I2C_GC_OP_STAGE     0x20    // Data -> shadow registers, no update
+#define I2C_GC_OP_LATCH     0x30    // Shadow -> outputs of selected devices
+
+#define I2C_GC_DEV_LED      (1 << 0)
+#define I2C_GC_DEV_FND      (1 << 1)
+
 //==============================================================================
 // Error Codes
 //==============================================================================
@@ -24,6 +34,9 @@
 #define I2C_ERR_TIMEOUT     -1
 #define I2C_ERR_NACK        -2
 #define I2C_ERR_BUSY        -3
+#define I2C_ERR_PARAM       -4
+#define I2C_ERR_PEC         -5
+#define I2C_ERR_DOWN        -6      // Slave marked down, bus not used
 
 //==============================================================================
 // Driver Functions
@@ -51,6 +64,66 @@ int i2c_write(uint8_t slave_addr, uint8_t data);
  */
 int i2c_read(uint8_t slave_addr, uint8_t *data);
 
+/**
+ * @brief Write several bytes to I2C slave in one transaction
+ * @param slave_addr 7-bit slave address
+ * @param data Bytes to write
+ * @param len Number of bytes (1 to I2C_FIFO_DEPTH + 1)
+ * @return 0 on success, negative error code on failure
+ */
+int i2c_write_bytes(uint8_t slave_addr, const uint8_t *data, uint8_t len);
+
+/**
+ * @brief Read several bytes from I2C slave in one transaction
+ * @param slave_addr 7-bit slave address
+ * @param data Buffer for received bytes
+ * @param len Number of bytes (1 to I2C_FIFO_DEPTH)
+ * @return 0 on success, negative error code on failure
+ */
+int i2c_read_bytes(uint8_t slave_addr, uint8_t *data, uint8_t len);
+
+/**
+ * @brief Write with SMBus PEC appended by hardware
+ * @param slave_addr 7-bit slave address
+ * @param data Bytes to write (PEC not included)
+ * @param len Number of bytes (1 to I2C_FIFO_DEPTH + 1)
+ * @return 0 on success, negative error code on failure
+ */
+int i2c_write_bytes_pec(uint8_t slave_addr, const uint8_t *data, uint8_t len);
+
+/**
+ * @brief Read with SMBus PEC checked by hardware
+ * @param slave_addr 7-bit slave address
+ * @param data Buffer for received bytes (PEC not included)
+ * @param len Number of bytes (1 to I2C_FIFO_DEPTH)
+ * @return 0 on success, I2C_ERR_PEC on mismatch, other negative codes on failure
+ */
+int i2c_read_bytes_pec(uint8_t slave_addr, uint8_t *data, uint8_t len);
+
+/**
+ * @brief General call write: one data byte per selected device
+ * @param devices I2C_GC_DEV_* mask
+ * @param data One byte per set bit, LED first
+ * @param stage 0 = update at STOP, 1 = stage only (see i2c_gc_latch)
+ * @return 0 on success, negative error code on failure
+ */
+int i2c_gc_write(uint8_t devices, const uint8_t *data, int stage);
+
+/**
+ * @brief General call "latch now": staged values go live in the same cycle
+ * @param devices I2C_GC_DEV_* mask
+ * @return 0 on success, negative error code on failure
+ */
+int i2c_gc_latch(uint8_t devices);
+
+/**
+ * @brief Update LED and FND together (one general-call transaction)
+ * @param led_value LED pattern (8 bits)
+ * @param digit Hex digit to display (0x00-0x0F)
+ * @return 0 on success, negative error code on failure
+ */
+int i2c_write_led_fnd(uint8_t led_value, uint8_t digit);
+
 /**
  * @brief Write to LED slave (convenience function)
  * @param value LED pattern (8 bits)
@@ -72,4 +145,458 @@ int i2c_write_fnd(uint8_t digit);
  */
 int i2c_read_switch(uint8_t *value);
 
+/**
+ * @brief Core clock cycles from the end of the last CONTROL transaction
+ *        (hardware stamp) to this call; call right after a driver function
+ *        returns to measure its completion-to-return latency
+ * @return Cycles, including the register reads of this call
+ */
+uint32_t i2c_done_latency(void);
+
+//==============================================================================
+// Shadow Cache (write-only LED / FND: drop repeats, merge updates)
+//==============================================================================
+
+typedef struct {
+    uint32_t hits;          // Update equal to the device / staged value, dropped
+    uint32_t misses;        // Update that changes the value
+    uint32_t suppressed;    // Staged values replaced before they reached the bus
+    uint32_t transfers;     // Bus transactions issued by flushes
+} i2c_cache_stats_t;
+
+/**
+ * @brief Update LED or FND through the shadow cache
+ *
+ * Equal values are dropped. Changed values are staged and written by the
+ * next flush: at once with a zero window, else by i2c_cache_poll once the
+ * window has passed. LED and FND staged together go out as one general
+ * call transaction.
+ *
+ * Every driver write keeps the shadow current: blocking, port and async
+ * writes to LED / FND and general call WRITEs record the ACKed value;
+ * latches, i2c_transfer and window stores (not decoded), failed writes and
+ * queued async writes mark it unknown, so the next update goes out.
+ *
+ * @param slave_addr I2C_ADDR_LED or I2C_ADDR_FND (digit, 0x00-0x0F)
+ * @param value New value
+ * @return 0 on success, negative error code if a flush failed
+ */
+int i2c_cache_write(uint8_t slave_addr, uint8_t value);
+
+/**
+ * @brief Check an update against the shadow without writing (async callers)
+ *
+ * For writers that go through i2c_submit: the submitted write marks the
+ * value unknown until it is done, then the ACKed value is recorded.
+ *
+ * @param slave_addr Device address (others always need the write)
+ * @param value New value
+ * @return 1 if the device may not hold value (write it), 0 = drop (hit)
+ */
+int i2c_cache_needed(uint8_t slave_addr, uint8_t value);
+
+/**
+ * @brief Set the flush window (time from the first staged update)
+ * @param window_us Microseconds, 0 = write through (default)
+ */
+void i2c_cache_set_window(uint32_t window_us);
+
+/**
+ * @brief Flush staged values whose window has passed (call periodically)
+ * @return 0 on success, negative error code if the flush failed
+ */
+int i2c_cache_poll(void);
+
+/**
+ * @brief Write all staged values now
+ * @return 0 on success, negative error code on failure (values stay staged)
+ */
+int i2c_cache_flush(void);
+
+/**
+ * @brief Forget the shadow values (devices reset or written elsewhere)
+ */
+void i2c_cache_invalidate(void);
+
+/**
+ * @brief Read the cache counters
+ * @param stats Counters
+ * @param clear 1 = reset the counters after reading
+ */
+void i2c_cache_get_stats(i2c_cache_stats_t *stats, int clear);
+
+//==============================================================================
+// Slave Health (fail fast on absent devices, re-probe with backoff)
+//==============================================================================
+#define I2C_HEALTH_SLOTS        8       // Failing addresses tracked at once
+#define I2C_HEALTH_THRESHOLD    3       // Consecutive failures to mark down
+#define I2C_HEALTH_BACKOFF_MIN  10000   // First re-probe interval (us)
+#define I2C_HEALTH_BACKOFF_MAX  2000000 // Re-probe interval cap (us)
+
+#define I2C_HEALTH_UP           0       // No recent failure
+#define I2C_HEALTH_SUSPECT      1       // Failing, below the threshold
+#define I2C_HEALTH_DOWN         2       // Calls fail fast with I2C_ERR_DOWN
+
+typedef struct {
+    uint8_t  state;         // I2C_HEALTH_*
+    uint8_t  fails;         // Consecutive address NACKs / timeouts
+    uint32_t backoff_us;    // Current re-probe interval (DOWN)
+    uint32_t retry_us;      // Time left to the next re-probe (DOWN)
+    uint32_t fast_fails;    // Calls refused without bus traffic
+    uint32_t probes;        // Re-probes sent
+} i2c_health_t;
+
+/**
+ * @brief Health of a slave address
+ *
+ * CONTROL path transactions (blocking, i2c_transfer, async) count address
+ * NACKs and timeouts per address; any success clears the count. A NACK is
+ * followed by an address-only probe (queued ahead of the next async
+ * request): if the address ACKs, the slave only refused a data byte and
+ * is not counted. i2c_train_speed leaves the table alone. At the
+ * threshold the address is down: calls return I2C_ERR_DOWN at once
+ * instead of NACKing or waiting for the timeout. When the backoff has
+ * passed, the next blocking call probes the address first (the next async
+ * request is itself the probe); a failed probe doubles the backoff up to
+ * the cap. An ACK from i2c_probe marks the address up.
+ *
+ * @param slave_addr 7-bit address
+ * @param health State and counters
+ * @return 0 on success, I2C_ERR_PARAM on a bad argument
+ */
+int i2c_health_get(uint8_t slave_addr, i2c_health_t *health);
+
+/**
+ * @brief Set the down threshold and backoff range
+ * @param threshold Consecutive failures to mark down (0 = tracking off)
+ * @param min_us First re-probe interval
+ * @param max_us Interval cap (raised to min_us if lower)
+ */
+void i2c_health_set_policy(uint8_t threshold, uint32_t min_us, uint32_t max_us);
+
+/**
+ * @brief Mark an address up again (board replaced)
+ * @param slave_addr 7-bit address, 0xFF = all
+ */
+void i2c_health_reset(uint8_t slave_addr);
+
+//==============================================================================
+// Message Transfers (Linux i2c_msg style, repeated START within an address)
+//==============================================================================
+#define I2C_M_RD            0x0001  // Read message (else write)
+#define I2C_M_NOSTART       0x4000  // Write continues the previous write, no Sr
+
+struct i2c_msg {
+    uint16_t addr;          // 7-bit slave address
+    uint16_t flags;         // I2C_M_*
+    uint16_t len;           // Bytes (0 = address-only write)
+    uint8_t *buf;           // Data to write / buffer to read into
+};
+
+/**
+ * @brief Run a message array as one combined transfer
+ *
+ * Messages to the same address as the previous one follow with a repeated
+ * START; an address change ends with STOP. A write and its I2C_M_NOSTART
+ * continuations are one CONTROL transaction fed from the TX FIFO, a read
+ * drains the RX FIFO. All messages are checked before the first START:
+ * up to I2C_FIFO_DEPTH + 1 bytes per write transaction, 1 to
+ * I2C_FIFO_DEPTH bytes per read.
+ *
+ * @param msgs Messages
+ * @param n Number of messages (1 or more)
+ * @return n on success, negative error code on failure (bus released)
+ */
+int i2c_transfer(const struct i2c_msg *msgs, int n);
+
+//==============================================================================
+// Link Test (PRBS write / read-back at several SCL speeds)
+//==============================================================================
+#define I2C_ADDR_EEPROM     0x50    // Loopback slave on the slave board
+
+typedef struct {
+    uint32_t scl_hz;        // Nominal SCL frequency (0 = speed skipped)
+    uint32_t bytes;         // Bytes read back and compared
+    uint32_t bit_errors;    // Bits that differed
+    uint16_t nacks;         // NACKed transactions
+    uint16_t retries;       // Retried transactions
+    uint32_t cycles;        // Core clock cycles spent at this speed
+    uint32_t throughput;    // Payload bit/s (bytes * 8 / time)
+} i2c_link_result_t;
+
+/**
+ * @brief Characterize the cable: PRBS blocks at up to 4 SCL speeds
+ * @param scl_hz SCL frequencies to test in order (0 = skip), 4 entries
+ * @param blocks 8-byte blocks per speed (1 to 32 keeps within the EEPROM)
+ * @param res Results per speed, 4 entries
+ * @param timeout_us Timeout in microseconds (0 = no timeout)
+ * @return 0 on success, negative error code on failure
+ */
+int i2c_link_test(const uint32_t *scl_hz, uint8_t blocks,
+                  i2c_link_result_t *res, uint32_t timeout_us);
+
+//==============================================================================
+// Device Discovery (address-only probes, no data byte, no side effects)
+//==============================================================================
+
+/**
+ * @brief Check whether a slave ACKs its address (SMBus quick write)
+ * @param slave_addr 7-bit slave address
+ * @return 0 if present, I2C_ERR_NACK if not, other negative codes on failure
+ */
+int i2c_probe(uint8_t slave_addr);
+
+/**
+ * @brief Probe an address range in hardware and return a presence bitmap
+ * @param first First address (inclusive)
+ * @param last Last address (inclusive, >= first)
+ * @param map Bitmap, 4 words: bit (addr % 32) of map[addr / 32] = present
+ * @param timeout_us Timeout in microseconds (0 = no timeout)
+ * @return 0 on success, negative error code on failure
+ */
+int i2c_scan(uint8_t first, uint8_t last, uint32_t map[4], uint32_t timeout_us);
+
+/**
+ * @brief Test one bit of an i2c_scan bitmap
+ */
+static inline int i2c_scan_present(const uint32_t map[4], uint8_t addr) {
+    return (map[(addr >> 5) & 3] >> (addr & 31)) & 1;
+}
+
+//==============================================================================
+// Per-Slave Bus Speed (speed table in the AXI IP)
+//==============================================================================
+
+/**
+ * @brief Probe used by i2c_train_speed at each candidate speed
+ * @param slave_addr 7-bit slave address
+ * @return 0 if the slave answered correctly, negative error code otherwise
+ */
+typedef int (*i2c_probe_fn)(uint8_t slave_addr);
+
+#define I2C_TRAIN_TRIES     8       // Probes that must all pass per speed
+
+/**
+ * @brief Set the SCL frequency used for one slave address
+ * @param slave_addr 7-bit slave address
+ * @param scl_hz SCL frequency (98 kHz to 25 MHz), 0 = IP default (I2C_SCL_FREQ)
+ * @return 0 on success, negative error code on failure
+ */
+int i2c_set_speed(uint8_t slave_addr, uint32_t scl_hz);
+
+/**
+ * @brief Get the SCL frequency programmed for one slave address
+ * @param slave_addr 7-bit slave address
+ * @return SCL frequency in Hz, 0 = IP default
+ */
+uint32_t i2c_get_speed(uint8_t slave_addr);
+
+/**
+ * @brief Find the fastest speed a slave handles reliably and store it
+ *
+ * Tries 1 MHz, 400 kHz, then 100 kHz; a speed passes when I2C_TRAIN_TRIES
+ * probes in a row succeed. The first passing speed is kept in the table.
+ *
+ * @param slave_addr 7-bit slave address
+ * @param probe Probe function, NULL = single-byte reads that must ACK and
+ *              return the same value (read-capable slaves only)
+ * @param scl_hz Selected frequency (may be NULL)
+ * @return 0 on success, I2C_ERR_NACK if no speed passed (entry reset to default)
+ */
+int i2c_train_speed(uint8_t slave_addr, i2c_probe_fn probe, uint32_t *scl_hz);
+
+//==============================================================================
+// Register Window (slave registers as memory, second AXI address range)
+//==============================================================================
+
+/**
+ * @brief Set the base address of the register window (S01_AXI)
+ * @param win_base_addr Base address of the window range (from Vivado)
+ */
+void i2c_window_init(uint32_t win_base_addr);
+
+/**
+ * @brief Choose whether window stores are posted
+ * @param posted 0 = a store returns after the I2C write, 1 = right away
+ * @return 0 on success, negative error code on failure
+ */
+int i2c_window_set_posted(int posted);
+
+/**
+ * @brief Read one slave register through the window (pointer write, Sr, read)
+ * @param slave_addr 7-bit slave address
+ * @param reg Register / word address
+ * @param data Pointer to store the register value
+ * @return 0 on success, I2C_ERR_NACK if the slave did not answer
+ */
+int i2c_window_read(uint8_t slave_addr, uint8_t reg, uint8_t *data);
+
+/**
+ * @brief Write one slave register through the window
+ *
+ * Posted stores return before the byte is on the bus; their NACKs are
+ * collected by i2c_window_error.
+ *
+ * @param slave_addr 7-bit slave address
+ * @param reg Register / word address
+ * @param data Register value
+ * @return 0 on success, I2C_ERR_NACK if a stalling store was NACKed
+ */
+int i2c_window_write(uint8_t slave_addr, uint8_t reg, uint8_t data);
+
+/**
+ * @brief Check and clear the window store NACK flag
+ * @return 0 if no store was NACKed since the last call, I2C_ERR_NACK otherwise
+ */
+int i2c_window_error(void);
+
+//==============================================================================
+// Command Ports (each CPU / engine uses its own port, no software mutex)
+//==============================================================================
+
+/**
+ * @brief Write one or two bytes through a command port and wait
+ * @param port Command port (0 to I2C_PORTS - 1)
+ * @param slave_addr 7-bit slave address
+ * @param data Bytes to write
+ * @param len Number of bytes (1 or 2)
+ * @return 0 on success, I2C_ERR_BUSY if the port still has a command,
+ *         other negative codes on failure
+ */
+int i2c_port_write(uint8_t port, uint8_t slave_addr, const uint8_t *data, uint8_t len);
+
+/**
+ * @brief Read one byte through a command port and wait
+ * @param port Command port (0 to I2C_PORTS - 1)
+ * @param slave_addr 7-bit slave address
+ * @param data Pointer to store received byte (0xFF on NACK)
+ * @return 0 on success, negative error code on failure
+ */
+int i2c_port_read(uint8_t port, uint8_t slave_addr, uint8_t *data);
+
+/**
+ * @brief Wait for the command of a port to finish
+ * @param port Command port (0 to I2C_PORTS - 1)
+ * @param data Pointer to store the received byte (NULL = ignore)
+ * @param timeout_us Timeout in microseconds (0 = infinite)
+ * @return 0 on success, I2C_ERR_NACK on NACK, I2C_ERR_TIMEOUT on timeout
+ */
+int i2c_port_wait(uint8_t port, uint8_t *data, uint32_t timeout_us);
+
+/**
+ * @brief Set the arbiter priority of a requester
+ * @param requester I2C_ARB_CONTROL, I2C_ARB_WINDOW or I2C_ARB_PORT(n)
+ * @param prio 0 (lowest) to I2C_ARB_PRIO_MAX; equal priorities take turns
+ * @return 0 on success, negative error code on failure
+ */
+int i2c_set_priority(uint8_t requester, uint8_t prio);
+
+//==============================================================================
+// Asynchronous Transfers (CONTROL path, fixed request pool, no heap)
+//==============================================================================
+#define I2C_ASYNC_SLOTS     8       // Requests queued or running at once
+
+#define I2C_OP_PEC          (1 << 0)    // Append / check SMBus PEC
+#define I2C_OP_PROBE        (1 << 1)    // Address only (len ignored)
+
+typedef struct {
+    uint8_t        addr;    // 7-bit slave address
+    uint8_t        rw;      // 0 = write, 1 = read
+    uint8_t        len;     // Write: 1 to I2C_FIFO_DEPTH + 1, read: 1 to I2C_FIFO_DEPTH
+    uint8_t        flags;   // I2C_OP_*
+    const uint8_t *tx;      // Write bytes (must stay valid until completion)
+    uint8_t       *rx;      // Read buffer (filled before the callback)
+} i2c_op_t;
+
+/**
+ * @brief Completion callback, called from i2c_poll
+ * @param handle Handle returned by i2c_submit
+ * @param result I2C_SUCCESS or a negative error code
+ * @param ctx Context pointer given to i2c_submit
+ */
+typedef void (*i2c_callback_t)(int handle, int result, void *ctx);
+
+// Interrupt mode: i2c_poll runs in an ISR (timer tick), so i2c_submit and
+// i2c_cancel mask that interrupt around the queue update. Define both
+// before including this header, e.g.
+//   #define I2C_ASYNC_LOCK()     (microblaze_disable_interrupts(), 0u)
+//   #define I2C_ASYNC_UNLOCK(s)  microblaze_enable_interrupts()
+#ifndef I2C_ASYNC_LOCK
+#define I2C_ASYNC_LOCK()        0u
+#define I2C_ASYNC_UNLOCK(s)     ((void)(s))
+#endif
+
+/**
+ * @brief Queue a transaction; it starts from i2c_poll in submit order
+ *
+ * The op is copied, its tx / rx buffers are not. Blocking calls on the
+ * CONTROL path return I2C_ERR_BUSY while an async request is running.
+ *
+ * @param op Transaction
+ * @param cb Completion callback (NULL = none)
+ * @param ctx Passed to cb
+ * @return Handle (>= 0), I2C_ERR_BUSY if the pool is full, I2C_ERR_PARAM
+ */
+int i2c_submit(const i2c_op_t *op, i2c_callback_t cb, void *ctx);
+
+/**
+ * @brief Advance the queue: finish the running request, start the next
+ *
+ * Never waits. Call it from the main loop (polled mode) or from a
+ * periodic interrupt (interrupt mode, see I2C_ASYNC_LOCK). A request
+ * still on the bus 10 ms after it started (same deadline as the blocking
+ * calls) is aborted and completes with I2C_ERR_TIMEOUT.
+ *
+ * @return Requests still queued or running, negative error code on failure
+ */
+int i2c_poll(void);
+
+/**
+ * @brief Remove a request (its callback is not called)
+ *
+ * A request already on the bus is aborted (STATUS abort: lines released,
+ * no STOP); a write leaves the device value unknown to the shadow cache.
+ *
+ * @param handle Handle returned by i2c_submit
+ * @return 0 on success, I2C_ERR_PARAM if the handle is unknown or finished
+ */
+int i2c_cancel(int handle);
+
+//==============================================================================
+// SPI Transport (slave_register_map over spi_slave_protocol)
+//==============================================================================
+
+/**
+ * @brief Set the SPI SCK half period used by spi_reg_write/spi_reg_read
+ * @param clk_div Half period in core clock cycles (SPI_DIV_MIN or more)
+ * @return 0 on success, negative error code on failure
+ */
+int spi_set_clk_div(uint8_t clk_div);
+
+/**
+ * @brief Set when the I2C master samples SDA (ACK and read bits)
+ * @param clks Core clock cycles after SCL rises, I2C_SAMPLE_DEFAULT = middle
+ *             of the first high quarter; later points tolerate slow edges
+ * @return 0 on success, negative error code on failure
+ */
+int i2c_set_sample_point(uint8_t clks);
+
+/**
+ * @brief Burst write to slave_register_map over SPI
+ * @param reg First register (auto-increments)
+ * @param data Bytes to write
+ * @param len Number of bytes (1 to I2C_FIFO_DEPTH)
+ * @return 0 on success, negative error code on failure
+ */
+int spi_reg_write(uint8_t reg, const uint8_t *data, uint8_t len);
+
+/**
+ * @brief Burst read from slave_register_map over SPI
+ * @param reg First register (auto-increments)
+ * @param data Buffer for received bytes
+ * @param len Number of bytes (1 to I2C_FIFO_DEPTH)
+ * @return 0 on success, negative error code on failure
+ */
+int spi_reg_read(uint8_t reg, uint8_t *data, uint8_t len);
+
 #endif // I2C_DRIVER_H
@@ -0,0 +1,263 @@
+/**
+ * @file i2c_driver.hpp
+ * @brief Header-only C++17 driver for the AXI I2C Master IP
+ *
+ * Same register map as i2c_regs.h, but the base address, register access
+ * rights and slave capabilities are template parameters:
+ *  - every register access is one volatile load / store at a constant
+ *    address (no i2c_base pointer, no NULL check)
+ *  - writing a read-only register, reading the LED or writing the switch
+ *    does not compile
+ *  - bits outside a device's mask are dropped on every byte written
+ *  - with -DI2C_HOST_MOCK accesses go to the host model instead (MMIO /
+ *    poll counts, firmware/host/bench_hpp.cpp)
+ *
+ * @code
+ *   using bus = i2c::master<0x44A00000>;
+ *   bus::write<i2c::led>(0xA5);
+ *   uint8_t sw;
+ *   if (bus::read<i2c::sw>(sw) == i2c::SUCCESS) bus::write<i2c::fnd>(sw);
+ * @endcode
+ */
+
+#ifndef I2C_DRIVER_HPP
+#define I2C_DRIVER_HPP
+
+#include <stdint.h>
+#include "i2c_regs.h"
+
+namespace i2c {
+
+//==============================================================================
+// Error Codes (same values as i2c_driver.h)
+//==============================================================================
+enum : int {
+    SUCCESS     = 0,
+    ERR_TIMEOUT = -1,
+    ERR_NACK    = -2,
+    ERR_BUSY    = -3,
+    ERR_PARAM   = -4,
+    ERR_PEC     = -5,
+    ERR_DOWN    = -6        // Not returned here (no health tracking)
+};
+
+//==============================================================================
+// Register Descriptors
+//==============================================================================
+enum class access : uint8_t { ro, wo, rw };
+
+template <uint32_t Offset, access Access>
+struct reg {
+    static constexpr uint32_t offset   = Offset;
+    static constexpr bool     readable = Access != access::wo;
+    static constexpr bool     writable = Access != access::ro;
+};
+
+namespace regs {
+    using control    = reg<I2C_REG_CONTROL,    access::rw>;   // Write starts
+    using status     = reg<I2C_REG_STATUS,     access::rw>;   // Write: release / clear
+    using rx_data    = reg<I2C_REG_RX_DATA,    access::ro>;
+    using tx_fifo    = reg<I2C_REG_TX_FIFO,    access::wo>;
+    using rx_fifo    = reg<I2C_REG_RX_FIFO,    access::ro>;   // Read pops
+    using config     = reg<I2C_REG_CONFIG,     access::rw>;
+    using ticks      = reg<I2C_REG_TICKS,      access::ro>;
+    using done_ticks = reg<I2C_REG_DONE_TICKS, access::ro>;
+
+    template <unsigned N>
+    using port = reg<I2C_REG_PORT(N), access::rw>;            // Write = command
+}
+
+//==============================================================================
+// Slave Descriptors
+//==============================================================================
+template <uint8_t Addr, bool Readable, bool Writable, uint8_t Mask = 0xFF>
+struct device {
+    static_assert(Addr < 0x80, "7-bit slave address");
+
+    static constexpr uint8_t addr     = Addr;
+    static constexpr bool    readable = Readable;
+    static constexpr bool    writable = Writable;
+    static constexpr uint8_t mask     = Mask;   // Bits the slave uses
+};
+
+using led    = device<I2C_ADDR_LED,    false, true>;
+using fnd    = device<I2C_ADDR_FND,    false, true, 0x0F>;   // Digit 0-F
+using sw     = device<I2C_ADDR_SWITCH, true,  false>;
+using eeprom = device<0x50,            true,  true>;
+
+// General call command byte: opcode | device mask
+namespace gc {
+    constexpr uint8_t op_write = 0x10;      // Data -> devices, update at STOP
+    constexpr uint8_t dev_led  = 1 << 0;
+    constexpr uint8_t dev_fnd  = 1 << 1;
+}
+
+//==============================================================================
+// Master
+//==============================================================================
+
+/**
+ * @tparam Base  Base address of the S00_AXI range (from Vivado)
+ * @tparam ClkHz I2C core clock (timeouts count TICKS in this clock)
+ */
+template <uintptr_t Base, uint32_t ClkHz = I2C_CORE_CLK_HZ>
+class master {
+public:
+    static constexpr uint32_t timeout_us = 10000;     // Per transaction
+
+    //--------------------------------------------------------------------------
+    // Register access
+    //--------------------------------------------------------------------------
+    template <class Reg>
+    static uint32_t load() {
+        static_assert(Reg::readable, "register is write-only");
+#ifdef I2C_HOST_MOCK
+        return i2c_mock_read(Reg::offset);
+#else
+        return *reinterpret_cast<volatile uint32_t *>(Base + Reg::offset);
+#endif
+    }
+
+    template <class Reg>
+    static void store(uint32_t value) {
+        static_assert(Reg::writable, "register is read-only");
+#ifdef I2C_HOST_MOCK
+        i2c_mock_write(Reg::offset, value);
+#else
+        *reinterpret_cast<volatile uint32_t *>(Base + Reg::offset) = value;
+#endif
+    }
+
+    static bool busy() {
+        return (load<regs::status>() & I2C_STAT_BUSY) != 0;
+    }
+
+    /**
+     * @brief Tight-poll STATUS until the CONTROL transaction finishes
+     * @return SUCCESS, ERR_TIMEOUT
+     */
+    static int wait_done(uint32_t us = timeout_us) {
+        const uint32_t start = load<regs::ticks>();
+        const uint32_t limit = us * (ClkHz / 1000000u);
+
+        while (busy()) {
+            if (load<regs::ticks>() - start >= limit) {
+                // The last poll may have raced the deadline
+                return busy() ? ERR_TIMEOUT : SUCCESS;
+            }
+        }
+        return SUCCESS;
+    }
+
+    //--------------------------------------------------------------------------
+    // Device access
+    //--------------------------------------------------------------------------
+
+    /**
+     * @brief Write one byte (bits outside Dev::mask are dropped)
+     * @return SUCCESS, ERR_BUSY, ERR_TIMEOUT, ERR_NACK
+     */
+    template <class Dev>
+    static int write(uint8_t data) {
+        static_assert(Dev::writable, "device is read-only");
+        return start(I2C_CTRL(Dev::addr, 0, data & Dev::mask, 1));
+    }
+
+    /**
+     * @brief Read one byte
+     * @return SUCCESS, ERR_BUSY, ERR_TIMEOUT, ERR_NACK
+     */
+    template <class Dev>
+    static int read(uint8_t &data) {
+        static_assert(Dev::readable, "device is write-only");
+        int result = start(I2C_CTRL(Dev::addr, 1, 0, 1));
+        if (result == SUCCESS) {
+            data = static_cast<uint8_t>(load<regs::rx_data>());
+        }
+        return result;
+    }
+
+    /**
+     * @brief Write Len bytes in one transaction (length checked at compile
+     *        time, bits outside Dev::mask dropped from every byte)
+     */
+    template <class Dev, uint8_t Len>
+    static int write(const uint8_t (&data)[Len]) {
+        static_assert(Dev::writable, "device is read-only");
+        static_assert(Len >= 1 && Len <= I2C_FIFO_DEPTH + 1, "1..FIFO+1 bytes");
+
+        if (busy()) {
+            return ERR_BUSY;
+        }
+        // Bytes 2..Len go through the TX FIFO, byte 1 rides in CONTROL
+        for (uint8_t i = 1; i < Len; i++) {
+            store<regs::tx_fifo>(data[i] & Dev::mask);
+        }
+        store<regs::control>(I2C_CTRL(Dev::addr, 0, data[0] & Dev::mask, Len));
+        return finish();
+    }
+
+    /**
+     * @brief Read Len bytes in one transaction (length checked at compile time)
+     */
+    template <class Dev, uint8_t Len>
+    static int read(uint8_t (&data)[Len]) {
+        static_assert(Dev::readable, "device is write-only");
+        static_assert(Len >= 1 && Len <= I2C_FIFO_DEPTH, "1..FIFO bytes");
+
+        int result = start(I2C_CTRL(Dev::addr, 1, 0, Len));
+        if (result == SUCCESS) {
+            for (uint8_t i = 0; i < Len; i++) {
+                data[i] = static_cast<uint8_t>(load<regs::rx_fifo>());
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief LED and FND in one general call (both update at STOP)
+     */
+    static int write_led_fnd(uint8_t led_value, uint8_t digit) {
+        if (busy()) {
+            return ERR_BUSY;
+        }
+        store<regs::tx_fifo>(led_value);
+        store<regs::tx_fifo>(digit & fnd::mask);
+        store<regs::control>(I2C_CTRL(I2C_ADDR_GENERAL_CALL, 0,
+                                      gc::op_write | gc::dev_led | gc::dev_fnd, 3));
+        return finish();
+    }
+
+    /**
+     * @brief Core clock cycles since the last CONTROL transaction finished
+     */
+    static uint32_t done_latency() {
+        const uint32_t done = load<regs::done_ticks>();
+        return load<regs::ticks>() - done;
+    }
+
+private:
+    static int start(uint32_t control) {
+        if (busy()) {
+            return ERR_BUSY;
+        }
+        store<regs::control>(control);
+        return finish();
+    }
+
+    static int finish() {
+        int result = wait_done();
+        if (result != SUCCESS) {
+            return result;
+        }
+        const uint32_t stat = load<regs::status>();
+        if (stat & I2C_STAT_TIMEOUT) {
+            return ERR_TIMEOUT;             // SCL stretched past the limit
+        }
+        return (stat & I2C_STAT_ACK_ERROR) ? ERR_NACK : SUCCESS;
+    }
+};
+
+} // namespace i2c
+
+#endif // I2C_DRIVER_HPP
@@ -11,29 +11,176 @@
 
 #include <stdint.h>
 
+// I2C core clock (I2C_CLK_FREQ of the IP): SCL quarters, SPI dividers and
+// link test cycles count in this clock, not in the AXI clock
+#ifndef I2C_CORE_CLK_HZ
+#define I2C_CORE_CLK_HZ     100000000UL
+#endif
+
 //==============================================================================
 // Register Offsets (relative to base address)
 //==============================================================================
 
-// Control/Status Registers
-#define I2C_REG_CONTROL     0x00    // Control register
+// Matches i2c_master_v1_0_S00_AXI.v
+#define I2C_REG_CONTROL     0x00    // Control register (write starts transaction)
 #define I2C_REG_STATUS      0x04    // Status register
-#define I2C_REG_SLAVE_ADDR  0x08    // 7-bit slave address + R/W bit
-#define I2C_REG_TX_DATA     0x0C    // Transmit data register
-#define I2C_REG_RX_DATA     0x10    // Receive data register
+#define I2C_REG_RX_DATA     0x08    // Last received byte
+#define I2C_REG_TX_FIFO     0x0C    // TX FIFO push (bytes 2..n of a write)
+#define I2C_REG_RX_FIFO     0x10    // RX FIFO pop (bytes of a read)
+#define I2C_REG_CONFIG      0x14    // Transport select / SPI clock
+#define I2C_REG_LINK_CTRL   0x18    // Link test start / address / blocks / result select
+#define I2C_REG_LINK_SPEEDS 0x1C    // Link test SCL quarter periods, one byte per speed
+#define I2C_REG_LINK_BYTES  0x20    // Selected speed: bytes verified
+#define I2C_REG_LINK_BITERR 0x24    // Selected speed: bit errors
+#define I2C_REG_LINK_NACK   0x28    // Selected speed: [15:0] NACKs, [31:16] retries
+#define I2C_REG_LINK_CYCLES 0x2C    // Selected speed: core clock cycles spent
+#define I2C_REG_SPEED       0x30    // Per-address speed table entry
+#define I2C_REG_SCAN_CTRL   0x34    // Bus scan start / range
+#define I2C_REG_SCAN_MAP    0x38    // Presence bitmap, 4 words (0x38-0x44)
+#define I2C_REG_PORT(n)     (0x48 + 4 * (n))  // Command port n (0-3): write = command, read = status
+#define I2C_REG_ARB_PRIO    0x58    // Arbiter priority per requester
+#define I2C_REG_TICKS       0x5C    // Free-running core clock counter
+#define I2C_REG_DONE_TICKS  0x60    // I2C_REG_TICKS at the last CONTROL done
+
+#define I2C_FIFO_DEPTH      16
+
+//==============================================================================
+// Control Register Fields
+//==============================================================================
+#define I2C_CTRL_RW_BIT     (1 << 0)    // R/W bit: 0=Write, 1=Read
+#define I2C_CTRL_ADDR_SHIFT 1           // [7:1]   7-bit slave address
+#define I2C_CTRL_DATA_SHIFT 8           // [15:8]  first write byte
+#define I2C_CTRL_CNT_SHIFT  16          // [23:16] byte count (0/1 = single)
+#define I2C_CTRL_PEC        (1 << 24)   // Append / check SMBus PEC (CRC-8)
+#define I2C_CTRL_PROBE      (1 << 25)   // Address only: START-ADDR-ACK-STOP
+#define I2C_CTRL_HOLD       (1 << 26)   // No STOP: next CONTROL write is a repeated START
+
+#define I2C_CTRL(addr, rw, data, count) \
+    ((((uint32_t)(addr) & 0x7F) << I2C_CTRL_ADDR_SHIFT) | \
+     ((rw) ? I2C_CTRL_RW_BIT : 0) | \
+     (((uint32_t)(data) & 0xFF) << I2C_CTRL_DATA_SHIFT) | \
+     (((uint32_t)(count) & 0xFF) << I2C_CTRL_CNT_SHIFT))
+
+//==============================================================================
+// Config Register Fields (write only while idle)
+//==============================================================================
+#define I2C_CFG_SPI         (1 << 0)    // 0 = I2C, 1 = SPI (slave_register_map)
+#define I2C_CFG_WIN_POST    (1 << 1)    // Register window stores are posted
+#define I2C_CFG_DIV_SHIFT   8           // [15:8] SCK half period (clk cycles)
+#define I2C_CFG_SMP_SHIFT   16          // [23:16] SDA sample point (clk after SCL rise)
+
+#define I2C_CFG(spi, div, smp) \
+    (((spi) ? I2C_CFG_SPI : 0) | \
+     (((uint32_t)(div) & 0xFF) << I2C_CFG_DIV_SHIFT) | \
+     (((uint32_t)(smp) & 0xFF) << I2C_CFG_SMP_SHIFT))
+
+#define I2C_SAMPLE_DEFAULT  0           // Middle of the first SCL high quarter
+
+#define SPI_DIV_10MHZ       5           // 100 MHz core / (2 * 5)
+#define SPI_DIV_12M5HZ      4           // Fastest the SPI slave accepts
+#define SPI_DIV_MIN         4
 
 //==============================================================================
-// Control Register Bits
+// Link Test Registers (PRBS loopback against the EEPROM slave)
 //==============================================================================
-#define I2C_CTRL_START      (1 << 0)    // Start I2C transaction (write 1)
-#define I2C_CTRL_RW_BIT     (1 << 1)    // R/W bit: 0=Write, 1=Read
+#define I2C_LINK_START      (1 << 0)    // Write 1: start a test run
+#define I2C_LINK_ADDR_SHIFT 1           // [7:1]   loopback slave address
+#define I2C_LINK_BLK_SHIFT  8           // [15:8]  8-byte blocks per speed
+#define I2C_LINK_SEL_SHIFT  16          // [17:16] speed shown in the result registers
+#define I2C_LINK_BUSY       (1u << 31)  // Test run in progress (read)
+
+#define I2C_LINK_CTRL(addr, blocks, sel) \
+    ((((uint32_t)(addr) & 0x7F) << I2C_LINK_ADDR_SHIFT) | \
+     (((uint32_t)(blocks) & 0xFF) << I2C_LINK_BLK_SHIFT) | \
+     (((uint32_t)(sel) & 0x3) << I2C_LINK_SEL_SHIFT))
+
+//==============================================================================
+// Speed Table (consulted on every I2C transaction, 0 = I2C_SCL_FREQ)
+//==============================================================================
+#define I2C_SPEED_ADDR_SHIFT 8          // [14:8] slave address
+#define I2C_SPEED_Q_MASK    0xFF        // [7:0]  SCL quarter period (clk cycles)
+
+#define I2C_SPEED(addr, quarter) \
+    ((((uint32_t)(addr) & 0x7F) << I2C_SPEED_ADDR_SHIFT) | \
+     ((uint32_t)(quarter) & I2C_SPEED_Q_MASK))
+
+//==============================================================================
+// Bus Scan (address-only probes, no device state changes)
+//==============================================================================
+#define I2C_SCAN_START      (1 << 0)    // Write 1: start a scan
+#define I2C_SCAN_BUSY       (1 << 7)    // Scan in progress (read)
+#define I2C_SCAN_FIRST_SHIFT 8          // [14:8]  first address
+#define I2C_SCAN_LAST_SHIFT 16          // [22:16] last address
+
+#define I2C_SCAN_CTRL(first, last) \
+    ((((uint32_t)(first) & 0x7F) << I2C_SCAN_FIRST_SHIFT) | \
+     (((uint32_t)(last) & 0x7F) << I2C_SCAN_LAST_SHIFT))
+
+//==============================================================================
+// Register Window (second AXI interface, S01_AXI, 128 KB)
+//==============================================================================
+// One 32-bit word per slave register: a load is [ADDR+W][REG][Sr][ADDR+R]
+// [DATA], a store is [ADDR+W][REG][DATA]. Loads stall until the byte is
+// read; stores stall too unless I2C_CFG_WIN_POST is set.
+#define I2C_WIN_OFFSET(addr, reg) \
+    ((((uint32_t)(addr) & 0x7F) << 10) | (((uint32_t)(reg) & 0xFF) << 2))
+
+#define I2C_WIN_DATA_MASK   0xFF        // [7:0] register value
+#define I2C_WIN_NACK        (1 << 8)    // Load NACKed ([7:0] = 0xFF)
+
+//==============================================================================
+// Command Ports (independent requesters sharing the I2C master)
+//==============================================================================
+#define I2C_PORTS           4
+#define I2C_PORT_RW_BIT     (1 << 0)    // R/W bit: 0=Write, 1=Read (one byte)
+#define I2C_PORT_ADDR_SHIFT 1           // [7:1]   7-bit slave address
+#define I2C_PORT_CNT_SHIFT  8           // [9:8]   write bytes (0/1 = one, 2 = two)
+#define I2C_PORT_D0_SHIFT   16          // [23:16] first write byte
+#define I2C_PORT_D1_SHIFT   24          // [31:24] second write byte
+
+#define I2C_PORT_CMD(addr, rw, count, d0, d1) \
+    ((((uint32_t)(addr) & 0x7F) << I2C_PORT_ADDR_SHIFT) | \
+     ((rw) ? I2C_PORT_RW_BIT : 0) | \
+     (((uint32_t)(count) & 0x3) << I2C_PORT_CNT_SHIFT) | \
+     (((uint32_t)(d0) & 0xFF) << I2C_PORT_D0_SHIFT) | \
+     (((uint32_t)(d1) & 0xFF) << I2C_PORT_D1_SHIFT))
+
+#define I2C_PORT_RX_MASK    0xFF        // [7:0] received byte
+#define I2C_PORT_ACK_ERROR  (1 << 8)    // NACK received
+#define I2C_PORT_DONE       (1 << 9)    // Command finished
+#define I2C_PORT_OVERRUN    (1 << 10)   // Command written while pending, dropped
+#define I2C_PORT_RUNNING    (1 << 30)   // On the bus
+#define I2C_PORT_PENDING    (1u << 31)  // Waiting for the bus or running
+
+// Arbiter requesters: 2-bit priority each, 3 = highest, equal = round robin
+#define I2C_ARB_CONTROL     0           // CONTROL register transactions
+#define I2C_ARB_WINDOW      1           // Register window
+#define I2C_ARB_PORT(n)     (2 + (n))   // Command port n
+#define I2C_ARB_PRIO_MAX    3
+#define I2C_ARB_PRIO_RESET  0x555       // All requesters priority 1
+
+// SCL quarter period in core clock cycles (0 = skip this speed)
+#define I2C_QUARTER(scl_hz) ((uint8_t)(I2C_CORE_CLK_HZ / ((scl_hz) * 4UL)))
+#define I2C_LINK_SPEEDS_N   4
 
 //==============================================================================
 // Status Register Bits
 //==============================================================================
-#define I2C_STAT_BUSY       (1 << 0)    // Transaction in progress
+#define I2C_STAT_BUSY       (1 << 0)    // CONTROL transaction / test / scan in progress
 #define I2C_STAT_DONE       (1 << 1)    // Transaction completed
 #define I2C_STAT_ACK_ERROR  (1 << 2)    // NACK received or error
+#define I2C_STAT_TX_FULL    (1 << 3)    // TX FIFO full
+#define I2C_STAT_RX_EMPTY   (1 << 4)    // RX FIFO empty
+#define I2C_STAT_PEC_ERROR  (1 << 5)    // Read PEC mismatch
+#define I2C_STAT_WIN_ERROR  (1 << 6)    // Window store NACKed (write 1 to clear)
+#define I2C_STAT_BUS_BUSY   (1 << 7)    // Any requester or engine on the bus
+#define I2C_STAT_HELD       (1 << 24)   // CONTROL hold done, bus kept for Sr
+#define I2C_STAT_TIMEOUT    (1 << 25)   // SCL stretched too long, dropped (with ACK_ERROR)
+#define I2C_STAT_RELEASE    (1 << 0)    // Write 1: STOP a held bus
+#define I2C_STAT_ABORT      (1 << 25)   // Write 1: drop the CONTROL transaction
+
+#define I2C_STAT_TX_LEVEL(s)  (((s) >> 8) & 0xFF)
+#define I2C_STAT_RX_LEVEL(s)  (((s) >> 16) & 0xFF)
 
 //==============================================================================
 // I2C Slave Addresses
@@ -41,6 +188,7 @@
 #define I2C_ADDR_LED        0x55    // LED Slave
 #define I2C_ADDR_FND        0x56    // 7-Segment Display Slave
 #define I2C_ADDR_SWITCH     0x57    // Switch Slave
+#define I2C_ADDR_GENERAL_CALL 0x00  // General call (LED + FND)
 
 //==============================================================================
 // Register Access Macros
@@ -50,6 +198,33 @@
 // Example: #define I2C_BASE_ADDR 0x44A00000
 extern volatile uint32_t* i2c_base;
 
+// Register window base (second address range of the IP, set by Vivado)
+extern volatile uint32_t* i2c_win_base;
+
+#ifdef I2C_HOST_MOCK
+
+// Host build: accesses go to the simulated IP (firmware/host/i2c_mock.c)
+#ifdef __cplusplus
+extern "C" {
+#endif
+uint32_t i2c_mock_read(uint32_t offset);
+void     i2c_mock_write(uint32_t offset, uint32_t value);
+void     i2c_mock_write8(uint32_t offset, uint8_t value);
+uint32_t i2c_mock_win_read(uint32_t offset);
+void     i2c_mock_win_write(uint32_t offset, uint32_t value);
+#ifdef __cplusplus
+}
+#endif
+
+#define I2C_WRITE_REG(offset, value)    i2c_mock_write((offset), (value))
+#define I2C_READ_REG(offset)            i2c_mock_read(offset)
+#define I2C_WRITE_REG8(offset, value)   i2c_mock_write8((offset), (value))
+#define I2C_WIN_READ(addr, reg)         i2c_mock_win_read(I2C_WIN_OFFSET(addr, reg))
+#define I2C_WIN_WRITE(addr, reg, value) \
+    i2c_mock_win_write(I2C_WIN_OFFSET(addr, reg), (value))
+
+#else
+
 // Write to register
 #define I2C_WRITE_REG(offset, value) \
     (*(volatile uint32_t*)((uint8_t*)i2c_base + (offset)) = (value))
@@ -58,6 +233,18 @@ extern volatile uint32_t* i2c_base;
 #define I2C_READ_REG(offset) \
     (*(volatile uint32_t*)((uint8_t*)i2c_base + (offset)))
 
+// Write one byte lane of a register (the other lanes keep their value)
+#define I2C_WRITE_REG8(offset, value) \
+    (*((volatile uint8_t*)i2c_base + (offset)) = (value))
+
+// Slave register through the window (load = I2C read, store = I2C write)
+#define I2C_WIN_REG(addr, reg) \
+    (*(volatile uint32_t*)((uint8_t*)i2c_win_base + I2C_WIN_OFFSET(addr, reg)))
+#define I2C_WIN_READ(addr, reg)         I2C_WIN_REG(addr, reg)
+#define I2C_WIN_WRITE(addr, reg, value) (I2C_WIN_REG(addr, reg) = (value))
+
+#endif // I2C_HOST_MOCK
+
 //==============================================================================
 // Helper Functions
 //==============================================================================
@@ -70,6 +257,14 @@ static inline int i2c_is_busy(void) {
     return (I2C_READ_REG(I2C_REG_STATUS) & I2C_STAT_BUSY) ? 1 : 0;
 }
 
+/**
+ * @brief Check if any requester or engine is using the I2C master
+ * @return 1 if busy, 0 if idle
+ */
+static inline int i2c_bus_is_busy(void) {
+    return (I2C_READ_REG(I2C_REG_STATUS) & (I2C_STAT_BUSY | I2C_STAT_BUS_BUSY)) ? 1 : 0;
+}
+
 /**
  * @brief Check if last transaction had ACK error
  * @return 1 if error, 0 if no error
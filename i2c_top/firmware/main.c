@@ -9,97 +9,74 @@
  */
 
 #include "i2c_driver.h"
+#include "i2c_regs.h"
+#include "timebase.h"
 #include <stdio.h>
 #include <stdint.h>
 
-// Platform-specific delay
-void delay_ms(uint32_t ms) {
-    // TODO: Replace with platform-specific delay
-    // For Xilinx: MB_Sleep(ms)
-    volatile uint32_t count = ms * 25000;
-    while (count--);
-}
-
 // External demo functions
-extern void demo_led_main(void);
-extern void demo_fnd_main(void);
-extern void demo_switch_main(void);
-
-/**
- * @brief Combined demo: All features
- */
-void demo_all_features(void) {
-    printf("\n========================================\n");
-    printf("Combined I2C Multi-Slave Demo\n");
-    printf("========================================\n\n");
-
-    uint8_t counter = 0;
-
-    for (int round = 0; round < 5; round++) {
-        printf("\n--- Round %d/5 ---\n", round + 1);
+extern void bench_driver_main(void);
+extern void demo_tasks_main(void);
 
-        // 1. Blink LED
-        printf("  LED: Blinking...\n");
-        i2c_write_led(0xFF);
-        delay_ms(300);
-        i2c_write_led(0x00);
-        delay_ms(300);
+//==============================================================================
+// Async Demo: switch -> LED / FND without blocking the main loop
+//==============================================================================
 
-        // 2. Update FND counter
-        printf("  FND: Displaying %X\n", counter);
-        i2c_write_fnd(counter);
-        counter = (counter + 1) & 0x0F;
+static uint8_t async_sw;
+static uint8_t async_gc[3];
+static int async_reads;
 
-        // 3. Read and display switch
-        uint8_t sw_value;
-        if (i2c_read_switch(&sw_value) == I2C_SUCCESS) {
-            printf("  Switch: 0x%02X\n", sw_value);
-            i2c_write_led(sw_value);
-        }
+/**
+ * @brief Switch read done: queue the LED / FND general call write
+ */
+static void on_switch_read(int handle, int result, void *ctx) {
+    (void)handle;
+    (void)ctx;
 
-        delay_ms(1000);
+    if (result != I2C_SUCCESS) {
+        return;
     }
 
-    // Clear all outputs
-    i2c_write_led(0x00);
-    i2c_write_fnd(0x00);
+    async_gc[0] = I2C_GC_OP_WRITE | I2C_GC_DEV_LED | I2C_GC_DEV_FND;
+    async_gc[1] = async_sw;
+    async_gc[2] = async_sw & 0x0F;
 
-    printf("\n=== Combined Demo Complete ===\n");
+    i2c_op_t op = { 0x00, 0, 3, 0, async_gc, NULL };   // General call
+    i2c_submit(&op, NULL, NULL);
+    async_reads++;
 }
 
 /**
- * @brief Interactive demo: Switch controls LED and FND
+ * @brief Async demo: the loop keeps computing while transfers run
  */
-void demo_interactive(void) {
+void demo_async(void) {
     printf("\n========================================\n");
-    printf("Interactive Demo\n");
+    printf("Async Demo (i2c_submit / i2c_poll)\n");
     printf("========================================\n");
-    printf("Switch[7:0] → LED[7:0]\n");
-    printf("Switch[3:0] → FND digit\n");
-    printf("Running for 30 seconds...\n");
-    printf("(Change switches to see real-time update)\n\n");
-
-    for (int i = 0; i < 300; i++) {
-        uint8_t sw_value;
-
-        if (i2c_read_switch(&sw_value) == I2C_SUCCESS) {
-            // Copy to LED
-            i2c_write_led(sw_value);
-
-            // Lower 4 bits to FND
-            i2c_write_fnd(sw_value & 0x0F);
-
-            // Print every 2 seconds
-            if (i % 20 == 0) {
-                printf("  SW: 0x%02X → LED: 0x%02X, FND: %01X\n",
-                       sw_value, sw_value, sw_value & 0x0F);
-            }
+
+    const i2c_op_t sw_read = { I2C_ADDR_SWITCH, 1, 1, 0, NULL, &async_sw };
+    uint32_t work = 0;
+
+    async_reads = 0;
+    for (int i = 0; i < 1000; i++) {
+        // One switch read in flight at a time
+        if (i2c_poll() == 0) {
+            i2c_submit(&sw_read, on_switch_read, NULL);
+        }
+
+        // Application work overlaps the bus transfers
+        for (int k = 0; k < 1000; k++) {
+            work++;
         }
+    }
 
-        delay_ms(100);
+    while (i2c_poll() > 0) {
+        // Drain
     }
 
-    printf("\n=== Interactive Demo Complete ===\n");
+    printf("  %d switch reads mirrored, %lu work units done meanwhile\n",
+           async_reads, (unsigned long)work);
+    printf("\n=== Async Demo Complete ===\n");
 }
 
 /**
@@ -113,38 +90,40 @@ int test_all_slaves(void) {
     int passed = 0;
     int failed = 0;
 
-    // Test LED Slave
-    printf("Testing LED Slave (0x55)... ");
-    if (i2c_write_led(0xAA) == I2C_SUCCESS) {
-        printf("✓ PASS\n");
-        passed++;
-    } else {
-        printf("✗ FAIL\n");
-        failed++;
+    // Address-only scan: finds every slave without touching LED/FND state
+    static const struct {
+        uint8_t addr;
+        const char *name;
+    } expected[] = {
+        { I2C_ADDR_LED,    "LED Slave"    },
+        { I2C_ADDR_FND,    "FND Slave"    },
+        { I2C_ADDR_SWITCH, "Switch Slave" },
+    };
+    uint32_t map[4];
+
+    if (i2c_scan(0x08, 0x77, map, 100000) != I2C_SUCCESS) {
+        printf("✗ Bus scan failed\n");
+        return -1;
     }
-    delay_ms(100);
-
-    // Test FND Slave
-    printf("Testing FND Slave (0x56)... ");
-    if (i2c_write_fnd(0x05) == I2C_SUCCESS) {
-        printf("✓ PASS\n");
-        passed++;
-    } else {
-        printf("✗ FAIL\n");
-        failed++;
+
+    for (unsigned i = 0; i < sizeof(expected) / sizeof(expected[0]); i++) {
+        printf("Testing %s (0x%02X)... ", expected[i].name, expected[i].addr);
+        if (i2c_scan_present(map, expected[i].addr)) {
+            printf("✓ PASS\n");
+            passed++;
+        } else {
+            printf("✗ FAIL\n");
+            failed++;
+        }
     }
-    delay_ms(100);
-
-    // Test Switch Slave
-    printf("Testing Switch Slave (0x57)... ");
-    uint8_t sw_value;
-    if (i2c_read_switch(&sw_value) == I2C_SUCCESS) {
-        printf("✓ PASS (read: 0x%02X)\n", sw_value);
-        passed++;
-    } else {
-        printf("✗ FAIL\n");
-        failed++;
+
+    printf("Devices found:");
+    for (uint8_t a = 0x08; a <= 0x77; a++) {
+        if (i2c_scan_present(map, a)) {
+            printf(" 0x%02X", a);
+        }
     }
+    printf("\n");
 
     printf("\n========================================\n");
     printf("Test Results: %d passed, %d failed\n", passed, failed);
@@ -153,6 +132,64 @@ int test_all_slaves(void) {
     return (failed == 0) ? 0 : -1;
 }
 
+//==============================================================================
+// Completion Latency (hardware done stamp -> driver return)
+//==============================================================================
+
+#define LATENCY_SAMPLES     32
+
+/**
+ * @brief Print min / avg / max of LATENCY_SAMPLES in ns
+ */
+static void print_latency(const char *name, const uint32_t *cyc) {
+    uint32_t lo = cyc[0], hi = cyc[0];
+    uint64_t sum = 0;
+
+    for (int i = 0; i < LATENCY_SAMPLES; i++) {
+        lo = (cyc[i] < lo) ? cyc[i] : lo;
+        hi = (cyc[i] > hi) ? cyc[i] : hi;
+        sum += cyc[i];
+    }
+
+    uint32_t ns_per_1k = (uint32_t)(1000000000000ULL / I2C_CORE_CLK_HZ);  // ns per 1000 cycles
+    printf("  %-22s min %5lu ns  avg %5lu ns  max %5lu ns\n", name,
+           (unsigned long)((uint64_t)lo * ns_per_1k / 1000),
+           (unsigned long)(sum * ns_per_1k / 1000 / LATENCY_SAMPLES),
+           (unsigned long)((uint64_t)hi * ns_per_1k / 1000));
+}
+
+/**
+ * @brief Completion-to-return latency: 1 us poll interval vs tight poll
+ */
+void measure_done_latency(void) {
+    static uint32_t cyc[LATENCY_SAMPLES];
+    const uint8_t off = 0x00;
+    const i2c_op_t led_off = { I2C_ADDR_LED, 0, 1, 0, &off, NULL };
+
+    printf("\nCompletion-to-return latency (%d LED writes each):\n", LATENCY_SAMPLES);
+
+    // Before: STATUS polled once per microsecond (old delay_us(1) loop)
+    for (int i = 0; i < LATENCY_SAMPLES; i++) {
+        if (i2c_submit(&led_off, NULL, NULL) < 0) {
+            return;
+        }
+        while (i2c_poll() > 0) {
+            timebase_delay_us(1);
+        }
+        cyc[i] = i2c_done_latency();
+    }
+    print_latency("1 us poll interval:", cyc);
+
+    // After: i2c_wait_done polls STATUS back to back (TICKS every 16 polls)
+    for (int i = 0; i < LATENCY_SAMPLES; i++) {
+        if (i2c_write_led(0x00) != I2C_SUCCESS) {
+            return;
+        }
+        cyc[i] = i2c_done_latency();
+    }
+    print_latency("tight poll:", cyc);
+}
+
 /**
  * @brief Main application
  */
@@ -183,27 +220,14 @@ int main(void) {
         printf("Check connections and slave board power.\n");
     }
 
-    delay_ms(2000);
+    measure_done_latency();
+#ifdef I2C_BENCH
+    bench_driver_main();                // JSON Lines on the UART
+#endif
+    demo_async();
 
-    // Run demos
-    while (1) {
-        demo_all_features();
-        delay_ms(2000);
-
-        demo_interactive();
-        delay_ms(2000);
-
-        demo_led_main();
-        delay_ms(2000);
-
-        demo_fnd_main();
-        delay_ms(2000);
-
-        demo_switch_main();
-        delay_ms(5000);
-
-        printf("\n\n=== Restarting demo cycle ===\n\n");
-    }
+    // LED / FND / switch demos as concurrent tasks, never returns
+    demo_tasks_main();
 
     return 0;
 }
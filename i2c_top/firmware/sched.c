@@ -0,0 +1,272 @@
+/**
+ * @file sched.c
+ * @brief Cooperative Run-to-Completion Scheduler Implementation
+ */
+
+#include "sched.h"
+#include "timebase.h"
+#include <stddef.h>
+
+//==============================================================================
+// Private Variables
+//==============================================================================
+typedef struct {
+    sched_fn fn;
+    void    *ctx;
+    volatile uint32_t events;   // Pending SCHED_EV_* bits
+    uint32_t due;               // Timer deadline (timebase ticks)
+    uint32_t period;            // 0 = one-shot
+    uint32_t fired_due;         // Deadline of the pending timer event
+    uint8_t  timer;             // Timer armed
+    uint8_t  i2c_pending;       // Requests in flight
+    int      i2c_result;
+} sched_task_t;
+
+static sched_task_t tasks[SCHED_TASKS];
+static int task_count = 0;
+static uint32_t max_lateness = 0;
+
+static int task_valid(int task) {
+    return task >= 0 && task < task_count;
+}
+
+/**
+ * @brief Deadline reached? (wrap-safe)
+ */
+static int due_passed(uint32_t now, uint32_t due) {
+    return (int32_t)(now - due) >= 0;
+}
+
+//==============================================================================
+// Public Functions
+//==============================================================================
+
+/**
+ * @brief Clear the task table
+ */
+void sched_reset(void) {
+    for (int i = 0; i < SCHED_TASKS; i++) {
+        tasks[i].fn = NULL;
+        tasks[i].events = 0;
+        tasks[i].timer = 0;
+        tasks[i].i2c_pending = 0;
+    }
+    task_count = 0;
+    max_lateness = 0;
+}
+
+/**
+ * @brief Add a task
+ */
+int sched_task(sched_fn fn, void *ctx) {
+    if (fn == NULL) {
+        return I2C_ERR_PARAM;
+    }
+    if (task_count >= SCHED_TASKS) {
+        return I2C_ERR_BUSY;
+    }
+
+    sched_task_t *t = &tasks[task_count];
+    t->fn = fn;
+    t->ctx = ctx;
+    t->events = 0;
+    t->timer = 0;
+    t->i2c_pending = 0;
+    t->i2c_result = I2C_SUCCESS;
+
+    return task_count++;
+}
+
+/**
+ * @brief One-shot timer
+ */
+void sched_after_us(int task, uint32_t us) {
+    if (!task_valid(task)) {
+        return;
+    }
+    tasks[task].due = timebase_now() + timebase_us_to_ticks(us);
+    tasks[task].period = 0;
+    tasks[task].timer = 1;
+}
+
+/**
+ * @brief Periodic timer
+ */
+void sched_every_us(int task, uint32_t period_us) {
+    if (!task_valid(task)) {
+        return;
+    }
+    uint32_t period = timebase_us_to_ticks(period_us);
+
+    tasks[task].period = period ? period : 1;
+    tasks[task].due = timebase_now() + tasks[task].period;
+    tasks[task].timer = 1;
+}
+
+/**
+ * @brief Stop the timer
+ */
+void sched_stop_timer(int task) {
+    if (task_valid(task)) {
+        tasks[task].timer = 0;
+    }
+}
+
+/**
+ * @brief Post events
+ */
+void sched_signal(int task, uint32_t events) {
+    if (!task_valid(task)) {
+        return;
+    }
+    uint32_t s = I2C_ASYNC_LOCK();
+    tasks[task].events |= events;
+    I2C_ASYNC_UNLOCK(s);
+}
+
+/**
+ * @brief Completion of a task's request: record it, wake the task
+ */
+static void on_i2c_done(int handle, int result, void *ctx) {
+    int task = (int)(intptr_t)ctx;
+    (void)handle;
+
+    if (task_valid(task)) {
+        tasks[task].i2c_result = result;
+        if (tasks[task].i2c_pending > 0) {
+            tasks[task].i2c_pending--;
+        }
+        tasks[task].events |= SCHED_EV_I2C;
+    }
+}
+
+/**
+ * @brief Async request owned by a task
+ */
+int sched_i2c_submit(int task, const i2c_op_t *op) {
+    if (!task_valid(task)) {
+        return I2C_ERR_PARAM;
+    }
+
+    int handle = i2c_submit(op, on_i2c_done, (void *)(intptr_t)task);
+    if (handle >= 0) {
+        tasks[task].i2c_pending++;
+    }
+    return handle;
+}
+
+/**
+ * @brief Last request result
+ */
+int sched_i2c_result(int task) {
+    return task_valid(task) ? tasks[task].i2c_result : I2C_ERR_PARAM;
+}
+
+/**
+ * @brief Requests in flight
+ */
+int sched_i2c_pending(int task) {
+    return task_valid(task) ? tasks[task].i2c_pending : 0;
+}
+
+/**
+ * @brief One pass: I2C queue, timers, ready handlers
+ */
+int sched_run_once(void) {
+    int ran = 0;
+
+    // Completions become SCHED_EV_I2C (callbacks run inside i2c_poll)
+    i2c_poll();
+
+    uint32_t now = timebase_now();
+    for (int i = 0; i < task_count; i++) {
+        sched_task_t *t = &tasks[i];
+        if (!t->timer || !due_passed(now, t->due)) {
+            continue;
+        }
+
+        t->fired_due = t->due;
+        if (t->period) {
+            t->due += t->period;
+            if (due_passed(now, t->due)) {
+                t->due = now + t->period;       // Overrun: skip missed periods
+            }
+        } else {
+            t->timer = 0;
+        }
+        sched_signal(i, SCHED_EV_TIMER);
+    }
+
+    for (int i = 0; i < task_count; i++) {
+        sched_task_t *t = &tasks[i];
+
+        uint32_t s = I2C_ASYNC_LOCK();
+        uint32_t events = t->events;
+        t->events = 0;
+        I2C_ASYNC_UNLOCK(s);
+
+        if (events == 0) {
+            continue;
+        }
+        if (events & SCHED_EV_TIMER) {
+            uint32_t late = timebase_now() - t->fired_due;
+            if (late > max_lateness) {
+                max_lateness = late;
+            }
+        }
+
+        t->fn(i, events, t->ctx);
+        ran++;
+    }
+
+    return ran;
+}
+
+/**
+ * @brief Ticks until the next timer, 0 if I2C requests are in flight
+ */
+static uint32_t idle_ticks(void) {
+    uint32_t now = timebase_now();
+    uint32_t next = 0xFFFFFFFFUL;
+
+    for (int i = 0; i < task_count; i++) {
+        if (tasks[i].i2c_pending || tasks[i].events) {
+            return 0;
+        }
+        if (tasks[i].timer) {
+            uint32_t left = due_passed(now, tasks[i].due) ? 0 : tasks[i].due - now;
+            if (left < next) {
+                next = left;
+            }
+        }
+    }
+    return next;
+}
+
+/**
+ * @brief Run the loop for ms milliseconds
+ */
+void sched_run_for(uint32_t ms) {
+    uint32_t start = timebase_now();
+    uint32_t span = timebase_us_to_ticks(ms * 1000UL);
+
+    while (!timebase_expired(start, span)) {
+        if (sched_run_once() == 0) {
+            uint32_t ticks = idle_ticks();
+            if (ticks) {
+                SCHED_IDLE(ticks);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Worst lateness
+ */
+uint32_t sched_max_lateness(int clear) {
+    uint32_t v = max_lateness;
+    if (clear) {
+        max_lateness = 0;
+    }
+    return v;
+}
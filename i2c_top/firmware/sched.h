@@ -0,0 +1,112 @@
+/**
+ * @file sched.h
+ * @brief Cooperative Run-to-Completion Scheduler
+ *
+ * Tasks are handlers called with a bit mask of events:
+ *  - SCHED_EV_TIMER: a one-shot or periodic timer on the timebase counter
+ *    expired (no tick interrupt: deadlines are compared when the loop runs)
+ *  - SCHED_EV_I2C:   a request submitted with sched_i2c_submit finished
+ *  - SCHED_EV_USER(n): posted by another task or an ISR (sched_signal)
+ *
+ * A handler runs to completion and must not block: bus traffic goes
+ * through the async queue (i2c_submit / i2c_poll), so a task waits for the
+ * bus by returning and getting SCHED_EV_I2C later. Dispatch latency is
+ * therefore bounded by the longest handler, not by I2C transfers.
+ * Blocking driver calls return I2C_ERR_BUSY while async requests run.
+ */
+
+#ifndef SCHED_H
+#define SCHED_H
+
+#include <stdint.h>
+#include "i2c_driver.h"
+
+#define SCHED_TASKS         8           // Task table size (static)
+
+#define SCHED_EV_TIMER      (1u << 0)
+#define SCHED_EV_I2C        (1u << 1)
+#define SCHED_EV_USER(n)    (1u << (8 + (n)))   // n = 0..23
+
+// Idle hook, called with the ticks until the next timer (0xFFFFFFFF =
+// none) when nothing is ready, e.g. to program a one-shot timer and sleep.
+// Define before including this header.
+#ifndef SCHED_IDLE
+#define SCHED_IDLE(ticks)   ((void)(ticks))
+#endif
+
+/**
+ * @brief Task handler
+ * @param task Task id
+ * @param events SCHED_EV_* bits that fired since the last call
+ * @param ctx Context pointer given to sched_task
+ */
+typedef void (*sched_fn)(int task, uint32_t events, void *ctx);
+
+/**
+ * @brief Remove all tasks and timers
+ */
+void sched_reset(void);
+
+/**
+ * @brief Add a task
+ * @return Task id (0 or more), I2C_ERR_BUSY if the table is full
+ */
+int sched_task(sched_fn fn, void *ctx);
+
+/**
+ * @brief One-shot timer (replaces the task's timer)
+ * @param us Microseconds from now
+ */
+void sched_after_us(int task, uint32_t us);
+
+/**
+ * @brief Periodic timer without drift (replaces the task's timer)
+ * @param period_us Period in microseconds; late periods are skipped, not queued
+ */
+void sched_every_us(int task, uint32_t period_us);
+
+/**
+ * @brief Stop the task's timer
+ */
+void sched_stop_timer(int task);
+
+/**
+ * @brief Post events to a task (safe from an ISR with I2C_ASYNC_LOCK defined)
+ */
+void sched_signal(int task, uint32_t events);
+
+/**
+ * @brief Submit an async request; the task gets SCHED_EV_I2C when it is done
+ * @return Handle from i2c_submit or negative error code
+ */
+int sched_i2c_submit(int task, const i2c_op_t *op);
+
+/**
+ * @brief Result of the task's last finished request
+ */
+int sched_i2c_result(int task);
+
+/**
+ * @brief Requests the task has queued or on the bus
+ */
+int sched_i2c_pending(int task);
+
+/**
+ * @brief Advance the I2C queue, fire timers, run every ready task once
+ * @return Number of handlers run
+ */
+int sched_run_once(void);
+
+/**
+ * @brief Run the loop for a while (sched_run_once + SCHED_IDLE)
+ * @param ms Milliseconds
+ */
+void sched_run_for(uint32_t ms);
+
+/**
+ * @brief Worst timer lateness seen (ticks from due to dispatch)
+ * @param clear 1 = reset after reading
+ */
+uint32_t sched_max_lateness(int clear);
+
+#endif // SCHED_H
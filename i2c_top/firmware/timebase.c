@@ -0,0 +1,94 @@
+/**
+ * @file timebase.c
+ * @brief Free-running Counter Timebase Implementation
+ */
+
+#include "timebase.h"
+#include <stddef.h>
+
+#ifdef I2C_HOST_MOCK
+// Host build: the counter is simulated, reading it advances simulated time
+uint32_t i2c_mock_counter_read(volatile uint32_t *counter);
+#define TB_READ()   i2c_mock_counter_read(tb_counter)
+#else
+#define TB_READ()   (*tb_counter)
+#endif
+
+//==============================================================================
+// Private Variables
+//==============================================================================
+static volatile uint32_t *tb_counter = NULL;
+static uint32_t tb_ticks_per_us = 100;      // 100 MHz until timebase_init
+
+//==============================================================================
+// Public Functions
+//==============================================================================
+
+/**
+ * @brief Select the counter
+ */
+void timebase_init(volatile uint32_t *counter, uint32_t hz) {
+    tb_counter = counter;
+    tb_ticks_per_us = (hz >= 1000000UL) ? hz / 1000000UL : 1;
+}
+
+/**
+ * @brief Counter selected?
+ */
+int timebase_ready(void) {
+    return tb_counter != NULL;
+}
+
+/**
+ * @brief Read the counter
+ */
+uint32_t timebase_now(void) {
+    return (tb_counter != NULL) ? TB_READ() : 0;
+}
+
+/**
+ * @brief Microseconds to ticks
+ */
+uint32_t timebase_us_to_ticks(uint32_t us) {
+    uint64_t ticks = (uint64_t)us * tb_ticks_per_us;
+    return (ticks > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : (uint32_t)ticks;
+}
+
+/**
+ * @brief Ticks to nanoseconds
+ */
+uint32_t timebase_ticks_to_ns(uint32_t ticks) {
+    uint64_t ns = (uint64_t)ticks * 1000ULL / tb_ticks_per_us;
+    return (ns > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : (uint32_t)ns;
+}
+
+/**
+ * @brief Busy-wait microseconds
+ */
+void timebase_delay_us(uint32_t us) {
+    if (tb_counter == NULL) {
+        // No counter yet: rough loop (about 4 cycles per iteration)
+        volatile uint32_t count = us * (tb_ticks_per_us / 4);
+        while (count--);
+        return;
+    }
+
+    // Spans of 2^31 ticks or more would alias; wait in 10 s steps
+    while (us > 10000000UL) {
+        timebase_delay_us(10000000UL);
+        us -= 10000000UL;
+    }
+
+    uint32_t start = TB_READ();
+    uint32_t ticks = timebase_us_to_ticks(us);
+    while ((uint32_t)(TB_READ() - start) < ticks);
+}
+
+/**
+ * @brief Busy-wait milliseconds
+ */
+void timebase_delay_ms(uint32_t ms) {
+    while (ms--) {
+        timebase_delay_us(1000);
+    }
+}
@@ -0,0 +1,67 @@
+/**
+ * @file timebase.h
+ * @brief Free-running Counter Timebase
+ *
+ * Delays and timeouts measured on an up-counting 32-bit hardware counter:
+ * the I2C IP tick register (default, set up by i2c_init) or an AXI Timer
+ * in free-running up-count mode (pass the address of its TCR register).
+ */
+
+#ifndef TIMEBASE_H
+#define TIMEBASE_H
+
+#include <stdint.h>
+
+/**
+ * @brief Select the counter
+ * @param counter Address of an up-counting 32-bit counter register
+ * @param hz Counter clock frequency (1 MHz or more)
+ */
+void timebase_init(volatile uint32_t *counter, uint32_t hz);
+
+/**
+ * @brief Check whether timebase_init has been called
+ * @return 1 if a counter is set, 0 otherwise
+ */
+int timebase_ready(void);
+
+/**
+ * @brief Current counter value (0 before timebase_init)
+ */
+uint32_t timebase_now(void);
+
+/**
+ * @brief Convert microseconds to counter ticks
+ * @param us Microseconds (result saturates at 0xFFFFFFFF)
+ */
+uint32_t timebase_us_to_ticks(uint32_t us);
+
+/**
+ * @brief Convert counter ticks to nanoseconds
+ * @param ticks Ticks (result saturates at 0xFFFFFFFF)
+ */
+uint32_t timebase_ticks_to_ns(uint32_t ticks);
+
+/**
+ * @brief Check a deadline, wrap-safe for spans below 2^31 ticks
+ * @param start timebase_now() when the wait began
+ * @param ticks Span in ticks
+ * @return 1 once ticks have passed since start, 0 before
+ */
+static inline int timebase_expired(uint32_t start, uint32_t ticks) {
+    return (uint32_t)(timebase_now() - start) >= ticks;
+}
+
+/**
+ * @brief Busy-wait on the counter
+ * @param us Microseconds
+ */
+void timebase_delay_us(uint32_t us);
+
+/**
+ * @brief Busy-wait on the counter
+ * @param ms Milliseconds
+ */
+void timebase_delay_ms(uint32_t ms);
+
+#endif // TIMEBASE_H
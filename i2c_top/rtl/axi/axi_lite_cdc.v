@@ -0,0 +1,285 @@
+`timescale 1 ns / 1 ps
+
+module axi_lite_cdc #
+(
+    // Width of AXI data bus
+    parameter integer C_AXI_DATA_WIDTH	= 32,
+    // Width of AXI address bus
+    parameter integer C_AXI_ADDR_WIDTH	= 7,
+    // Synchronizer flip-flops per crossing (2 or more)
+    parameter integer C_SYNC_STAGES	= 2
+)
+(
+    // Slave side: interconnect clock
+    input wire  S_AXI_ACLK,
+    input wire  S_AXI_ARESETN,
+    input wire [C_AXI_ADDR_WIDTH-1 : 0] S_AXI_AWADDR,
+    input wire [2 : 0] S_AXI_AWPROT,
+    input wire  S_AXI_AWVALID,
+    output wire  S_AXI_AWREADY,
+    input wire [C_AXI_DATA_WIDTH-1 : 0] S_AXI_WDATA,
+    input wire [(C_AXI_DATA_WIDTH/8)-1 : 0] S_AXI_WSTRB,
+    input wire  S_AXI_WVALID,
+    output wire  S_AXI_WREADY,
+    output wire [1 : 0] S_AXI_BRESP,
+    output wire  S_AXI_BVALID,
+    input wire  S_AXI_BREADY,
+    input wire [C_AXI_ADDR_WIDTH-1 : 0] S_AXI_ARADDR,
+    input wire [2 : 0] S_AXI_ARPROT,
+    input wire  S_AXI_ARVALID,
+    output wire  S_AXI_ARREADY,
+    output wire [C_AXI_DATA_WIDTH-1 : 0] S_AXI_RDATA,
+    output wire [1 : 0] S_AXI_RRESP,
+    output wire  S_AXI_RVALID,
+    input wire  S_AXI_RREADY,
+
+    // Master side: I2C core clock
+    input wire  M_AXI_ACLK,
+    input wire  M_AXI_ARESETN,
+    output wire [C_AXI_ADDR_WIDTH-1 : 0] M_AXI_AWADDR,
+    output wire [2 : 0] M_AXI_AWPROT,
+    output wire  M_AXI_AWVALID,
+    input wire  M_AXI_AWREADY,
+    output wire [C_AXI_DATA_WIDTH-1 : 0] M_AXI_WDATA,
+    output wire [(C_AXI_DATA_WIDTH/8)-1 : 0] M_AXI_WSTRB,
+    output wire  M_AXI_WVALID,
+    input wire  M_AXI_WREADY,
+    input wire [1 : 0] M_AXI_BRESP,
+    input wire  M_AXI_BVALID,
+    output wire  M_AXI_BREADY,
+    output wire [C_AXI_ADDR_WIDTH-1 : 0] M_AXI_ARADDR,
+    output wire [2 : 0] M_AXI_ARPROT,
+    output wire  M_AXI_ARVALID,
+    input wire  M_AXI_ARREADY,
+    input wire [C_AXI_DATA_WIDTH-1 : 0] M_AXI_RDATA,
+    input wire [1 : 0] M_AXI_RRESP,
+    input wire  M_AXI_RVALID,
+    output wire  M_AXI_RREADY
+);
+
+//==============================================================================
+// AXI4-Lite Clock Domain Crossing
+//==============================================================================
+// Carries one AXI4-Lite access at a time from the interconnect clock to the
+// I2C core clock and its response back (bundled data, toggle handshake):
+//
+//   S side: accept AW+W or AR, register the request, flip req_toggle
+//   M side: see req_toggle change (C_SYNC_STAGES flops), replay the access
+//           on M_AXI, register the response, flip ack_toggle
+//   S side: see ack_toggle change, raise BVALID / RVALID with the response
+//
+// Request and response registers only change while the other side waits
+// for the toggle, so they are stable when sampled and need no synchronizer
+// (constrain them with set_max_delay -datapath_only). The clocks may have
+// any ratio; reset both sides together.
+//==============================================================================
+
+// Slave side state
+reg  	s_awready;
+reg  	s_wready;
+reg  	s_arready;
+reg  	s_bvalid;
+reg  	s_rvalid;
+reg  	s_busy;          // Request sent, response not yet returned
+reg  	req_toggle;
+reg  	s_ack_seen;
+
+// Request (S domain, read by M side)
+reg  	req_read;
+reg [C_AXI_ADDR_WIDTH-1 : 0] 	req_addr;
+reg [2 : 0] 	req_prot;
+reg [C_AXI_DATA_WIDTH-1 : 0] 	req_wdata;
+reg [(C_AXI_DATA_WIDTH/8)-1 : 0] 	req_wstrb;
+
+// Master side state
+reg  	m_awvalid;
+reg  	m_wvalid;
+reg  	m_bready;
+reg  	m_arvalid;
+reg  	m_rready;
+reg  	ack_toggle;
+reg  	m_req_seen;
+
+// Response (M domain, read by S side)
+reg [1 : 0] 	rsp_resp;
+reg [C_AXI_DATA_WIDTH-1 : 0] 	rsp_rdata;
+
+// Toggle synchronizers
+(* ASYNC_REG = "TRUE" *) reg [C_SYNC_STAGES-1 : 0] 	req_sync;
+(* ASYNC_REG = "TRUE" *) reg [C_SYNC_STAGES-1 : 0] 	ack_sync;
+
+wire s_wr_go = ~s_busy && ~s_awready && S_AXI_AWVALID && S_AXI_WVALID;
+wire s_rd_go = ~s_busy && ~s_arready && S_AXI_ARVALID && ~s_wr_go;
+wire s_ack   = ack_sync[C_SYNC_STAGES-1] != s_ack_seen;
+wire m_req   = req_sync[C_SYNC_STAGES-1] != m_req_seen;
+
+// I/O Connections assignments
+
+assign S_AXI_AWREADY	= s_awready;
+assign S_AXI_WREADY	= s_wready;
+assign S_AXI_BRESP	= rsp_resp;
+assign S_AXI_BVALID	= s_bvalid;
+assign S_AXI_ARREADY	= s_arready;
+assign S_AXI_RDATA	= rsp_rdata;
+assign S_AXI_RRESP	= rsp_resp;
+assign S_AXI_RVALID	= s_rvalid;
+
+assign M_AXI_AWADDR	= req_addr;
+assign M_AXI_AWPROT	= req_prot;
+assign M_AXI_AWVALID	= m_awvalid;
+assign M_AXI_WDATA	= req_wdata;
+assign M_AXI_WSTRB	= req_wstrb;
+assign M_AXI_WVALID	= m_wvalid;
+assign M_AXI_BREADY	= m_bready;
+assign M_AXI_ARADDR	= req_addr;
+assign M_AXI_ARPROT	= req_prot;
+assign M_AXI_ARVALID	= m_arvalid;
+assign M_AXI_RREADY	= m_rready;
+
+//------------------------------------------------------------------------------
+// Slave side: accept, send request, return response
+//------------------------------------------------------------------------------
+
+always @( posedge S_AXI_ACLK )
+begin
+  if ( S_AXI_ARESETN == 1'b0 )
+    begin
+      ack_sync <= 0;
+    end
+  else
+    begin
+      ack_sync <= {ack_sync[C_SYNC_STAGES-2:0], ack_toggle};
+    end
+end
+
+always @( posedge S_AXI_ACLK )
+begin
+  if ( S_AXI_ARESETN == 1'b0 )
+    begin
+      s_awready  <= 1'b0;
+      s_wready   <= 1'b0;
+      s_arready  <= 1'b0;
+      s_bvalid   <= 1'b0;
+      s_rvalid   <= 1'b0;
+      s_busy     <= 1'b0;
+      req_toggle <= 1'b0;
+      s_ack_seen <= 1'b0;
+      req_read   <= 1'b0;
+      req_addr   <= 0;
+      req_prot   <= 3'b000;
+      req_wdata  <= 0;
+      req_wstrb  <= 0;
+    end
+  else
+    begin
+      s_awready <= s_wr_go;
+      s_wready  <= s_wr_go;
+      s_arready <= s_rd_go;
+
+      if (s_wr_go)
+        begin
+          // Write address and data taken together
+          req_read   <= 1'b0;
+          req_addr   <= S_AXI_AWADDR;
+          req_prot   <= S_AXI_AWPROT;
+          req_wdata  <= S_AXI_WDATA;
+          req_wstrb  <= S_AXI_WSTRB;
+          req_toggle <= ~req_toggle;
+          s_busy     <= 1'b1;
+        end
+      else if (s_rd_go)
+        begin
+          req_read   <= 1'b1;
+          req_addr   <= S_AXI_ARADDR;
+          req_prot   <= S_AXI_ARPROT;
+          req_toggle <= ~req_toggle;
+          s_busy     <= 1'b1;
+        end
+
+      if (s_ack)
+        begin
+          s_ack_seen <= ~s_ack_seen;
+          s_bvalid   <= ~req_read;
+          s_rvalid   <= req_read;
+        end
+      else if (S_AXI_BREADY && s_bvalid)
+        begin
+          s_bvalid <= 1'b0;
+          s_busy   <= 1'b0;
+        end
+      else if (S_AXI_RREADY && s_rvalid)
+        begin
+          s_rvalid <= 1'b0;
+          s_busy   <= 1'b0;
+        end
+    end
+end
+
+//------------------------------------------------------------------------------
+// Master side: replay the access, capture the response
+//------------------------------------------------------------------------------
+
+always @( posedge M_AXI_ACLK )
+begin
+  if ( M_AXI_ARESETN == 1'b0 )
+    begin
+      req_sync <= 0;
+    end
+  else
+    begin
+      req_sync <= {req_sync[C_SYNC_STAGES-2:0], req_toggle};
+    end
+end
+
+always @( posedge M_AXI_ACLK )
+begin
+  if ( M_AXI_ARESETN == 1'b0 )
+    begin
+      m_awvalid  <= 1'b0;
+      m_wvalid   <= 1'b0;
+      m_bready   <= 1'b0;
+      m_arvalid  <= 1'b0;
+      m_rready   <= 1'b0;
+      ack_toggle <= 1'b0;
+      m_req_seen <= 1'b0;
+      rsp_resp   <= 2'b00;
+      rsp_rdata  <= 0;
+    end
+  else
+    begin
+      if (m_req)
+        begin
+          m_req_seen <= ~m_req_seen;
+          m_awvalid  <= ~req_read;
+          m_wvalid   <= ~req_read;
+          m_bready   <= ~req_read;
+          m_arvalid  <= req_read;
+          m_rready   <= req_read;
+        end
+      else
+        begin
+          if (m_awvalid && M_AXI_AWREADY)
+            m_awvalid <= 1'b0;
+          if (m_wvalid && M_AXI_WREADY)
+            m_wvalid <= 1'b0;
+          if (m_arvalid && M_AXI_ARREADY)
+            m_arvalid <= 1'b0;
+
+          if (m_bready && M_AXI_BVALID)
+            begin
+              m_bready   <= 1'b0;
+              rsp_resp   <= M_AXI_BRESP;
+              ack_toggle <= ~ack_toggle;
+            end
+          else if (m_rready && M_AXI_RVALID)
+            begin
+              m_rready   <= 1'b0;
+              rsp_resp   <= M_AXI_RRESP;
+              rsp_rdata  <= M_AXI_RDATA;
+              ack_toggle <= ~ack_toggle;
+            end
+        end
+    end
+end
+
+endmodule
@@ -3,18 +3,33 @@
 module i2c_master_v1_0 #
 (
     // Users to add parameters here
+    parameter integer I2C_SCL_FREQ   = 100000,  // I2C SCL frequency (Hz)
+    parameter integer I2C_SDA_FILTER = 3,       // SDA majority taps (1 = off)
+    parameter integer I2C_CLK_FREQ   = 100000000, // I2C core clock (Hz)
+    parameter integer C_I2C_ASYNC_CLK = 0,      // 1 = core on i2c_clk, AXI through CDC
+    parameter integer I2C_STRETCH_TIMEOUT = 500000, // Longest SCL stretch (core clk, 0 = no limit)
 
     // User parameters ends
     // Do not modify the parameters beyond this line
 
     // Parameters of Axi Slave Bus Interface S00_AXI
     parameter integer C_S00_AXI_DATA_WIDTH	= 32,
-    parameter integer C_S00_AXI_ADDR_WIDTH	= 4
+    parameter integer C_S00_AXI_ADDR_WIDTH	= 7,
+
+    // Parameters of Axi Slave Bus Interface S01_AXI (register window)
+    parameter integer C_S01_AXI_DATA_WIDTH	= 32,
+    parameter integer C_S01_AXI_ADDR_WIDTH	= 17
 )
 (
     // Users to add ports here
     inout wire sda,
-    output wire scl,
+    inout wire scl,             // Open-drain (slaves may stretch)
+    output wire spi_sck,
+    output wire spi_mosi,
+    input wire spi_miso,
+    output wire spi_cs_n,
+    input wire i2c_clk,         // I2C core clock (C_I2C_ASYNC_CLK = 1)
+    input wire i2c_aresetn,     // I2C core reset, active low
     // User ports ends
     // Do not modify the ports beyond this line
 
@@ -39,18 +54,352 @@ module i2c_master_v1_0 #
     output wire [C_S00_AXI_DATA_WIDTH-1 : 0] s00_axi_rdata,
     output wire [1 : 0] s00_axi_rresp,
     output wire  s00_axi_rvalid,
-    input wire  s00_axi_rready
+    input wire  s00_axi_rready,
+
+    // Ports of Axi Slave Bus Interface S01_AXI
+    input wire  s01_axi_aclk,
+    input wire  s01_axi_aresetn,
+    input wire [C_S01_AXI_ADDR_WIDTH-1 : 0] s01_axi_awaddr,
+    input wire [2 : 0] s01_axi_awprot,
+    input wire  s01_axi_awvalid,
+    output wire  s01_axi_awready,
+    input wire [C_S01_AXI_DATA_WIDTH-1 : 0] s01_axi_wdata,
+    input wire [(C_S01_AXI_DATA_WIDTH/8)-1 : 0] s01_axi_wstrb,
+    input wire  s01_axi_wvalid,
+    output wire  s01_axi_wready,
+    output wire [1 : 0] s01_axi_bresp,
+    output wire  s01_axi_bvalid,
+    input wire  s01_axi_bready,
+    input wire [C_S01_AXI_ADDR_WIDTH-1 : 0] s01_axi_araddr,
+    input wire [2 : 0] s01_axi_arprot,
+    input wire  s01_axi_arvalid,
+    output wire  s01_axi_arready,
+    output wire [C_S01_AXI_DATA_WIDTH-1 : 0] s01_axi_rdata,
+    output wire [1 : 0] s01_axi_rresp,
+    output wire  s01_axi_rvalid,
+    input wire  s01_axi_rready
 );
 
 // User signals
 wire start;
 wire rw_bit;
 wire [6:0] slave_addr;
+wire [7:0] byte_count;
 wire [7:0] tx_data;
+wire tx_next;
 wire [7:0] rx_data;
+wire rx_valid;
 wire busy;
 wire done;
 wire ack_error;
+wire timeout;
+wire pec_en;
+wire addr_only;
+wire pec_error;
+wire transport_spi;
+wire [7:0] spi_clk_div;
+wire [7:0] sample_point;
+
+// Link test (REG6-REG11)
+wire lt_start;
+wire [6:0] lt_addr;
+wire [7:0] lt_blocks;
+wire [31:0] lt_speeds;
+wire [1:0] lt_sel;
+wire lt_busy;
+wire [31:0] lt_bytes;
+wire [31:0] lt_bit_errors;
+wire [15:0] lt_nacks;
+wire [15:0] lt_retries;
+wire [31:0] lt_cycles;
+wire lt_m_start;
+wire lt_m_rw;
+wire [6:0] lt_m_addr;
+wire [7:0] lt_m_count;
+wire [7:0] lt_m_tx_data;
+wire [7:0] lt_m_quarter;
+
+// Per-address speed table (REG12), looked up for the arbitrated requester
+wire [6:0] bus_addr;
+wire [7:0] bus_quarter;
+
+// Bus scan (REG13-REG17)
+wire scan_start;
+wire [6:0] scan_first;
+wire [6:0] scan_last;
+wire scan_busy;
+wire [127:0] scan_present;
+wire scan_m_start;
+wire [6:0] scan_m_addr;
+
+// Register window (S01_AXI)
+wire win_req;
+wire win_read;
+wire [6:0] win_addr;
+wire [7:0] win_reg;
+wire [7:0] win_data;
+wire win_ack;
+wire [7:0] win_rd_data;
+wire win_nack;
+wire win_posted;
+wire win_store_nack;
+wire win_busy;
+wire win_m_start;
+wire win_m_rw;
+wire [6:0] win_m_addr;
+wire [7:0] win_m_count;
+wire [7:0] win_m_tx_data;
+wire win_m_hold;
+
+// Command ports (REG18-REG21)
+wire [3:0] port_wr;
+wire [31:0] port_cmd;
+wire [127:0] port_stat;
+wire [3:0] port_req;
+wire port_m_start;
+wire port_m_rw;
+wire [6:0] port_m_addr;
+wire [7:0] port_m_count;
+wire [7:0] port_m_tx_data;
+
+// Arbiter (REG22): [0] REG0, [1] register window, [5:2] command ports
+wire [11:0] arb_prio;
+wire [5:0] arb_grant;
+wire arb_busy;
+wire ctl_grant  = arb_grant[0];
+wire win_grant  = arb_grant[1];
+wire port_grant = |arb_grant[5:2];
+
+// The link tester or the scanner owns i2c_master exclusively
+wire hw_busy = lt_busy | scan_busy;
+
+// i2c_master used by anyone (STATUS[7])
+wire i2c_busy;
+wire bus_busy = i2c_busy | arb_busy | hw_busy;
+
+// REG0 requester: a start waits for the grant, then runs on i2c_master
+reg ctl_req;            // REG0 transaction pending or running
+reg ctl_run;            // ... start issued to i2c_master
+reg [7:0] ctl_rx_hold;  // Last REG0 values, kept over other requesters
+reg ctl_ack_hold;
+reg ctl_timeout_hold;
+reg ctl_pec_hold;
+wire ctl_abort;         // REG1[25] write: drop the REG0 transaction
+wire ctl_m_start = ctl_grant & ctl_req & ~ctl_run & ~ctl_abort;
+
+// REG0 hold: after a REG0[26] transaction the grant stays with REG0
+// (ctl_held) until the next REG0 start (repeated START) or a REG1 release
+wire ctl_hold;
+wire ctl_release;
+reg ctl_hold_on;        // REG0[26] of the running transaction
+reg ctl_held;           // i2c_master in HOLD for REG0
+reg ctl_stop;           // Released: STOP in progress
+wire ctl_m_hold = ctl_m_start ? ctl_hold : ctl_held;
+
+// Per-transport master signals (muxed by REG5[0])
+wire i2c_tx_next, spi_tx_next;
+wire [7:0] i2c_rx_data, spi_rx_data;
+wire i2c_rx_valid, spi_rx_valid;
+wire spi_busy;
+wire i2c_done, spi_done;
+wire i2c_ack_error;
+wire i2c_timeout;
+wire i2c_pec_error;
+
+// I2C core clock domain: S00/S01 register files, i2c_master and engines
+wire core_clk;
+wire core_rstn;
+
+// Core-side AXI4-Lite (after the clock crossing)
+wire [C_S00_AXI_ADDR_WIDTH-1 : 0] c00_axi_awaddr;
+wire [2 : 0] c00_axi_awprot;
+wire c00_axi_awvalid;
+wire c00_axi_awready;
+wire [C_S00_AXI_DATA_WIDTH-1 : 0] c00_axi_wdata;
+wire [(C_S00_AXI_DATA_WIDTH/8)-1 : 0] c00_axi_wstrb;
+wire c00_axi_wvalid;
+wire c00_axi_wready;
+wire [1 : 0] c00_axi_bresp;
+wire c00_axi_bvalid;
+wire c00_axi_bready;
+wire [C_S00_AXI_ADDR_WIDTH-1 : 0] c00_axi_araddr;
+wire [2 : 0] c00_axi_arprot;
+wire c00_axi_arvalid;
+wire c00_axi_arready;
+wire [C_S00_AXI_DATA_WIDTH-1 : 0] c00_axi_rdata;
+wire [1 : 0] c00_axi_rresp;
+wire c00_axi_rvalid;
+wire c00_axi_rready;
+
+wire [C_S01_AXI_ADDR_WIDTH-1 : 0] c01_axi_awaddr;
+wire [2 : 0] c01_axi_awprot;
+wire c01_axi_awvalid;
+wire c01_axi_awready;
+wire [C_S01_AXI_DATA_WIDTH-1 : 0] c01_axi_wdata;
+wire [(C_S01_AXI_DATA_WIDTH/8)-1 : 0] c01_axi_wstrb;
+wire c01_axi_wvalid;
+wire c01_axi_wready;
+wire [1 : 0] c01_axi_bresp;
+wire c01_axi_bvalid;
+wire c01_axi_bready;
+wire [C_S01_AXI_ADDR_WIDTH-1 : 0] c01_axi_araddr;
+wire [2 : 0] c01_axi_arprot;
+wire c01_axi_arvalid;
+wire c01_axi_arready;
+wire [C_S01_AXI_DATA_WIDTH-1 : 0] c01_axi_rdata;
+wire [1 : 0] c01_axi_rresp;
+wire c01_axi_rvalid;
+wire c01_axi_rready;
+
+// C_I2C_ASYNC_CLK = 1: every register / window access crosses from the AXI
+// clock to i2c_clk in axi_lite_cdc (one access at a time, toggle handshake);
+// S00 and S01 may then each run on any clock. C_I2C_ASYNC_CLK = 0: the core
+// runs on s00_axi_aclk and S01_AXI must share it.
+generate
+if (C_I2C_ASYNC_CLK != 0) begin : g_async
+    assign core_clk  = i2c_clk;
+    assign core_rstn = i2c_aresetn;
+
+    axi_lite_cdc # (
+        .C_AXI_DATA_WIDTH(C_S00_AXI_DATA_WIDTH),
+        .C_AXI_ADDR_WIDTH(C_S00_AXI_ADDR_WIDTH)
+    ) u_s00_cdc (
+        .S_AXI_ACLK(s00_axi_aclk),
+        .S_AXI_ARESETN(s00_axi_aresetn),
+        .S_AXI_AWADDR(s00_axi_awaddr),
+        .S_AXI_AWPROT(s00_axi_awprot),
+        .S_AXI_AWVALID(s00_axi_awvalid),
+        .S_AXI_AWREADY(s00_axi_awready),
+        .S_AXI_WDATA(s00_axi_wdata),
+        .S_AXI_WSTRB(s00_axi_wstrb),
+        .S_AXI_WVALID(s00_axi_wvalid),
+        .S_AXI_WREADY(s00_axi_wready),
+        .S_AXI_BRESP(s00_axi_bresp),
+        .S_AXI_BVALID(s00_axi_bvalid),
+        .S_AXI_BREADY(s00_axi_bready),
+        .S_AXI_ARADDR(s00_axi_araddr),
+        .S_AXI_ARPROT(s00_axi_arprot),
+        .S_AXI_ARVALID(s00_axi_arvalid),
+        .S_AXI_ARREADY(s00_axi_arready),
+        .S_AXI_RDATA(s00_axi_rdata),
+        .S_AXI_RRESP(s00_axi_rresp),
+        .S_AXI_RVALID(s00_axi_rvalid),
+        .S_AXI_RREADY(s00_axi_rready),
+        .M_AXI_ACLK(core_clk),
+        .M_AXI_ARESETN(core_rstn),
+        .M_AXI_AWADDR(c00_axi_awaddr),
+        .M_AXI_AWPROT(c00_axi_awprot),
+        .M_AXI_AWVALID(c00_axi_awvalid),
+        .M_AXI_AWREADY(c00_axi_awready),
+        .M_AXI_WDATA(c00_axi_wdata),
+        .M_AXI_WSTRB(c00_axi_wstrb),
+        .M_AXI_WVALID(c00_axi_wvalid),
+        .M_AXI_WREADY(c00_axi_wready),
+        .M_AXI_BRESP(c00_axi_bresp),
+        .M_AXI_BVALID(c00_axi_bvalid),
+        .M_AXI_BREADY(c00_axi_bready),
+        .M_AXI_ARADDR(c00_axi_araddr),
+        .M_AXI_ARPROT(c00_axi_arprot),
+        .M_AXI_ARVALID(c00_axi_arvalid),
+        .M_AXI_ARREADY(c00_axi_arready),
+        .M_AXI_RDATA(c00_axi_rdata),
+        .M_AXI_RRESP(c00_axi_rresp),
+        .M_AXI_RVALID(c00_axi_rvalid),
+        .M_AXI_RREADY(c00_axi_rready)
+    );
+
+    axi_lite_cdc # (
+        .C_AXI_DATA_WIDTH(C_S01_AXI_DATA_WIDTH),
+        .C_AXI_ADDR_WIDTH(C_S01_AXI_ADDR_WIDTH)
+    ) u_s01_cdc (
+        .S_AXI_ACLK(s01_axi_aclk),
+        .S_AXI_ARESETN(s01_axi_aresetn),
+        .S_AXI_AWADDR(s01_axi_awaddr),
+        .S_AXI_AWPROT(s01_axi_awprot),
+        .S_AXI_AWVALID(s01_axi_awvalid),
+        .S_AXI_AWREADY(s01_axi_awready),
+        .S_AXI_WDATA(s01_axi_wdata),
+        .S_AXI_WSTRB(s01_axi_wstrb),
+        .S_AXI_WVALID(s01_axi_wvalid),
+        .S_AXI_WREADY(s01_axi_wready),
+        .S_AXI_BRESP(s01_axi_bresp),
+        .S_AXI_BVALID(s01_axi_bvalid),
+        .S_AXI_BREADY(s01_axi_bready),
+        .S_AXI_ARADDR(s01_axi_araddr),
+        .S_AXI_ARPROT(s01_axi_arprot),
+        .S_AXI_ARVALID(s01_axi_arvalid),
+        .S_AXI_ARREADY(s01_axi_arready),
+        .S_AXI_RDATA(s01_axi_rdata),
+        .S_AXI_RRESP(s01_axi_rresp),
+        .S_AXI_RVALID(s01_axi_rvalid),
+        .S_AXI_RREADY(s01_axi_rready),
+        .M_AXI_ACLK(core_clk),
+        .M_AXI_ARESETN(core_rstn),
+        .M_AXI_AWADDR(c01_axi_awaddr),
+        .M_AXI_AWPROT(c01_axi_awprot),
+        .M_AXI_AWVALID(c01_axi_awvalid),
+        .M_AXI_AWREADY(c01_axi_awready),
+        .M_AXI_WDATA(c01_axi_wdata),
+        .M_AXI_WSTRB(c01_axi_wstrb),
+        .M_AXI_WVALID(c01_axi_wvalid),
+        .M_AXI_WREADY(c01_axi_wready),
+        .M_AXI_BRESP(c01_axi_bresp),
+        .M_AXI_BVALID(c01_axi_bvalid),
+        .M_AXI_BREADY(c01_axi_bready),
+        .M_AXI_ARADDR(c01_axi_araddr),
+        .M_AXI_ARPROT(c01_axi_arprot),
+        .M_AXI_ARVALID(c01_axi_arvalid),
+        .M_AXI_ARREADY(c01_axi_arready),
+        .M_AXI_RDATA(c01_axi_rdata),
+        .M_AXI_RRESP(c01_axi_rresp),
+        .M_AXI_RVALID(c01_axi_rvalid),
+        .M_AXI_RREADY(c01_axi_rready)
+    );
+end else begin : g_sync
+    assign core_clk  = s00_axi_aclk;
+    assign core_rstn = s00_axi_aresetn;
+
+    assign c00_axi_awaddr = s00_axi_awaddr;
+    assign c00_axi_awprot = s00_axi_awprot;
+    assign c00_axi_awvalid = s00_axi_awvalid;
+    assign s00_axi_awready = c00_axi_awready;
+    assign c00_axi_wdata = s00_axi_wdata;
+    assign c00_axi_wstrb = s00_axi_wstrb;
+    assign c00_axi_wvalid = s00_axi_wvalid;
+    assign s00_axi_wready = c00_axi_wready;
+    assign s00_axi_bresp = c00_axi_bresp;
+    assign s00_axi_bvalid = c00_axi_bvalid;
+    assign c00_axi_bready = s00_axi_bready;
+    assign c00_axi_araddr = s00_axi_araddr;
+    assign c00_axi_arprot = s00_axi_arprot;
+    assign c00_axi_arvalid = s00_axi_arvalid;
+    assign s00_axi_arready = c00_axi_arready;
+    assign s00_axi_rdata = c00_axi_rdata;
+    assign s00_axi_rresp = c00_axi_rresp;
+    assign s00_axi_rvalid = c00_axi_rvalid;
+    assign c00_axi_rready = s00_axi_rready;
+
+    assign c01_axi_awaddr = s01_axi_awaddr;
+    assign c01_axi_awprot = s01_axi_awprot;
+    assign c01_axi_awvalid = s01_axi_awvalid;
+    assign s01_axi_awready = c01_axi_awready;
+    assign c01_axi_wdata = s01_axi_wdata;
+    assign c01_axi_wstrb = s01_axi_wstrb;
+    assign c01_axi_wvalid = s01_axi_wvalid;
+    assign s01_axi_wready = c01_axi_wready;
+    assign s01_axi_bresp = c01_axi_bresp;
+    assign s01_axi_bvalid = c01_axi_bvalid;
+    assign c01_axi_bready = s01_axi_bready;
+    assign c01_axi_araddr = s01_axi_araddr;
+    assign c01_axi_arprot = s01_axi_arprot;
+    assign c01_axi_arvalid = s01_axi_arvalid;
+    assign s01_axi_arready = c01_axi_arready;
+    assign s01_axi_rdata = c01_axi_rdata;
+    assign s01_axi_rresp = c01_axi_rresp;
+    assign s01_axi_rvalid = c01_axi_rvalid;
+    assign c01_axi_rready = s01_axi_rready;
+end
+endgenerate
 
 // Instantiation of Axi Bus Interface S00_AXI
 i2c_master_v1_0_S00_AXI # (
@@ -61,48 +410,223 @@ i2c_master_v1_0_S00_AXI # (
     .start(start),
     .rw_bit(rw_bit),
     .slave_addr(slave_addr),
+    .byte_count(byte_count),
     .tx_data(tx_data),
+    .tx_next(tx_next),
     .rx_data(rx_data),
+    .rx_valid(rx_valid),
     .busy(busy),
     .done(done),
     .ack_error(ack_error),
+    .timeout(timeout),
+    .pec_en(pec_en),
+    .addr_only(addr_only),
+    .pec_error(pec_error),
+    .transport_spi(transport_spi),
+    .spi_clk_div(spi_clk_div),
+    .sample_point(sample_point),
+    .lt_start(lt_start),
+    .lt_addr(lt_addr),
+    .lt_blocks(lt_blocks),
+    .lt_speeds(lt_speeds),
+    .lt_sel(lt_sel),
+    .lt_busy(lt_busy),
+    .lt_bytes(lt_bytes),
+    .lt_bit_errors(lt_bit_errors),
+    .lt_nacks(lt_nacks),
+    .lt_retries(lt_retries),
+    .lt_cycles(lt_cycles),
+    .scan_start(scan_start),
+    .scan_first(scan_first),
+    .scan_last(scan_last),
+    .scan_busy(scan_busy),
+    .scan_present(scan_present),
+    .bus_addr(bus_addr),
+    .bus_quarter(bus_quarter),
+    .win_posted(win_posted),
+    .win_store_nack(win_store_nack),
+    .bus_busy(bus_busy),
+    .port_wr(port_wr),
+    .port_cmd(port_cmd),
+    .port_stat(port_stat),
+    .arb_prio(arb_prio),
+    .ctl_hold(ctl_hold),
+    .ctl_release(ctl_release),
+    .ctl_abort(ctl_abort),
+    .ctl_held(ctl_held),
 
     // AXI interface
-    .S_AXI_ACLK(s00_axi_aclk),
-    .S_AXI_ARESETN(s00_axi_aresetn),
-    .S_AXI_AWADDR(s00_axi_awaddr),
-    .S_AXI_AWPROT(s00_axi_awprot),
-    .S_AXI_AWVALID(s00_axi_awvalid),
-    .S_AXI_AWREADY(s00_axi_awready),
-    .S_AXI_WDATA(s00_axi_wdata),
-    .S_AXI_WSTRB(s00_axi_wstrb),
-    .S_AXI_WVALID(s00_axi_wvalid),
-    .S_AXI_WREADY(s00_axi_wready),
-    .S_AXI_BRESP(s00_axi_bresp),
-    .S_AXI_BVALID(s00_axi_bvalid),
-    .S_AXI_BREADY(s00_axi_bready),
-    .S_AXI_ARADDR(s00_axi_araddr),
-    .S_AXI_ARPROT(s00_axi_arprot),
-    .S_AXI_ARVALID(s00_axi_arvalid),
-    .S_AXI_ARREADY(s00_axi_arready),
-    .S_AXI_RDATA(s00_axi_rdata),
-    .S_AXI_RRESP(s00_axi_rresp),
-    .S_AXI_RVALID(s00_axi_rvalid),
-    .S_AXI_RREADY(s00_axi_rready)
+    .S_AXI_ACLK(core_clk),
+    .S_AXI_ARESETN(core_rstn),
+    .S_AXI_AWADDR(c00_axi_awaddr),
+    .S_AXI_AWPROT(c00_axi_awprot),
+    .S_AXI_AWVALID(c00_axi_awvalid),
+    .S_AXI_AWREADY(c00_axi_awready),
+    .S_AXI_WDATA(c00_axi_wdata),
+    .S_AXI_WSTRB(c00_axi_wstrb),
+    .S_AXI_WVALID(c00_axi_wvalid),
+    .S_AXI_WREADY(c00_axi_wready),
+    .S_AXI_BRESP(c00_axi_bresp),
+    .S_AXI_BVALID(c00_axi_bvalid),
+    .S_AXI_BREADY(c00_axi_bready),
+    .S_AXI_ARADDR(c00_axi_araddr),
+    .S_AXI_ARPROT(c00_axi_arprot),
+    .S_AXI_ARVALID(c00_axi_arvalid),
+    .S_AXI_ARREADY(c00_axi_arready),
+    .S_AXI_RDATA(c00_axi_rdata),
+    .S_AXI_RRESP(c00_axi_rresp),
+    .S_AXI_RVALID(c00_axi_rvalid),
+    .S_AXI_RREADY(c00_axi_rready)
+);
+
+// Instantiation of Axi Bus Interface S01_AXI
+i2c_master_v1_0_S01_AXI # (
+    .C_S_AXI_DATA_WIDTH(C_S01_AXI_DATA_WIDTH),
+    .C_S_AXI_ADDR_WIDTH(C_S01_AXI_ADDR_WIDTH)
+) i2c_master_v1_0_S01_AXI_inst (
+    // Register window interface
+    .win_req(win_req),
+    .win_read(win_read),
+    .win_addr(win_addr),
+    .win_reg(win_reg),
+    .win_data(win_data),
+    .win_ack(win_ack),
+    .win_rd_data(win_rd_data),
+    .win_nack(win_nack),
+    .win_posted(win_posted),
+    .win_store_nack(win_store_nack),
+
+    // AXI interface
+    .S_AXI_ACLK(core_clk),
+    .S_AXI_ARESETN(core_rstn),
+    .S_AXI_AWADDR(c01_axi_awaddr),
+    .S_AXI_AWPROT(c01_axi_awprot),
+    .S_AXI_AWVALID(c01_axi_awvalid),
+    .S_AXI_AWREADY(c01_axi_awready),
+    .S_AXI_WDATA(c01_axi_wdata),
+    .S_AXI_WSTRB(c01_axi_wstrb),
+    .S_AXI_WVALID(c01_axi_wvalid),
+    .S_AXI_WREADY(c01_axi_wready),
+    .S_AXI_BRESP(c01_axi_bresp),
+    .S_AXI_BVALID(c01_axi_bvalid),
+    .S_AXI_BREADY(c01_axi_bready),
+    .S_AXI_ARADDR(c01_axi_araddr),
+    .S_AXI_ARPROT(c01_axi_arprot),
+    .S_AXI_ARVALID(c01_axi_arvalid),
+    .S_AXI_ARREADY(c01_axi_arready),
+    .S_AXI_RDATA(c01_axi_rdata),
+    .S_AXI_RRESP(c01_axi_rresp),
+    .S_AXI_RVALID(c01_axi_rvalid),
+    .S_AXI_RREADY(c01_axi_rready)
 );
 
 // Add user logic here
-i2c_master u_i2c_master (
-    .clk(s00_axi_aclk),
-    .rst_n(s00_axi_aresetn),
-    .start(start),
-    .rw_bit(rw_bit),
-    .slave_addr(slave_addr),
-    .tx_data(tx_data),
-    .rx_data(rx_data),
-    .busy(busy),
-    .done(done),
-    .ack_error(ack_error),
+// Only the selected master sees start, so the other bus stays idle.
+// REG0, the register window and the four command ports are requesters of
+// i2c_arbiter; the granted one drives i2c_master until its STOP and only
+// it sees tx_next / rx_valid / done. The link tester and the scanner take
+// i2c_master exclusively: they start only while nothing is requested and
+// hold off all grants while running. All of it runs on core_clk.
+assign tx_next   = transport_spi ? spi_tx_next  : i2c_tx_next  & ctl_run;
+assign rx_data   = transport_spi ? spi_rx_data  : ctl_run ? i2c_rx_data   : ctl_rx_hold;
+assign rx_valid  = transport_spi ? spi_rx_valid : i2c_rx_valid & ctl_run;
+assign busy      = ctl_req | ctl_stop | spi_busy | hw_busy;
+assign done      = transport_spi ? spi_done     : i2c_done     & ctl_run;
+assign ack_error = transport_spi ? 1'b0         : ctl_run ? i2c_ack_error : ctl_ack_hold;
+assign timeout   = transport_spi ? 1'b0         : ctl_run ? i2c_timeout   : ctl_timeout_hold;
+assign pec_error = transport_spi ? 1'b0         : ctl_run ? i2c_pec_error : ctl_pec_hold;
+
+always @(posedge core_clk) begin
+    if (core_rstn == 1'b0) begin
+        ctl_req      <= 1'b0;
+        ctl_run      <= 1'b0;
+        ctl_rx_hold  <= 8'h00;
+        ctl_ack_hold <= 1'b0;
+        ctl_timeout_hold <= 1'b0;
+        ctl_pec_hold <= 1'b0;
+        ctl_hold_on  <= 1'b0;
+        ctl_held     <= 1'b0;
+        ctl_stop     <= 1'b0;
+    end else begin
+        if (start & ~transport_spi)
+            ctl_req <= 1'b1;
+        else if ((ctl_run & i2c_done) | ctl_abort)
+            ctl_req <= 1'b0;
+
+        if (ctl_m_start)
+            ctl_run <= 1'b1;
+        else if (ctl_run & i2c_done)
+            ctl_run <= 1'b0;
+
+        if (ctl_m_start)
+            ctl_hold_on <= ctl_hold;
+
+        // A NACK ends with STOP even under hold
+        if (ctl_run & i2c_done)
+            ctl_held <= ctl_hold_on & ~i2c_ack_error;
+        else if (ctl_m_start | (ctl_release & ~ctl_req) | ctl_abort)
+            ctl_held <= 1'b0;
+
+        if (ctl_release & ctl_held & ~ctl_req)
+            ctl_stop <= 1'b1;
+        else if (i2c_done)
+            ctl_stop <= 1'b0;
+
+        if (ctl_run) begin
+            ctl_rx_hold  <= i2c_rx_data;
+            ctl_ack_hold <= i2c_ack_error;
+            ctl_timeout_hold <= i2c_timeout;
+            ctl_pec_hold <= i2c_pec_error;
+        end
+    end
+end
+
+// Address of the granted requester (speed table lookup and i2c_master)
+assign bus_addr = win_grant ? win_m_addr : port_grant ? port_m_addr : slave_addr;
+
+i2c_arbiter #(
+    .N(6)
+) u_arbiter (
+    .clk(core_clk),
+    .rst_n(core_rstn),
+    .req({port_req, win_busy, ctl_req | ctl_held | ctl_stop}),
+    .prio(arb_prio),
+    .enable(~hw_busy),
+    .grant(arb_grant),
+    .busy(arb_busy)
+);
+
+i2c_master #(
+    .CLK_FREQ(I2C_CLK_FREQ),
+    .SCL_FREQ(I2C_SCL_FREQ),
+    .SDA_FILTER(I2C_SDA_FILTER),
+    .STRETCH_TIMEOUT(I2C_STRETCH_TIMEOUT)
+) u_i2c_master (
+    .clk(core_clk),
+    .rst_n(core_rstn),
+    .start(lt_busy ? lt_m_start : scan_busy ? scan_m_start :
+           win_grant ? win_m_start : port_grant ? port_m_start : ctl_m_start),
+    .rw_bit(lt_busy ? lt_m_rw : scan_busy ? 1'b0 :
+            win_grant ? win_m_rw : port_grant ? port_m_rw : rw_bit),
+    .slave_addr(lt_busy ? lt_m_addr : scan_busy ? scan_m_addr : bus_addr),
+    .byte_count(lt_busy ? lt_m_count : win_grant ? win_m_count :
+                port_grant ? port_m_count : byte_count),
+    .tx_data(lt_busy ? lt_m_tx_data : win_grant ? win_m_tx_data :
+             port_grant ? port_m_tx_data : tx_data),
+    .tx_next(i2c_tx_next),
+    .rx_data(i2c_rx_data),
+    .rx_valid(i2c_rx_valid),
+    .busy(i2c_busy),
+    .done(i2c_done),
+    .ack_error(i2c_ack_error),
+    .timeout(i2c_timeout),
+    .pec_en(pec_en & ctl_grant & ~hw_busy),
+    .pec_error(i2c_pec_error),
+    .sample_point(sample_point),
+    .scl_quarter(lt_busy ? lt_m_quarter : scan_busy ? 8'd0 : bus_quarter),
+    .addr_only(scan_busy | (addr_only & ctl_grant & ~hw_busy)),
+    .hold((win_grant & win_m_hold) | (ctl_grant & ctl_m_hold)),
+    .abort(ctl_abort & (ctl_run | ctl_held)),
     .sda(sda),
     .scl(scl),
     .debug_busy(),
@@ -112,6 +636,118 @@ i2c_master u_i2c_master (
     .debug_sda_out(),
     .debug_sda_oe()
 );
+
+spi_master u_spi_master (
+    .clk(core_clk),
+    .rst_n(core_rstn),
+    .start(start & transport_spi),
+    .rw_bit(rw_bit),
+    .byte_count(byte_count),
+    .clk_div(spi_clk_div),
+    .tx_data(tx_data),
+    .tx_next(spi_tx_next),
+    .rx_data(spi_rx_data),
+    .rx_valid(spi_rx_valid),
+    .busy(spi_busy),
+    .done(spi_done),
+    .sck(spi_sck),
+    .mosi(spi_mosi),
+    .miso(spi_miso),
+    .cs_n(spi_cs_n),
+    .debug_state()
+);
+
+i2c_link_tester u_link_tester (
+    .clk(core_clk),
+    .rst_n(core_rstn),
+    .start(lt_start & ~bus_busy & ~spi_busy),
+    .slave_addr(lt_addr),
+    .blocks(lt_blocks),
+    .speeds(lt_speeds),
+    .busy(lt_busy),
+    .done(),
+    .res_sel(lt_sel),
+    .res_bytes(lt_bytes),
+    .res_bit_errors(lt_bit_errors),
+    .res_nacks(lt_nacks),
+    .res_retries(lt_retries),
+    .res_cycles(lt_cycles),
+    .m_start(lt_m_start),
+    .m_rw(lt_m_rw),
+    .m_addr(lt_m_addr),
+    .m_count(lt_m_count),
+    .m_tx_data(lt_m_tx_data),
+    .m_quarter(lt_m_quarter),
+    .m_tx_next(i2c_tx_next),
+    .m_rx_data(i2c_rx_data),
+    .m_rx_valid(i2c_rx_valid),
+    .m_done(i2c_done),
+    .m_ack_error(i2c_ack_error)
+);
+
+i2c_bus_scanner u_bus_scanner (
+    .clk(core_clk),
+    .rst_n(core_rstn),
+    .start(scan_start & ~bus_busy & ~spi_busy),
+    .first_addr(scan_first),
+    .last_addr(scan_last),
+    .busy(scan_busy),
+    .done(),
+    .present(scan_present),
+    .m_start(scan_m_start),
+    .m_addr(scan_m_addr),
+    .m_done(i2c_done),
+    .m_ack_error(i2c_ack_error)
+);
+
+i2c_reg_window u_reg_window (
+    .clk(core_clk),
+    .rst_n(core_rstn),
+    .req(win_req),
+    .req_read(win_read),
+    .req_addr(win_addr),
+    .req_reg(win_reg),
+    .req_data(win_data),
+    .grant(win_grant),
+    .busy(win_busy),
+    .owner(),
+    .ack(win_ack),
+    .rd_data(win_rd_data),
+    .nack(win_nack),
+    .m_start(win_m_start),
+    .m_rw(win_m_rw),
+    .m_addr(win_m_addr),
+    .m_count(win_m_count),
+    .m_tx_data(win_m_tx_data),
+    .m_hold(win_m_hold),
+    .m_tx_next(i2c_tx_next),
+    .m_rx_data(i2c_rx_data),
+    .m_rx_valid(i2c_rx_valid),
+    .m_done(i2c_done),
+    .m_ack_error(i2c_ack_error)
+);
+
+i2c_cmd_ports #(
+    .N_PORTS(4)
+) u_cmd_ports (
+    .clk(core_clk),
+    .rst_n(core_rstn),
+    .cmd_wr(port_wr),
+    .cmd_data(port_cmd),
+    .stat(port_stat),
+    .req(port_req),
+    .grant(arb_grant[5:2]),
+    .m_start(port_m_start),
+    .m_rw(port_m_rw),
+    .m_addr(port_m_addr),
+    .m_count(port_m_count),
+    .m_tx_data(port_m_tx_data),
+    .m_tx_next(i2c_tx_next & port_grant),
+    .m_rx_data(i2c_rx_data),
+    .m_rx_valid(i2c_rx_valid & port_grant),
+    .m_done(i2c_done & port_grant),
+    .m_ack_error(i2c_ack_error)
+);
 // User logic ends
 
 endmodule
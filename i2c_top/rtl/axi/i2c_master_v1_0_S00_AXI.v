@@ -10,18 +10,57 @@ module i2c_master_v1_0_S00_AXI #
     // Width of S_AXI data bus
     parameter integer C_S_AXI_DATA_WIDTH	= 32,
     // Width of S_AXI address bus
-    parameter integer C_S_AXI_ADDR_WIDTH	= 4
+    parameter integer C_S_AXI_ADDR_WIDTH	= 7
 )
 (
     // Users to add ports here
     output wire start,
     output wire rw_bit,
     output wire [6:0] slave_addr,
+    output wire [7:0] byte_count,
     output wire [7:0] tx_data,
+    input wire tx_next,
     input wire [7:0] rx_data,
+    input wire rx_valid,
     input wire busy,
     input wire done,
     input wire ack_error,
+    input wire timeout,
+    output wire pec_en,
+    output wire addr_only,
+    input wire pec_error,
+    output wire transport_spi,
+    output wire [7:0] spi_clk_div,
+    output wire [7:0] sample_point,
+    output wire lt_start,
+    output wire [6:0] lt_addr,
+    output wire [7:0] lt_blocks,
+    output wire [31:0] lt_speeds,
+    output wire [1:0] lt_sel,
+    input wire lt_busy,
+    input wire [31:0] lt_bytes,
+    input wire [31:0] lt_bit_errors,
+    input wire [15:0] lt_nacks,
+    input wire [15:0] lt_retries,
+    input wire [31:0] lt_cycles,
+    output wire scan_start,
+    output wire [6:0] scan_first,
+    output wire [6:0] scan_last,
+    input wire scan_busy,
+    input wire [127:0] scan_present,
+    input wire [6:0] bus_addr,
+    output wire [7:0] bus_quarter,
+    output wire win_posted,
+    input wire win_store_nack,
+    input wire bus_busy,
+    output wire [3:0] port_wr,
+    output wire [31:0] port_cmd,
+    input wire [127:0] port_stat,
+    output wire [11:0] arb_prio,
+    output wire ctl_hold,
+    output wire ctl_release,
+    output wire ctl_abort,
+    input wire ctl_held,
     // User ports ends
     // Do not modify the ports beyond this line
 
@@ -105,21 +144,63 @@ reg  	axi_rvalid;
 // ADDR_LSB = 2 for 32 bits (n downto 2)
 // ADDR_LSB = 3 for 64 bits (n downto 3)
 localparam integer ADDR_LSB = (C_S_AXI_DATA_WIDTH/32) + 1;
-localparam integer OPT_MEM_ADDR_BITS = 1;
+localparam integer OPT_MEM_ADDR_BITS = 4;
 //----------------------------------------------
 //-- Signals for user logic register space example
 //------------------------------------------------
-//-- Number of Slave Registers 4
+//-- Number of Slave Registers 7 (+ TX/RX FIFO ports at REG3/REG4,
+//-- link test results at REG8-REG11, speed table window at REG12,
+//-- scan bitmap at REG14-REG17, command ports at REG18-REG21)
 reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg0;
 reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg1;
 reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg2;
 reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg3;
+reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg5;
+reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg6;
+reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg7;
+reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg13;
+reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg22;
 wire	 slv_reg_rden;
 wire	 slv_reg_wren;
 reg [C_S_AXI_DATA_WIDTH-1:0]	 reg_data_out;
 integer	 byte_index;
 reg	 aw_en;
 
+// User FIFO signals (see user logic below)
+localparam integer FIFO_DEPTH = 16;
+localparam integer FIFO_AW    = 4;
+reg [7:0]         tx_fifo [0:FIFO_DEPTH-1];
+reg [FIFO_AW:0]   tx_wr_ptr;
+reg [FIFO_AW:0]   tx_rd_ptr;
+reg               tx_first;       // Next tx_next consumes REG0[15:8]
+wire [FIFO_AW:0]  tx_level = tx_wr_ptr - tx_rd_ptr;
+wire              tx_full  = (tx_level == FIFO_DEPTH);
+wire              tx_empty = (tx_level == 0);
+reg [7:0]         rx_fifo [0:FIFO_DEPTH-1];
+reg [FIFO_AW:0]   rx_wr_ptr;
+reg [FIFO_AW:0]   rx_rd_ptr;
+wire [FIFO_AW:0]  rx_level = rx_wr_ptr - rx_rd_ptr;
+wire              rx_empty = (rx_level == 0);
+wire              rx_full  = (rx_level == FIFO_DEPTH);
+wire [7:0]        rx_fifo_head = rx_fifo[rx_rd_ptr[FIFO_AW-1:0]];
+
+// Window store NACKed (STATUS[6], write 1 to clear)
+reg               win_error;
+
+// Timebase: free-running clk counter and its value at the last REG0 done
+reg [31:0]        tick_count;
+reg [31:0]        done_ticks;
+
+// Per-address SCL speed table (see user logic below)
+reg [7:0]         speed_table [0:127];
+reg [6:0]         speed_sel;
+integer           speed_index;
+
+initial begin
+  for (speed_index = 0; speed_index < 128; speed_index = speed_index + 1)
+    speed_table[speed_index] = 8'd0;
+end
+
 // I/O Connections assignments
 
 assign S_AXI_AWREADY	= axi_awready;
@@ -231,50 +312,98 @@ begin
       slv_reg1 <= 0;
       slv_reg2 <= 0;
       slv_reg3 <= 0;
+      slv_reg5 <= 32'h0000_0500;     // I2C, SPI clk_div = 5 (10 MHz)
+      slv_reg6 <= 32'h0000_04A0;     // Link test: 4 blocks, EEPROM 0x50
+      slv_reg7 <= 32'h0019_3EFA;     // Link test: 100 kHz, 400 kHz, 1 MHz (100 MHz core)
+      slv_reg13 <= 32'h0077_0800;    // Scan 0x08-0x77
+      slv_reg22 <= 32'h0000_0555;    // All requesters priority 1
     end
   else begin
     if (slv_reg_wren)
       begin
         case ( axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] )
-          2'h0:
+          5'h00:
             for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
               if ( S_AXI_WSTRB[byte_index] == 1 ) begin
                 // Respective byte enables are asserted as per write strobes
                 // Slave register 0
                 slv_reg0[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
               end
-          2'h1:
+          5'h01:
             for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
               if ( S_AXI_WSTRB[byte_index] == 1 ) begin
                 // Respective byte enables are asserted as per write strobes
                 // Slave register 1
                 slv_reg1[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
               end
-          2'h2:
+          5'h02:
             for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
               if ( S_AXI_WSTRB[byte_index] == 1 ) begin
                 // Respective byte enables are asserted as per write strobes
                 // Slave register 2
                 slv_reg2[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
               end
-          2'h3:
+          5'h03:
             for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
               if ( S_AXI_WSTRB[byte_index] == 1 ) begin
                 // Respective byte enables are asserted as per write strobes
                 // Slave register 3
                 slv_reg3[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
               end
+          5'h05:
+            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
+                // Respective byte enables are asserted as per write strobes
+                // Slave register 5
+                slv_reg5[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+              end
+          5'h06:
+            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
+                // Respective byte enables are asserted as per write strobes
+                // Slave register 6
+                slv_reg6[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+              end
+          5'h07:
+            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
+                // Respective byte enables are asserted as per write strobes
+                // Slave register 7
+                slv_reg7[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+              end
+          5'h0D:
+            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
+                // Respective byte enables are asserted as per write strobes
+                // Slave register 13
+                slv_reg13[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+              end
+          5'h16:
+            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
+                // Respective byte enables are asserted as per write strobes
+                // Slave register 22
+                slv_reg22[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+              end
           default : begin
                       slv_reg0 <= slv_reg0;
                       slv_reg1 <= slv_reg1;
                       slv_reg2 <= slv_reg2;
                       slv_reg3 <= slv_reg3;
+                      slv_reg5 <= slv_reg5;
+                      slv_reg6 <= slv_reg6;
+                      slv_reg7 <= slv_reg7;
+                      slv_reg13 <= slv_reg13;
+                      slv_reg22 <= slv_reg22;
                     end
         endcase
       end
     else begin
       // Update read-only status registers
-      slv_reg1 <= {29'h0, ack_error, done, busy};
+      slv_reg1 <= {6'h0, timeout, ctl_held,
+                   {(8-FIFO_AW-1){1'b0}}, rx_level,
+                   {(8-FIFO_AW-1){1'b0}}, tx_level,
+                   bus_busy, win_error, pec_error, rx_empty, tx_full, ack_error, done, busy};
       slv_reg2 <= {24'h0, rx_data};
     end
   end
@@ -382,10 +511,31 @@ always @(*)
 begin
       // Address decoding for reading registers
       case ( axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] )
-        2'h0   : reg_data_out <= slv_reg0;
-        2'h1   : reg_data_out <= slv_reg1;
-        2'h2   : reg_data_out <= slv_reg2;
-        2'h3   : reg_data_out <= slv_reg3;
+        5'h00   : reg_data_out <= slv_reg0;
+        5'h01   : reg_data_out <= slv_reg1;
+        5'h02   : reg_data_out <= slv_reg2;
+        5'h03   : reg_data_out <= slv_reg3;
+        5'h04   : reg_data_out <= {24'h0, rx_fifo_head};
+        5'h05   : reg_data_out <= slv_reg5;
+        5'h06   : reg_data_out <= {lt_busy, slv_reg6[30:1], 1'b0};
+        5'h07   : reg_data_out <= slv_reg7;
+        5'h08   : reg_data_out <= lt_bytes;
+        5'h09   : reg_data_out <= lt_bit_errors;
+        5'h0A   : reg_data_out <= {lt_retries, lt_nacks};
+        5'h0B   : reg_data_out <= lt_cycles;
+        5'h0C   : reg_data_out <= {17'h0, speed_sel, speed_table[speed_sel]};
+        5'h0D   : reg_data_out <= {slv_reg13[31:8], scan_busy, 7'h0};
+        5'h0E   : reg_data_out <= scan_present[31:0];
+        5'h0F   : reg_data_out <= scan_present[63:32];
+        5'h10   : reg_data_out <= scan_present[95:64];
+        5'h11   : reg_data_out <= scan_present[127:96];
+        5'h12   : reg_data_out <= port_stat[31:0];
+        5'h13   : reg_data_out <= port_stat[63:32];
+        5'h14   : reg_data_out <= port_stat[95:64];
+        5'h15   : reg_data_out <= port_stat[127:96];
+        5'h16   : reg_data_out <= {20'h0, slv_reg22[11:0]};
+        5'h17   : reg_data_out <= tick_count;
+        5'h18   : reg_data_out <= done_ticks;
         default : reg_data_out <= 0;
       endcase
 end
@@ -414,26 +564,137 @@ end
 //==============================================================================
 // I2C Master Control Register Mapping
 //==============================================================================
-// REG0 (0x00): Control Register (Write triggers START)
-//   [15:8] - tx_data[7:0]
-//   [7:1]  - slave_addr[6:0]
-//   [0]    - rw_bit
+// REG0 (0x00): Control Register (Write triggers START, flushes RX FIFO)
+//   [26]    - hold (no STOP: the bus stays with REG0 and the next REG0
+//             write starts with a repeated START; NACK still ends with STOP)
+//   [25]    - addr_only (probe / quick command: START-ADDR-ACK-STOP,
+//             ack_error = no device; use with rw_bit = 0)
+//   [24]    - pec_en (SMBus PEC appended on write / checked on read)
+//   [23:16] - byte_count (0 or 1 = single byte)
+//   [15:8]  - tx_data[7:0] (first write byte)
+//   [7:1]   - slave_addr[6:0]
+//   [0]     - rw_bit
 //
 // REG1 (0x04): Status Register (Read-only)
-//   [2]    - ack_error
-//   [1]    - done
-//   [0]    - busy
+//   [25]    - timeout (a slave stretched SCL past I2C_STRETCH_TIMEOUT; the
+//             transaction was dropped without STOP, ack_error is set too);
+//             write 1 to abort the REG0 transaction (pending, running or
+//             held): lines released, done with ack_error, timeout stays 0
+//   [24]    - held (REG0 hold transaction done, bus kept for the next REG0)
+//   [23:16] - rx_level (bytes in RX FIFO)
+//   [15:8]  - tx_level (bytes in TX FIFO)
+//   [7]     - bus_busy (i2c_master used by any requester or engine)
+//   [6]     - win_error (window store NACKed, write 1 to clear)
+//   [5]     - pec_error (read PEC mismatch)
+//   [4]     - rx_empty
+//   [3]     - tx_full
+//   [2]     - ack_error
+//   [1]     - done
+//   [0]     - busy (REG0 transaction, SPI, link test or scan);
+//             write 1 to release a held bus with a STOP
+//   REG0 transactions wait for the arbiter grant; [5:1] and REG2 only
+//   reflect REG0 transactions, never window or command port traffic
 //
 // REG2 (0x08): RX Data Register (Read-only)
-//   [7:0]  - rx_data[7:0]
+//   [7:0]  - rx_data[7:0] (last received byte)
+//
+// REG3 (0x0C): TX FIFO (Write-only, write pushes)
+//   [7:0]  - write bytes 2..byte_count, loaded before REG0 is written
+//
+// REG4 (0x10): RX FIFO (Read-only, read pops)
+//   [7:0]  - received bytes in bus order
+//
+// REG5 (0x14): Transport Config (Read/Write, change only while idle)
+//   [23:16] - I2C SDA sample point, clk after SCL rise (0 = default)
+//   [15:8] - SPI SCK half period in clk cycles (reset 5 = 10 MHz, min 4)
+//   [1]    - register window stores posted (0 = BVALID after the I2C write)
+//   [0]    - transport (0 = I2C, 1 = SPI to slave_register_map)
+//            SPI ignores REG0[7:1] and REG0[24]; REG0[15:8] is the register
+//            byte, ack_error / pec_error stay 0
 //
-// REG3 (0x0C): Reserved
+// REG6 (0x18): Link Test Control (Read/Write)
+//   [31]    - busy (read-only; REG1 busy is also set while testing)
+//   [17:16] - result select (speed index for REG8-REG11)
+//   [15:8]  - blocks per speed (BLOCK_LEN bytes each, 0 = 1)
+//   [7:1]   - loopback slave address (reset 0x50, EEPROM)
+//   [0]     - write 1 to start (reads 0)
+//
+// REG7 (0x1C): Link Test Speeds (Read/Write)
+//   [8*i +: 8] - quarter SCL period of speed i in clk (0 = skip)
+//                reset 250 / 62 / 25 / off = 100 kHz / 400 kHz / 1 MHz
+//                (at a 100 MHz I2C core clock)
+//
+// REG8  (0x20): Link Test Bytes verified          (Read-only, selected speed)
+// REG9  (0x24): Link Test Bit errors              (Read-only, selected speed)
+// REG10 (0x28): Link Test [31:16] retries, [15:0] NACKs
+// REG11 (0x2C): Link Test clk cycles at the speed (Read-only, selected speed)
+//
+// REG12 (0x30): Speed Table (Read/Write, one entry per 7-bit address)
+//   [14:8]  - slave address (write selects the entry)
+//   [7:0]   - quarter SCL period in clk for that address (0 = I2C_SCL_FREQ)
+//             written when bytes 0 and 1 are strobed together; read returns
+//             the entry of the last selected address
+//
+// REG13 (0x34): Bus Scan Control (Read/Write)
+//   [22:16] - last address (reset 0x77)
+//   [14:8]  - first address (reset 0x08)
+//   [7]     - busy (read-only; REG1 busy is also set while scanning)
+//   [0]     - write 1 to start (reads 0)
+//
+// REG14-REG17 (0x38-0x44): Scan Bitmap (Read-only)
+//   bit n of REG(14 + k) = address 32*k + n ACKed an address-only probe
+//
+// REG18-REG21 (0x48-0x54): Command Ports 0-3 (write = command, read = status)
+//   Write: [31:24] second write byte, [23:16] first write byte,
+//          [9:8] write byte count (0/1 = one, 2 = two), [7:1] address, [0] rw
+//   Read : [31] pending, [30] running, [10] overrun (command dropped),
+//          [9] done, [8] ack_error, [7:0] received byte
+//   Each port is an independent requester (see i2c_cmd_ports.sv)
+//
+// REG22 (0x58): Arbiter Priorities (Read/Write, 2 bits each, 3 = highest)
+//   [1:0] REG0, [3:2] register window, [5:4]-[11:10] command ports 0-3
+//   Highest pending priority wins when i2c_master frees up, equal
+//   priorities take turns; reset 0x555 (all 1, round robin)
+//
+// REG23 (0x5C): Tick Counter (Read-only)
+//   [31:0]  - clk cycles since reset, free running (wraps)
+//
+// REG24 (0x60): Done Tick (Read-only)
+//   [31:0]  - REG23 value when the last REG0 transaction finished (done)
+//
+// S01_AXI: Register window, see i2c_master_v1_0_S01_AXI.v
 //==============================================================================
 
 // Extract control signals from slv_reg0
 assign rw_bit = slv_reg0[0];
 assign slave_addr = slv_reg0[7:1];
-assign tx_data = slv_reg0[15:8];
+assign byte_count = slv_reg0[23:16];
+assign pec_en = slv_reg0[24];
+assign addr_only = slv_reg0[25];
+assign ctl_hold = slv_reg0[26];
+
+// Transport selection (muxed in i2c_master_v1_0)
+assign transport_spi = slv_reg5[0];
+assign spi_clk_div = slv_reg5[15:8];
+assign sample_point = slv_reg5[23:16];
+assign win_posted = slv_reg5[1];
+
+// Link test (i2c_link_tester in i2c_master_v1_0)
+assign lt_addr   = slv_reg6[7:1];
+assign lt_blocks = slv_reg6[15:8];
+assign lt_sel    = slv_reg6[17:16];
+assign lt_speeds = slv_reg7;
+
+// Speed of the slave addressed by the granted requester, latched by
+// i2c_master at START
+assign bus_quarter = speed_table[bus_addr];
+
+// Arbiter priorities (i2c_arbiter in i2c_master_v1_0)
+assign arb_prio = slv_reg22[11:0];
+
+// Bus scan (i2c_bus_scanner in i2c_master_v1_0)
+assign scan_first = slv_reg13[14:8];
+assign scan_last  = slv_reg13[22:16];
 
 // Generate start pulse when REG0 is written
 reg start_trigger;
@@ -441,7 +702,7 @@ always @(posedge S_AXI_ACLK) begin
     if (S_AXI_ARESETN == 1'b0) begin
         start_trigger <= 1'b0;
     end else begin
-        if (slv_reg_wren && (axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 2'h0)) begin
+        if (slv_reg_wren && (axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 5'h00)) begin
             start_trigger <= 1'b1;
         end else begin
             start_trigger <= 1'b0;
@@ -451,6 +712,177 @@ end
 
 assign start = start_trigger;
 
+// Held bus release pulse when REG1 is written with [0] = 1
+reg ctl_release_trigger;
+always @(posedge S_AXI_ACLK) begin
+    if (S_AXI_ARESETN == 1'b0) begin
+        ctl_release_trigger <= 1'b0;
+    end else begin
+        ctl_release_trigger <= slv_reg_wren && S_AXI_WSTRB[0] && S_AXI_WDATA[0] &&
+                               (axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 5'h01);
+    end
+end
+
+assign ctl_release = ctl_release_trigger;
+
+// REG0 transaction abort pulse when REG1 is written with [25] = 1
+reg ctl_abort_trigger;
+always @(posedge S_AXI_ACLK) begin
+    if (S_AXI_ARESETN == 1'b0) begin
+        ctl_abort_trigger <= 1'b0;
+    end else begin
+        ctl_abort_trigger <= slv_reg_wren && S_AXI_WSTRB[3] && S_AXI_WDATA[25] &&
+                             (axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 5'h01);
+    end
+end
+
+assign ctl_abort = ctl_abort_trigger;
+
+// Link test start pulse when REG6 is written with [0] = 1
+reg lt_start_trigger;
+always @(posedge S_AXI_ACLK) begin
+    if (S_AXI_ARESETN == 1'b0) begin
+        lt_start_trigger <= 1'b0;
+    end else begin
+        lt_start_trigger <= slv_reg_wren && S_AXI_WSTRB[0] && S_AXI_WDATA[0] &&
+                            (axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 5'h06);
+    end
+end
+
+assign lt_start = lt_start_trigger;
+
+// Scan start pulse when REG13 is written with [0] = 1
+reg scan_start_trigger;
+always @(posedge S_AXI_ACLK) begin
+    if (S_AXI_ARESETN == 1'b0) begin
+        scan_start_trigger <= 1'b0;
+    end else begin
+        scan_start_trigger <= slv_reg_wren && S_AXI_WSTRB[0] && S_AXI_WDATA[0] &&
+                              (axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 5'h0D);
+    end
+end
+
+assign scan_start = scan_start_trigger;
+
+// Command port write pulses (REG18-REG21), command word registered alongside
+reg [3:0]  port_wr_trigger;
+reg [31:0] port_cmd_reg;
+always @(posedge S_AXI_ACLK) begin
+    if (S_AXI_ARESETN == 1'b0) begin
+        port_wr_trigger <= 4'b0;
+        port_cmd_reg    <= 32'h0;
+    end else begin
+        port_wr_trigger[0] <= slv_reg_wren && S_AXI_WSTRB[0] &&
+                              (axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 5'h12);
+        port_wr_trigger[1] <= slv_reg_wren && S_AXI_WSTRB[0] &&
+                              (axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 5'h13);
+        port_wr_trigger[2] <= slv_reg_wren && S_AXI_WSTRB[0] &&
+                              (axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 5'h14);
+        port_wr_trigger[3] <= slv_reg_wren && S_AXI_WSTRB[0] &&
+                              (axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 5'h15);
+        if (slv_reg_wren)
+            port_cmd_reg <= S_AXI_WDATA;
+    end
+end
+
+assign port_wr  = port_wr_trigger;
+assign port_cmd = port_cmd_reg;
+
+//------------------------------------------------------------------------------
+// TX FIFO: first byte comes from REG0[15:8], the rest from the FIFO
+//------------------------------------------------------------------------------
+wire              tx_push  = slv_reg_wren && S_AXI_WSTRB[0] && !tx_full &&
+                             (axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 5'h03);
+
+always @(posedge S_AXI_ACLK) begin
+    if (S_AXI_ARESETN == 1'b0) begin
+        tx_wr_ptr <= 0;
+        tx_rd_ptr <= 0;
+        tx_first  <= 1'b0;
+    end else begin
+        if (tx_push) begin
+            tx_fifo[tx_wr_ptr[FIFO_AW-1:0]] <= S_AXI_WDATA[7:0];
+            tx_wr_ptr <= tx_wr_ptr + 1;
+        end
+
+        if (slv_reg_wren && (axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 5'h00)) begin
+            tx_first <= 1'b1;
+        end else if (tx_next) begin
+            if (tx_first)
+                tx_first <= 1'b0;
+            else if (!tx_empty)
+                tx_rd_ptr <= tx_rd_ptr + 1;
+        end
+    end
+end
+
+assign tx_data = tx_first ? slv_reg0[15:8] : tx_fifo[tx_rd_ptr[FIFO_AW-1:0]];
+
+//------------------------------------------------------------------------------
+// RX FIFO: every received byte is pushed, REG4 reads pop
+//------------------------------------------------------------------------------
+always @(posedge S_AXI_ACLK) begin
+    if (S_AXI_ARESETN == 1'b0) begin
+        rx_wr_ptr <= 0;
+        rx_rd_ptr <= 0;
+    end else if (slv_reg_wren && (axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 5'h00)) begin
+        // New transaction: drop stale bytes
+        rx_rd_ptr <= rx_wr_ptr;
+    end else begin
+        if (rx_valid && !rx_full) begin
+            rx_fifo[rx_wr_ptr[FIFO_AW-1:0]] <= rx_data;
+            rx_wr_ptr <= rx_wr_ptr + 1;
+        end
+
+        if (slv_reg_rden && !rx_empty &&
+            (axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 5'h04)) begin
+            rx_rd_ptr <= rx_rd_ptr + 1;
+        end
+    end
+end
+
+//------------------------------------------------------------------------------
+// Window error: set by a NACKed window store, REG1 write with [6] = 1 clears
+//------------------------------------------------------------------------------
+always @(posedge S_AXI_ACLK) begin
+    if (S_AXI_ARESETN == 1'b0) begin
+        win_error <= 1'b0;
+    end else if (win_store_nack) begin
+        win_error <= 1'b1;
+    end else if (slv_reg_wren && S_AXI_WSTRB[0] && S_AXI_WDATA[6] &&
+                 (axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 5'h01)) begin
+        win_error <= 1'b0;
+    end
+end
+
+//------------------------------------------------------------------------------
+// Timebase: REG23 counts clk, REG24 stamps REG0 completion
+//------------------------------------------------------------------------------
+always @(posedge S_AXI_ACLK) begin
+    if (S_AXI_ARESETN == 1'b0) begin
+        tick_count <= 32'd0;
+        done_ticks <= 32'd0;
+    end else begin
+        tick_count <= tick_count + 32'd1;
+        if (done)
+            done_ticks <= tick_count;
+    end
+end
+
+//------------------------------------------------------------------------------
+// Speed table: REG12 writes {address, quarter}, a byte-1-only write selects
+//------------------------------------------------------------------------------
+always @(posedge S_AXI_ACLK) begin
+    if (S_AXI_ARESETN == 1'b0) begin
+        speed_sel <= 7'd0;
+    end else if (slv_reg_wren && S_AXI_WSTRB[1] &&
+                 (axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 5'h0C)) begin
+        speed_sel <= S_AXI_WDATA[14:8];
+        if (S_AXI_WSTRB[0])
+            speed_table[S_AXI_WDATA[14:8]] <= S_AXI_WDATA[7:0];
+    end
+end
+
 // User logic ends
 
 endmodule
@@ -0,0 +1,273 @@
+`timescale 1 ns / 1 ps
+
+module i2c_master_v1_0_S01_AXI #
+(
+    // Users to add parameters here
+
+    // User parameters ends
+    // Do not modify the parameters beyond this line
+
+    // Width of S_AXI data bus
+    parameter integer C_S_AXI_DATA_WIDTH	= 32,
+    // Width of S_AXI address bus
+    parameter integer C_S_AXI_ADDR_WIDTH	= 17
+)
+(
+    // Users to add ports here
+    output wire win_req,
+    output wire win_read,
+    output wire [6:0] win_addr,
+    output wire [7:0] win_reg,
+    output wire [7:0] win_data,
+    input wire win_ack,
+    input wire [7:0] win_rd_data,
+    input wire win_nack,
+    input wire win_posted,
+    output wire win_store_nack,
+    // User ports ends
+    // Do not modify the ports beyond this line
+
+    // Global Clock Signal
+    input wire  S_AXI_ACLK,
+    // Global Reset Signal. This Signal is Active LOW
+    input wire  S_AXI_ARESETN,
+    // Write address (issued by master, acceped by Slave)
+    input wire [C_S_AXI_ADDR_WIDTH-1 : 0] S_AXI_AWADDR,
+    // Write channel Protection type
+    input wire [2 : 0] S_AXI_AWPROT,
+    // Write address valid
+    input wire  S_AXI_AWVALID,
+    // Write address ready
+    output wire  S_AXI_AWREADY,
+    // Write data (issued by master, acceped by Slave)
+    input wire [C_S_AXI_DATA_WIDTH-1 : 0] S_AXI_WDATA,
+    // Write strobes
+    input wire [(C_S_AXI_DATA_WIDTH/8)-1 : 0] S_AXI_WSTRB,
+    // Write valid
+    input wire  S_AXI_WVALID,
+    // Write ready
+    output wire  S_AXI_WREADY,
+    // Write response
+    output wire [1 : 0] S_AXI_BRESP,
+    // Write response valid
+    output wire  S_AXI_BVALID,
+    // Response ready
+    input wire  S_AXI_BREADY,
+    // Read address (issued by master, acceped by Slave)
+    input wire [C_S_AXI_ADDR_WIDTH-1 : 0] S_AXI_ARADDR,
+    // Protection type
+    input wire [2 : 0] S_AXI_ARPROT,
+    // Read address valid
+    input wire  S_AXI_ARVALID,
+    // Read address ready
+    output wire  S_AXI_ARREADY,
+    // Read data (issued by slave)
+    output wire [C_S_AXI_DATA_WIDTH-1 : 0] S_AXI_RDATA,
+    // Read response
+    output wire [1 : 0] S_AXI_RRESP,
+    // Read valid
+    output wire  S_AXI_RVALID,
+    // Read ready
+    input wire  S_AXI_RREADY
+);
+
+//==============================================================================
+// I2C Register Window (S01_AXI)
+//==============================================================================
+// Every 32-bit word maps to one register of one I2C slave:
+//   offset = {slave_addr[6:0], reg[7:0], 2'b00}   (128 KB window)
+//
+// Load  : [START][ADDR+W][REG][Sr][ADDR+R][DATA][STOP]
+//         RVALID is held until the I2C read completes (stalling)
+//         RDATA [7:0] = register value, [8] = NACK (RRESP = SLVERR, [7:0] = FF)
+// Store : [START][ADDR+W][REG][WDATA[7:0]][STOP], only when WSTRB[0] is set
+//         REG5[1] = 0: BVALID after the I2C write (NACK -> BRESP = SLVERR)
+//         REG5[1] = 1: posted, BVALID right away
+//         Either way a NACKed store sets STATUS[6] (write 1 to clear)
+//
+// One access is in flight at a time: the next load or store waits in the
+// AXI handshake until the previous one is done on the bus, so accesses
+// reach the slaves in program order. Each access takes the SCL rate of the
+// slave's speed table entry (REG12).
+//==============================================================================
+
+localparam integer ADDR_LSB = (C_S_AXI_DATA_WIDTH/32) + 1;
+
+localparam [1:0] RESP_OKAY   = 2'b00;
+localparam [1:0] RESP_SLVERR = 2'b10;
+
+// AXI4LITE signals
+reg  	axi_awready;
+reg  	axi_wready;
+reg [1 : 0] 	axi_bresp;
+reg  	axi_bvalid;
+reg  	axi_arready;
+reg [C_S_AXI_DATA_WIDTH-1 : 0] 	axi_rdata;
+reg [1 : 0] 	axi_rresp;
+reg  	axi_rvalid;
+reg	 aw_en;
+reg	 ar_en;
+
+// Window access in flight
+reg          inflight;       // Request issued, win_ack not yet seen
+reg          inflight_read;  // ... it is a load
+reg          inflight_post;  // ... it is a posted store
+reg          req_reg;
+reg [6:0]    addr_reg;
+reg [7:0]    reg_reg;
+reg [7:0]    data_reg;
+
+wire wr_go = ~axi_awready && S_AXI_AWVALID && S_AXI_WVALID && aw_en && ~inflight;
+wire rd_go = ~axi_arready && S_AXI_ARVALID && ar_en && ~inflight && ~wr_go;
+wire wr_hs = axi_awready && S_AXI_AWVALID && axi_wready && S_AXI_WVALID;
+
+// I/O Connections assignments
+
+assign S_AXI_AWREADY	= axi_awready;
+assign S_AXI_WREADY	= axi_wready;
+assign S_AXI_BRESP	= axi_bresp;
+assign S_AXI_BVALID	= axi_bvalid;
+assign S_AXI_ARREADY	= axi_arready;
+assign S_AXI_RDATA	= axi_rdata;
+assign S_AXI_RRESP	= axi_rresp;
+assign S_AXI_RVALID	= axi_rvalid;
+
+assign win_req       = req_reg;
+assign win_read      = inflight_read;
+assign win_addr      = addr_reg;
+assign win_reg       = reg_reg;
+assign win_data      = data_reg;
+assign win_store_nack = win_ack && win_nack && ~inflight_read;
+
+// Address / data acceptance
+// Write address and data are taken together (one cycle of AWREADY and
+// WREADY) and only when no window access is in flight.
+
+always @( posedge S_AXI_ACLK )
+begin
+  if ( S_AXI_ARESETN == 1'b0 )
+    begin
+      axi_awready <= 1'b0;
+      axi_wready  <= 1'b0;
+      axi_arready <= 1'b0;
+      aw_en <= 1'b1;
+      ar_en <= 1'b1;
+    end
+  else
+    begin
+      axi_awready <= wr_go;
+      axi_wready  <= wr_go;
+      axi_arready <= rd_go;
+
+      if (wr_go)
+        aw_en <= 1'b0;
+      else if (S_AXI_BREADY && axi_bvalid)
+        aw_en <= 1'b1;
+
+      if (rd_go)
+        ar_en <= 1'b0;
+      else if (S_AXI_RREADY && axi_rvalid)
+        ar_en <= 1'b1;
+    end
+end
+
+// Window request: issued when the address is accepted
+
+always @( posedge S_AXI_ACLK )
+begin
+  if ( S_AXI_ARESETN == 1'b0 )
+    begin
+      req_reg       <= 1'b0;
+      inflight      <= 1'b0;
+      inflight_read <= 1'b0;
+      inflight_post <= 1'b0;
+      addr_reg      <= 7'd0;
+      reg_reg       <= 8'd0;
+      data_reg      <= 8'd0;
+    end
+  else
+    begin
+      req_reg <= 1'b0;
+
+      if (wr_go && S_AXI_WSTRB[0])
+        begin
+          req_reg       <= 1'b1;
+          inflight      <= 1'b1;
+          inflight_read <= 1'b0;
+          inflight_post <= win_posted;
+          addr_reg      <= S_AXI_AWADDR[ADDR_LSB+14:ADDR_LSB+8];
+          reg_reg       <= S_AXI_AWADDR[ADDR_LSB+7:ADDR_LSB];
+          data_reg      <= S_AXI_WDATA[7:0];
+        end
+      else if (rd_go)
+        begin
+          req_reg       <= 1'b1;
+          inflight      <= 1'b1;
+          inflight_read <= 1'b1;
+          inflight_post <= 1'b0;
+          addr_reg      <= S_AXI_ARADDR[ADDR_LSB+14:ADDR_LSB+8];
+          reg_reg       <= S_AXI_ARADDR[ADDR_LSB+7:ADDR_LSB];
+        end
+      else if (win_ack)
+        begin
+          inflight      <= 1'b0;
+          inflight_post <= 1'b0;
+        end
+    end
+end
+
+// Write response: right away when posted (or nothing to write),
+// otherwise when the I2C write is done
+
+always @( posedge S_AXI_ACLK )
+begin
+  if ( S_AXI_ARESETN == 1'b0 )
+    begin
+      axi_bvalid  <= 0;
+      axi_bresp   <= 2'b0;
+    end
+  else
+    begin
+      if (wr_hs && (inflight_post || ~S_AXI_WSTRB[0]))
+        begin
+          axi_bvalid <= 1'b1;
+          axi_bresp  <= RESP_OKAY;
+        end
+      else if (win_ack && inflight && ~inflight_read && ~inflight_post)
+        begin
+          axi_bvalid <= 1'b1;
+          axi_bresp  <= win_nack ? RESP_SLVERR : RESP_OKAY;
+        end
+      else if (S_AXI_BREADY && axi_bvalid)
+        begin
+          axi_bvalid <= 1'b0;
+        end
+    end
+end
+
+// Read response: when the I2C read is done
+
+always @( posedge S_AXI_ACLK )
+begin
+  if ( S_AXI_ARESETN == 1'b0 )
+    begin
+      axi_rvalid <= 0;
+      axi_rresp  <= 0;
+      axi_rdata  <= 0;
+    end
+  else
+    begin
+      if (win_ack && inflight && inflight_read)
+        begin
+          axi_rvalid <= 1'b1;
+          axi_rresp  <= win_nack ? RESP_SLVERR : RESP_OKAY;
+          axi_rdata  <= {{(C_S_AXI_DATA_WIDTH-9){1'b0}}, win_nack, win_rd_data};
+        end
+      else if (axi_rvalid && S_AXI_RREADY)
+        begin
+          axi_rvalid <= 1'b0;
+        end
+    end
+end
+
+endmodule
@@ -21,11 +21,12 @@ module board_master_top (
     input  logic       rst_n,            // Active-low reset (BTN)
 
     // I2C Bus (PMOD JA - outputs to slave board)
-    output logic       scl,              // I2C clock (to slave board)
+    inout  logic       scl,              // I2C clock (open-drain, slaves may stretch)
     inout  logic       sda,              // I2C data (bidirectional)
 
     // Control Interface (from buttons/switches for testing)
     input  logic       btn_start,        // Start transaction
+    input  logic       btn_test,         // Start link test (EEPROM 0x50)
     input  logic [15:0] SW,              // SW[15]: R/W, SW[14:8]: Addr, SW[7:0]: Data
     output logic [15:0] LED              // LED outputs (see LED Status Outputs section)
 );
@@ -47,6 +48,24 @@ module board_master_top (
     logic        btn_prev;
     logic        btn_pulse;
 
+    // Link test (PRBS loopback against the slave board EEPROM)
+    localparam logic [6:0]  LT_ADDR   = 7'h50;
+    localparam logic [7:0]  LT_BLOCKS = 8'd32;            // 256 bytes per speed
+    localparam logic [31:0] LT_SPEEDS = 32'h0019_3EFA;    // 100k/400k/1M, -
+
+    logic [2:0]  btn_test_sync;
+    logic        btn_test_prev;
+    logic        test_view;             // LEDs show link test results
+    logic        lt_busy;
+    logic [31:0] lt_bit_errors;
+    logic [31:0] lt_bytes;
+    logic [3:0]  lt_pass;               // Speed had traffic and no errors
+    logic        lt_start, lt_done;
+    logic        lt_m_start, lt_m_rw;
+    logic [6:0]  lt_m_addr;
+    logic [7:0]  lt_m_count, lt_m_tx_data, lt_m_quarter;
+    logic        tx_next, rx_valid;
+
     // Debug signals (optional - can route to LEDs for debugging)
     logic        debug_busy;
     logic        debug_ack;
@@ -69,7 +88,28 @@ module board_master_top (
     end
 
     assign btn_pulse = btn_sync[2] & ~btn_prev;
-    assign start = btn_pulse;
+    assign start = btn_pulse & ~lt_busy;
+
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            btn_test_sync <= 3'b000;
+            btn_test_prev <= 1'b0;
+            test_view     <= 1'b0;
+            lt_pass       <= 4'b0000;
+        end else begin
+            btn_test_sync <= {btn_test_sync[1:0], btn_test};
+            btn_test_prev <= btn_test_sync[2];
+
+            if (lt_start)       test_view <= 1'b1;
+            else if (start)     test_view <= 1'b0;
+
+            // Sample each speed's verdict while the results mux walks SW[1:0]
+            if (lt_start)      lt_pass <= 4'b0000;
+            else if (!lt_busy) lt_pass[SW[1:0]] <= (lt_bytes != 0) && (lt_bit_errors == 0);
+        end
+    end
+
+    assign lt_start = btn_test_sync[2] & ~btn_test_prev & ~busy & ~lt_busy;
 
     //==========================================================================
     // Control from Switches
@@ -81,17 +121,30 @@ module board_master_top (
     //==========================================================================
     // LED Status Outputs
     //==========================================================================
-    assign LED[7:0]  = rx_data;         // Received data from I2C read
-    assign LED[8]    = busy;            // Master busy status
-    assign LED[9]    = done;            // Transaction done pulse
-    assign LED[10]   = ack_error;       // NACK or error
-
-    // Debug outputs (optional - uncomment to use)
-    assign LED[11]   = debug_ack;       // ACK received from slave
-    assign LED[12]   = debug_scl;       // SCL line monitor
-    assign LED[13]   = debug_sda_out;   // SDA output value
-    assign LED[14]   = debug_sda_oe;    // SDA output enable
-    assign LED[15]   = (debug_state != 5'd0); // Non-IDLE state indicator
+    // Test view (after btn_test, until the next btn_start):
+    //   LED[7:0]  = bit errors at speed SW[1:0] (saturated)
+    //   LED[11:8] = per-speed pass (select each speed once with SW[1:0])
+    //   LED[15]   = link test running
+    always_comb begin
+        if (test_view) begin
+            LED        = 16'h0000;
+            LED[7:0]   = (lt_bit_errors > 32'd255) ? 8'hFF : lt_bit_errors[7:0];
+            LED[11:8]  = lt_pass;
+            LED[15]    = lt_busy;
+        end else begin
+            LED[7:0]   = rx_data;           // Received data from I2C read
+            LED[8]     = busy;              // Master busy status
+            LED[9]     = done;              // Transaction done pulse
+            LED[10]    = ack_error;         // NACK or error
+
+            // Debug outputs (optional - uncomment to use)
+            LED[11]    = debug_ack;         // ACK received from slave
+            LED[12]    = debug_scl;         // SCL line monitor
+            LED[13]    = debug_sda_out;     // SDA output value
+            LED[14]    = debug_sda_oe;      // SDA output enable
+            LED[15]    = (debug_state != 5'd0); // Non-IDLE state indicator
+        end
+    end
 
     //==========================================================================
     // I2C Master Instance
@@ -99,14 +152,25 @@ module board_master_top (
     i2c_master master (
         .clk(clk),
         .rst_n(rst_n),
-        .start(start),
-        .rw_bit(rw_bit),
-        .slave_addr(slave_addr),
-        .tx_data(tx_data),
+        .start(lt_busy ? lt_m_start : start),
+        .rw_bit(lt_busy ? lt_m_rw : rw_bit),
+        .slave_addr(lt_busy ? lt_m_addr : slave_addr),
+        .byte_count(lt_busy ? lt_m_count : 8'd1),
+        .tx_data(lt_busy ? lt_m_tx_data : tx_data),
+        .tx_next(tx_next),
         .rx_data(rx_data),
+        .rx_valid(rx_valid),
         .busy(busy),
         .done(done),
         .ack_error(ack_error),
+        .timeout(),
+        .pec_en(1'b0),
+        .pec_error(),
+        .sample_point(8'd0),
+        .scl_quarter(lt_busy ? lt_m_quarter : 8'd0),
+        .addr_only(1'b0),
+        .hold(1'b0),
+        .abort(1'b0),
         .sda(sda),
         .scl(scl),
         .debug_busy(debug_busy),
@@ -117,6 +181,37 @@ module board_master_top (
         .debug_sda_oe(debug_sda_oe)
     );
 
+    //==========================================================================
+    // Link Tester Instance
+    //==========================================================================
+    i2c_link_tester link_tester (
+        .clk(clk),
+        .rst_n(rst_n),
+        .start(lt_start),
+        .slave_addr(LT_ADDR),
+        .blocks(LT_BLOCKS),
+        .speeds(LT_SPEEDS),
+        .busy(lt_busy),
+        .done(lt_done),
+        .res_sel(SW[1:0]),
+        .res_bytes(lt_bytes),
+        .res_bit_errors(lt_bit_errors),
+        .res_nacks(),
+        .res_retries(),
+        .res_cycles(),
+        .m_start(lt_m_start),
+        .m_rw(lt_m_rw),
+        .m_addr(lt_m_addr),
+        .m_count(lt_m_count),
+        .m_tx_data(lt_m_tx_data),
+        .m_quarter(lt_m_quarter),
+        .m_tx_next(tx_next),
+        .m_rx_data(rx_data),
+        .m_rx_valid(rx_valid),
+        .m_done(done),
+        .m_ack_error(ack_error)
+    );
+
 endmodule
 
 //==============================================================================
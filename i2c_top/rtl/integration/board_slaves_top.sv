@@ -1,12 +1,13 @@
 `timescale 1ns / 1ps
 
 //==============================================================================
-// Board #2: I2C Slaves Top Module (3 Slaves)
+// Board #2: I2C Slaves Top Module (4 Slaves)
 //==============================================================================
-// For multi-board configuration: This board has 3 I2C slaves
+// For multi-board configuration: This board has 4 I2C slaves
 //  - LED Slave (0x55)
 //  - FND Slave (0x56)
 //  - Switch Slave (0x57)
+//  - EEPROM Slave (0x50, 256-byte bulk-transfer target)
 //
 // Connection via PMOD:
 //  - JA1: SCL (input from Master board)
@@ -44,6 +45,8 @@ module board_slaves_top (
     logic [3:0] debug_state_fnd;
     logic       debug_addr_match_sw;
     logic [3:0] debug_state_sw;
+    logic       debug_addr_match_eeprom;
+    logic       eeprom_write_busy;
 
     //==========================================================================
     // LED Outputs
@@ -58,7 +61,8 @@ module board_slaves_top (
     assign LED[11]   = (debug_state_led != 4'd0);  // LED slave active
     assign LED[12]   = (debug_state_fnd != 4'd0);  // FND slave active
     assign LED[13]   = (debug_state_sw != 4'd0);   // Switch slave active
-    assign LED[15:14] = 2'b00;  // Unused
+    assign LED[14]   = debug_addr_match_eeprom;  // EEPROM slave addressed
+    assign LED[15]   = eeprom_write_busy;        // EEPROM write cycle
 
     //==========================================================================
     // LED Slave (Address: 0x55)
@@ -100,4 +104,17 @@ module board_slaves_top (
         .debug_state(debug_state_sw)
     );
 
+    //==========================================================================
+    // EEPROM Slave (Address: 0x50)
+    //==========================================================================
+    i2c_eeprom_slave eeprom_slave (
+        .clk(clk),
+        .rst_n(rst_n),
+        .scl(scl),
+        .sda(sda),
+        .write_busy(eeprom_write_busy),
+        .debug_addr_match(debug_addr_match_eeprom),
+        .debug_state()
+    );
+
 endmodule
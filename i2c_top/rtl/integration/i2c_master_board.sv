@@ -34,10 +34,21 @@ module i2c_master_board (
         .start      (start),
         .slave_addr (slave_addr),
         .rw_bit     (rw_bit),
+        .byte_count (8'd1),
         .tx_data    (tx_data),
+        .tx_next    (),
+        .rx_valid   (),
         .busy       (busy),
         .done       (done),
         .ack_error  (ack_error),
+        .timeout    (),
+        .pec_en     (1'b0),
+        .pec_error  (),
+        .sample_point(8'd0),
+        .scl_quarter(8'd0),
+        .addr_only(1'b0),
+        .hold(1'b0),
+        .abort(1'b0),
         .rx_data    (rx_data),
         .sda        (sda),
         .scl        (scl),
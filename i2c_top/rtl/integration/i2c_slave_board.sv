@@ -1,6 +1,6 @@
 //==============================================================================
 // I2C Slave Board Module
-// Simulates a Basys3 board with 3 I2C Slaves
+// Simulates a Basys3 board with 4 I2C Slaves
 // For board-to-board communication testing
 //==============================================================================
 
@@ -66,4 +66,18 @@ module i2c_slave_board (
         .debug_state      ()
     );
 
+    //==========================================================================
+    // Slave 4: EEPROM Slave (0x50)
+    //==========================================================================
+    i2c_eeprom_slave u_eeprom_slave (
+        .clk   (clk),
+        .rst_n (rst_n),
+        .scl   (scl),
+        .sda   (sda),
+        .write_busy       (),
+        // Debug ports (not connected)
+        .debug_addr_match (),
+        .debug_state      ()
+    );
+
 endmodule
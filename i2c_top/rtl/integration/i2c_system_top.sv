@@ -7,6 +7,7 @@
 //  - LED Slave (0x55)
 //  - FND Slave (0x56)
 //  - Switch Slave (0x57)
+//  - EEPROM Slave (0x50, 256-byte bulk-transfer target)
 //
 // This module demonstrates the core I2C multi-device bus concept
 //==============================================================================
@@ -45,7 +46,7 @@ module i2c_system_top (
     // Internal I2C Bus (tri-state with pull-ups)
     //==========================================================================
     // tri1: tri-state wire with built-in pull-up (defaults to '1' when not driven)
-    tri1 sda;   // I2C data line (shared by master + 3 slaves)
+    tri1 sda;   // I2C data line (shared by master + 4 slaves)
     tri1 scl;   // I2C clock line (driven by master)
 
     //==========================================================================
@@ -62,11 +63,22 @@ module i2c_system_top (
         .start(start),
         .rw_bit(rw_bit),
         .slave_addr(slave_addr),
+        .byte_count(8'd1),               // Single-byte transfers
         .tx_data(SW),                    // Use SW switches as tx_data source
+        .tx_next(),
         .rx_data(rx_data_internal),      // Internal rx_data (not exposed to pins)
+        .rx_valid(),
         .busy(busy),
         .done(done),
         .ack_error(ack_error),
+        .timeout(),
+        .pec_en(1'b0),
+        .pec_error(),
+        .sample_point(8'd0),
+        .scl_quarter(8'd0),
+        .addr_only(1'b0),
+        .hold(1'b0),
+        .abort(1'b0),
         .sda(sda),
         .scl(scl),
         .debug_busy(),
@@ -117,4 +129,17 @@ module i2c_system_top (
         .debug_state(debug_sw_state)
     );
 
+    //==========================================================================
+    // EEPROM Slave (Address: 0x50)
+    //==========================================================================
+    i2c_eeprom_slave eeprom_slave (
+        .clk(clk),
+        .rst_n(rst_n),
+        .scl(scl),
+        .sda(sda),
+        .write_busy(),
+        .debug_addr_match(),
+        .debug_state()
+    );
+
 endmodule
@@ -0,0 +1,101 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// I2C Master Arbiter
+//==============================================================================
+// Hands i2c_master to one of N requesters at a time.
+// Protocol:
+//   - A requester raises req[i] and keeps it high until its last
+//     transaction is done (several transactions, e.g. pointer write + Sr
+//     read, stay under one grant)
+//   - grant[i] rises when the requester wins; it drops the cycle after
+//     req[i] falls, then the next winner is picked
+// Features:
+//  - 2-bit priority per requester (prio[2*i +: 2], 3 = highest)
+//  - Equal priority: round robin, starting after the last winner
+//  - No grant while enable = 0 (an exclusive engine owns i2c_master)
+//  - Priority is only checked between grants: a running requester is
+//    never preempted
+//==============================================================================
+
+module i2c_arbiter #(
+    parameter int N = 6                 // Number of requesters
+)(
+    // Global Signals
+    input  logic           clk,         // 100 MHz system clock
+    input  logic           rst_n,       // Active-low reset
+
+    // Requesters
+    input  logic [N-1:0]   req,         // Request (level, held until done)
+    input  logic [2*N-1:0] prio,        // Priority per requester
+    input  logic           enable,      // Grants allowed
+    output logic [N-1:0]   grant,       // One-hot grant
+    output logic           busy         // Request pending or granted
+);
+
+    //==========================================================================
+    // Parameters
+    //==========================================================================
+    localparam int IW = (N > 1) ? $clog2(N) : 1;
+
+    //==========================================================================
+    // Internal Signals
+    //==========================================================================
+    logic [N-1:0]  grant_reg, grant_next;
+    logic [IW-1:0] last, last_next;             // Last winner (round robin)
+
+    //==========================================================================
+    // Output Assignments
+    //==========================================================================
+    assign grant = grant_reg;
+    assign busy  = (req != '0) || (grant_reg != '0);
+
+    //==========================================================================
+    // Sequential Logic
+    //==========================================================================
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            grant_reg <= '0;
+            last      <= IW'(N - 1);    // Requester 0 first after reset
+        end else begin
+            grant_reg <= grant_next;
+            last      <= last_next;
+        end
+    end
+
+    //==========================================================================
+    // Winner Selection
+    //==========================================================================
+    always_comb begin
+        int         idx;
+        logic       found;
+        logic [1:0] best;
+
+        grant_next = grant_reg;
+        last_next  = last;
+        found      = 1'b0;
+        best       = 2'd0;
+        idx        = 0;
+
+        if (grant_reg != '0) begin
+            // Hold until the owner releases
+            if ((grant_reg & req) == '0) begin
+                grant_next = '0;
+            end
+        end else if (enable && req != '0) begin
+            // Scan from the requester after the last winner: the first one
+            // with the highest priority wins, so equals take turns
+            for (int k = 1; k <= N; k++) begin
+                idx = (int'(last) + k) % N;
+                if (req[idx] && (!found || prio[2*idx +: 2] > best)) begin
+                    found      = 1'b1;
+                    best       = prio[2*idx +: 2];
+                    grant_next = '0;
+                    grant_next[idx] = 1'b1;
+                    last_next  = IW'(idx);
+                end
+            end
+        end
+    end
+
+endmodule
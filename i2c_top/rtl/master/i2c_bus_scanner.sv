@@ -0,0 +1,150 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// I2C Bus Scanner
+//==============================================================================
+// Walks an address range with address-only probes (i2c_master addr_only,
+// write direction: START-ADDR-ACK-STOP) and builds a presence bitmap.
+// No data byte is transferred, so no slave changes state.
+// Features:
+//  - Range first_addr..last_addr (inclusive, 7-bit), latched at start
+//  - present[a] = 1 when address a ACKed; bits outside the range read 0
+//  - Bitmap cleared at start, updated as each probe completes
+//==============================================================================
+
+module i2c_bus_scanner (
+    // Global Signals
+    input  logic         clk,            // 100 MHz system clock
+    input  logic         rst_n,          // Active-low reset
+
+    // Control Interface
+    input  logic         start,          // Start scan (pulse)
+    input  logic [6:0]   first_addr,     // First address probed
+    input  logic [6:0]   last_addr,      // Last address probed (>= first_addr)
+    output logic         busy,           // Scan in progress
+    output logic         done,           // Scan completed (pulse)
+    output logic [127:0] present,        // Presence bitmap, bit = address
+
+    // i2c_master Control (rw_bit = 0, addr_only = 1 while busy)
+    output logic         m_start,
+    output logic [6:0]   m_addr,
+    input  logic         m_done,
+    input  logic         m_ack_error
+);
+
+    //==========================================================================
+    // Parameters
+    //==========================================================================
+    // State Encoding
+    typedef enum logic [1:0] {
+        IDLE      = 2'd0,
+        ISSUE     = 2'd1,    // Pulse m_start for the current address
+        WAIT      = 2'd2,    // Wait for m_done, record ACK
+        DONE      = 2'd3
+    } scan_state_t;
+
+    //==========================================================================
+    // Internal Signals
+    //==========================================================================
+    scan_state_t state, state_next;
+
+    logic [6:0]   addr, addr_next;           // Address being probed
+    logic [6:0]   last, last_next;           // last_addr latched at start
+    logic [127:0] present_reg, present_next;
+    logic         m_start_reg, m_start_next;
+    logic         done_reg, done_next;
+
+    //==========================================================================
+    // Output Assignments
+    //==========================================================================
+    assign busy    = (state != IDLE);
+    assign done    = done_reg;
+    assign present = present_reg;
+    assign m_start = m_start_reg;
+    assign m_addr  = addr;
+
+    //==========================================================================
+    // Sequential Logic
+    //==========================================================================
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            state       <= IDLE;
+            addr        <= 7'd0;
+            last        <= 7'd0;
+            present_reg <= 128'd0;
+            m_start_reg <= 1'b0;
+            done_reg    <= 1'b0;
+        end else begin
+            state       <= state_next;
+            addr        <= addr_next;
+            last        <= last_next;
+            present_reg <= present_next;
+            m_start_reg <= m_start_next;
+            done_reg    <= done_next;
+        end
+    end
+
+    //==========================================================================
+    // Combinational FSM
+    //==========================================================================
+    always_comb begin
+        // Defaults
+        state_next   = state;
+        addr_next    = addr;
+        last_next    = last;
+        present_next = present_reg;
+        m_start_next = 1'b0;    // Pulse
+        done_next    = 1'b0;    // Pulse
+
+        case (state)
+            //==================================================================
+            // IDLE: Wait for start
+            //==================================================================
+            IDLE: begin
+                if (start) begin
+                    addr_next    = first_addr;
+                    last_next    = (last_addr < first_addr) ? first_addr : last_addr;
+                    present_next = 128'd0;
+                    state_next   = ISSUE;
+                end
+            end
+
+            //==================================================================
+            // ISSUE: Probe the current address
+            //==================================================================
+            ISSUE: begin
+                m_start_next = 1'b1;
+                state_next   = WAIT;
+            end
+
+            //==================================================================
+            // WAIT: Record ACK, next address or finish
+            //==================================================================
+            WAIT: begin
+                if (m_done) begin
+                    present_next[addr] = ~m_ack_error;
+
+                    if (addr == last) begin
+                        state_next = DONE;
+                    end else begin
+                        addr_next  = addr + 1;
+                        state_next = ISSUE;
+                    end
+                end
+            end
+
+            //==================================================================
+            // DONE: Signal completion
+            //==================================================================
+            DONE: begin
+                done_next  = 1'b1;
+                state_next = IDLE;
+            end
+
+            default: begin
+                state_next = IDLE;
+            end
+        endcase
+    end
+
+endmodule
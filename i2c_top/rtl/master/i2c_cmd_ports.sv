@@ -0,0 +1,171 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// I2C Command Ports
+//==============================================================================
+// N independent one-word command slots for requesters that share
+// i2c_master (a second CPU, a hardware engine). Each port has its own
+// command, completion flags and receive byte; the arbiter decides which
+// pending port runs next.
+// Command word (cmd_data, written with cmd_wr[i]):
+//   [31:24] second write byte
+//   [23:16] first write byte
+//   [9:8]   write byte count (0/1 = one, 2 = two; reads are one byte)
+//   [7:1]   slave address
+//   [0]     rw_bit
+// Status word (stat[32*i +: 32]):
+//   [31] pending (waiting for or holding the grant)
+//   [30] running on the bus
+//   [10] overrun: command written while pending, dropped
+//   [9]  done
+//   [8]  ack_error (a read returns 8'hFF)
+//   [7:0] received byte
+// Features:
+//  - req[i] stays high from the command until its STOP (arbiter request)
+//  - A new command clears done / ack_error / overrun of its port only
+//==============================================================================
+
+module i2c_cmd_ports #(
+    parameter int N_PORTS = 4
+)(
+    // Global Signals
+    input  logic                    clk,        // 100 MHz system clock
+    input  logic                    rst_n,      // Active-low reset
+
+    // Register Interface
+    input  logic [N_PORTS-1:0]      cmd_wr,     // Command write (pulse)
+    input  logic [31:0]             cmd_data,   // Command word
+    output logic [32*N_PORTS-1:0]   stat,       // Status words
+
+    // Arbiter
+    output logic [N_PORTS-1:0]      req,        // Port has a command
+    input  logic [N_PORTS-1:0]      grant,      // Port may use i2c_master
+
+    // i2c_master Control (valid while a port is granted)
+    output logic                    m_start,
+    output logic                    m_rw,
+    output logic [6:0]              m_addr,
+    output logic [7:0]              m_count,
+    output logic [7:0]              m_tx_data,
+    input  logic                    m_tx_next,
+    input  logic [7:0]              m_rx_data,
+    input  logic                    m_rx_valid,
+    input  logic                    m_done,
+    input  logic                    m_ack_error
+);
+
+    //==========================================================================
+    // Parameters
+    //==========================================================================
+    localparam int IW = (N_PORTS > 1) ? $clog2(N_PORTS) : 1;
+
+    //==========================================================================
+    // Internal Signals
+    //==========================================================================
+    logic [31:0]        cmd [N_PORTS];          // Latched commands
+    logic [7:0]         rx  [N_PORTS];          // Received bytes
+    logic [N_PORTS-1:0] pend;                   // Command not finished
+    logic [N_PORTS-1:0] done_flag;
+    logic [N_PORTS-1:0] nack_flag;
+    logic [N_PORTS-1:0] ovr_flag;
+
+    logic               run;                    // Granted port on the bus
+    logic [IW-1:0]      cur;                    // ... its index
+    logic               tx_sel;                 // 0 = first byte next
+
+    logic [IW-1:0]      gnt_idx;                // Index of the grant
+    logic [IW-1:0]      sel;
+    logic [31:0]        sel_cmd;
+
+    //==========================================================================
+    // Grant Decode
+    //==========================================================================
+    always_comb begin
+        gnt_idx = '0;
+        for (int i = 0; i < N_PORTS; i++) begin
+            if (grant[i]) gnt_idx = IW'(i);
+        end
+    end
+
+    //==========================================================================
+    // Output Assignments
+    //==========================================================================
+    assign req       = pend;
+    assign sel       = run ? cur : gnt_idx;
+    assign sel_cmd   = cmd[sel];
+
+    // Start once per command: pend drops together with run at m_done
+    assign m_start   = (grant != '0) && pend[gnt_idx] && !run;
+    assign m_rw      = sel_cmd[0];
+    assign m_addr    = sel_cmd[7:1];
+    assign m_count   = (!sel_cmd[0] && sel_cmd[9:8] == 2'd2) ? 8'd2 : 8'd1;
+    assign m_tx_data = tx_sel ? sel_cmd[31:24] : sel_cmd[23:16];
+
+    always_comb begin
+        for (int i = 0; i < N_PORTS; i++) begin
+            stat[32*i +: 32] = {pend[i], run && (cur == IW'(i)), 19'h0,
+                                ovr_flag[i], done_flag[i], nack_flag[i], rx[i]};
+        end
+    end
+
+    //==========================================================================
+    // Sequential Logic
+    //==========================================================================
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            for (int i = 0; i < N_PORTS; i++) begin
+                cmd[i] <= 32'h0;
+                rx[i]  <= 8'h0;
+            end
+            pend      <= '0;
+            done_flag <= '0;
+            nack_flag <= '0;
+            ovr_flag  <= '0;
+            run       <= 1'b0;
+            cur       <= '0;
+            tx_sel    <= 1'b0;
+        end else begin
+            // Accept commands on idle ports
+            for (int i = 0; i < N_PORTS; i++) begin
+                if (cmd_wr[i]) begin
+                    if (pend[i]) begin
+                        ovr_flag[i] <= 1'b1;
+                    end else begin
+                        cmd[i]       <= cmd_data;
+                        pend[i]      <= 1'b1;
+                        done_flag[i] <= 1'b0;
+                        nack_flag[i] <= 1'b0;
+                        ovr_flag[i]  <= 1'b0;
+                    end
+                end
+            end
+
+            if (m_start) begin
+                run    <= 1'b1;
+                cur    <= gnt_idx;
+                tx_sel <= 1'b0;
+            end
+
+            if (run) begin
+                if (m_tx_next) begin
+                    tx_sel <= 1'b1;
+                end
+
+                if (m_rx_valid) begin
+                    rx[cur] <= m_rx_data;
+                end
+
+                if (m_done) begin
+                    run            <= 1'b0;
+                    pend[cur]      <= 1'b0;
+                    done_flag[cur] <= 1'b1;
+                    nack_flag[cur] <= m_ack_error;
+                    if (m_ack_error && cmd[cur][0]) begin
+                        rx[cur] <= 8'hFF;
+                    end
+                end
+            end
+        end
+    end
+
+endmodule
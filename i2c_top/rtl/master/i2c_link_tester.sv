@@ -0,0 +1,353 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// I2C Link Tester (PRBS Traffic Generator / Error Counter)
+//==============================================================================
+// Drives i2c_master's control interface to characterize a cable: at each
+// SCL speed it writes PRBS blocks to a loopback slave (EEPROM, 0x50 on the
+// slave board), reads them back and counts errors.
+// Features:
+//  - Up to NUM_SPEEDS speeds, each a quarter-bit period in clk cycles
+//    (speeds[8*i +: 8], 0 = skip); tested in order
+//  - Per block (BLOCK_LEN = EEPROM page, word address = block * BLOCK_LEN):
+//      [addr W][word][PRBS x BLOCK_LEN]   write page
+//      [addr W][word]                      set pointer
+//      [addr R][data x BLOCK_LEN]          read back, compare
+//  - PRBS-15 (x^15 + x^14 + 1), 8 bits per byte, continuous across blocks
+//  - NACKed transactions are retried up to MAX_RETRY times; a block that
+//    still fails is skipped (its bytes are not counted)
+//  - Per speed results (res_sel): verified bytes, bit errors, NACKs,
+//    retries and clk cycles spent, so
+//      throughput = bytes * 8 * 100e6 / cycles   (payload bit/s)
+//      error rate = bit_errors / (bytes * 8)
+//==============================================================================
+
+module i2c_link_tester #(
+    parameter int NUM_SPEEDS = 4,
+    parameter int BLOCK_LEN  = 8,       // Bytes per block (<= slave page size)
+    parameter int MAX_RETRY  = 3        // Retries per NACKed transaction
+)(
+    // Global Signals
+    input  logic        clk,            // 100 MHz system clock
+    input  logic        rst_n,          // Active-low reset
+
+    // Control Interface
+    input  logic        start,          // Start test run (pulse)
+    input  logic [6:0]  slave_addr,     // Loopback slave address
+    input  logic [7:0]  blocks,         // Blocks per speed (0 = 1)
+    input  logic [8*NUM_SPEEDS-1:0] speeds, // Quarter bit per speed (0 = skip)
+    output logic        busy,           // Test run in progress
+    output logic        done,           // Test run completed (pulse)
+
+    // Results (selected speed)
+    input  logic [1:0]  res_sel,
+    output logic [31:0] res_bytes,      // Bytes read back and compared
+    output logic [31:0] res_bit_errors, // Bits that differed
+    output logic [15:0] res_nacks,      // NACKed transactions
+    output logic [15:0] res_retries,    // Retried transactions
+    output logic [31:0] res_cycles,     // clk cycles at this speed
+
+    // i2c_master Control
+    output logic        m_start,
+    output logic        m_rw,
+    output logic [6:0]  m_addr,
+    output logic [7:0]  m_count,
+    output logic [7:0]  m_tx_data,
+    output logic [7:0]  m_quarter,
+    input  logic        m_tx_next,
+    input  logic [7:0]  m_rx_data,
+    input  logic        m_rx_valid,
+    input  logic        m_done,
+    input  logic        m_ack_error
+);
+
+    //==========================================================================
+    // Parameters
+    //==========================================================================
+    localparam int SPD_W   = (NUM_SPEEDS > 1) ? $clog2(NUM_SPEEDS) : 1;
+    localparam int RETRY_W = $clog2(MAX_RETRY + 1);
+
+    // State Encoding
+    typedef enum logic [2:0] {
+        IDLE      = 3'd0,
+        NEXT_SPD  = 3'd1,    // Pick next non-zero speed
+        ISSUE     = 3'd2,    // Pulse m_start for the current operation
+        WAIT      = 3'd3,    // Wait for m_done
+        NEXT_OP   = 3'd4,    // Advance write -> pointer -> read -> next block
+        DONE      = 3'd5
+    } lt_state_t;
+
+    // Operation within a block
+    typedef enum logic [1:0] {
+        OP_WRITE = 2'd0,     // [word][PRBS...]
+        OP_PTR   = 2'd1,     // [word]
+        OP_READ  = 2'd2      // [PRBS...]
+    } lt_op_t;
+
+    localparam logic [14:0] PRBS_SEED = 15'h7FFF;
+
+    //==========================================================================
+    // Internal Signals
+    //==========================================================================
+    lt_state_t state, state_next;
+    lt_op_t    op, op_next;
+
+    logic [SPD_W-1:0] spd, spd_next;            // Speed under test
+    logic [7:0]  blk_left, blk_left_next;       // Blocks left at this speed
+    logic [7:0]  word, word_next;               // Word address of this block
+    logic [RETRY_W-1:0] retry, retry_next;      // Retries of this operation
+    logic        failed;                        // Operation NACKed
+
+    // PRBS: block seed, TX and RX generators
+    logic [14:0] blk_seed, blk_seed_next;
+    logic [14:0] tx_lfsr, tx_lfsr_next;
+    logic [14:0] rx_lfsr, rx_lfsr_next;
+    logic        tx_word, tx_word_next;         // Next tx byte is the word address
+
+    // Per-speed results
+    logic [31:0] r_bytes   [NUM_SPEEDS];
+    logic [31:0] r_biterr  [NUM_SPEEDS];
+    logic [15:0] r_nacks   [NUM_SPEEDS];
+    logic [15:0] r_retries [NUM_SPEEDS];
+    logic [31:0] r_cycles  [NUM_SPEEDS];
+
+    logic        m_start_reg, m_start_next;
+    logic        done_reg, done_next;
+
+    //==========================================================================
+    // PRBS-15 (x^15 + x^14 + 1), advanced 8 bits per byte
+    //==========================================================================
+    function automatic logic [14:0] prbs_step(input logic [14:0] s, input int bits);
+        for (int i = 0; i < bits; i++) begin
+            s = {s[13:0], s[14] ^ s[13]};
+        end
+        return s;
+    endfunction
+
+    function automatic logic [3:0] popcount8(input logic [7:0] v);
+        logic [3:0] n;
+        n = 4'd0;
+        for (int i = 0; i < 8; i++) begin
+            n = n + v[i];
+        end
+        return n;
+    endfunction
+
+    //==========================================================================
+    // Output Assignments
+    //==========================================================================
+    assign busy      = (state != IDLE);
+    assign done      = done_reg;
+    assign m_start   = m_start_reg;
+    assign m_rw      = (op == OP_READ);
+    assign m_addr    = slave_addr;
+    assign m_count   = (op == OP_WRITE) ? 8'(BLOCK_LEN + 1) :
+                       (op == OP_PTR)   ? 8'd1 : 8'(BLOCK_LEN);
+    assign m_tx_data = tx_word ? word : tx_lfsr[7:0];
+    assign m_quarter = speeds[8*spd +: 8];
+
+    assign failed    = m_done && m_ack_error;
+
+    assign res_bytes      = r_bytes[res_sel];
+    assign res_bit_errors = r_biterr[res_sel];
+    assign res_nacks      = r_nacks[res_sel];
+    assign res_retries    = r_retries[res_sel];
+    assign res_cycles     = r_cycles[res_sel];
+
+    //==========================================================================
+    // Sequential Logic
+    //==========================================================================
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            state       <= IDLE;
+            op          <= OP_WRITE;
+            spd         <= '0;
+            blk_left    <= 8'd0;
+            word        <= 8'd0;
+            retry       <= '0;
+            blk_seed    <= PRBS_SEED;
+            tx_lfsr     <= PRBS_SEED;
+            rx_lfsr     <= PRBS_SEED;
+            tx_word     <= 1'b0;
+            m_start_reg <= 1'b0;
+            done_reg    <= 1'b0;
+        end else begin
+            state       <= state_next;
+            op          <= op_next;
+            spd         <= spd_next;
+            blk_left    <= blk_left_next;
+            word        <= word_next;
+            retry       <= retry_next;
+            blk_seed    <= blk_seed_next;
+            tx_lfsr     <= tx_lfsr_next;
+            rx_lfsr     <= rx_lfsr_next;
+            tx_word     <= tx_word_next;
+            m_start_reg <= m_start_next;
+            done_reg    <= done_next;
+        end
+    end
+
+    // Result counters (cleared at start, accumulated for the current speed)
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            for (int i = 0; i < NUM_SPEEDS; i++) begin
+                r_bytes[i]   <= 32'd0;
+                r_biterr[i]  <= 32'd0;
+                r_nacks[i]   <= 16'd0;
+                r_retries[i] <= 16'd0;
+                r_cycles[i]  <= 32'd0;
+            end
+        end else if (state == IDLE && start) begin
+            for (int i = 0; i < NUM_SPEEDS; i++) begin
+                r_bytes[i]   <= 32'd0;
+                r_biterr[i]  <= 32'd0;
+                r_nacks[i]   <= 16'd0;
+                r_retries[i] <= 16'd0;
+                r_cycles[i]  <= 32'd0;
+            end
+        end else if (state == ISSUE || state == WAIT || state == NEXT_OP) begin
+            r_cycles[spd] <= r_cycles[spd] + 1;
+
+            if (op == OP_READ && m_rx_valid) begin
+                r_bytes[spd]  <= r_bytes[spd] + 1;
+                r_biterr[spd] <= r_biterr[spd] + popcount8(m_rx_data ^ rx_lfsr[7:0]);
+            end
+
+            if (failed) begin
+                if (r_nacks[spd] != 16'hFFFF) r_nacks[spd] <= r_nacks[spd] + 1;
+                if (retry != RETRY_W'(MAX_RETRY) && r_retries[spd] != 16'hFFFF) begin
+                    r_retries[spd] <= r_retries[spd] + 1;
+                end
+            end
+        end
+    end
+
+    //==========================================================================
+    // Combinational FSM
+    //==========================================================================
+    always_comb begin
+        // Defaults
+        state_next    = state;
+        op_next       = op;
+        spd_next      = spd;
+        blk_left_next = blk_left;
+        word_next     = word;
+        retry_next    = retry;
+        blk_seed_next = blk_seed;
+        tx_lfsr_next  = tx_lfsr;
+        rx_lfsr_next  = rx_lfsr;
+        tx_word_next  = tx_word;
+        m_start_next  = 1'b0;   // Pulse
+        done_next     = 1'b0;   // Pulse
+
+        // Byte streams follow the master while a transaction runs
+        if (m_tx_next) begin
+            tx_word_next = 1'b0;
+            if (!tx_word) tx_lfsr_next = prbs_step(tx_lfsr, 8);
+        end
+
+        if (m_rx_valid) begin
+            rx_lfsr_next = prbs_step(rx_lfsr, 8);
+        end
+
+        case (state)
+            //==================================================================
+            // IDLE: Wait for start
+            //==================================================================
+            IDLE: begin
+                if (start) begin
+                    spd_next      = '0;
+                    blk_seed_next = PRBS_SEED;
+                    state_next    = NEXT_SPD;
+                end
+            end
+
+            //==================================================================
+            // NEXT_SPD: Skip zero entries, start the first block
+            //==================================================================
+            NEXT_SPD: begin
+                if (speeds[8*spd +: 8] == 8'd0) begin
+                    if (spd == SPD_W'(NUM_SPEEDS - 1)) begin
+                        state_next = DONE;
+                    end else begin
+                        spd_next   = spd + 1;
+                    end
+                end else begin
+                    blk_left_next = (blocks == 8'd0) ? 8'd1 : blocks;
+                    word_next     = 8'd0;
+                    op_next       = OP_WRITE;
+                    retry_next    = '0;
+                    state_next    = ISSUE;
+                end
+            end
+
+            //==================================================================
+            // ISSUE: Rewind the byte streams to the block seed, start
+            //==================================================================
+            ISSUE: begin
+                tx_lfsr_next = blk_seed;
+                rx_lfsr_next = blk_seed;
+                tx_word_next = (op != OP_READ);
+                m_start_next = 1'b1;
+                state_next   = WAIT;
+            end
+
+            //==================================================================
+            // WAIT: Transaction in progress
+            //==================================================================
+            WAIT: begin
+                if (m_done) begin
+                    if (m_ack_error && retry != RETRY_W'(MAX_RETRY)) begin
+                        retry_next = retry + 1;
+                        state_next = ISSUE;
+                    end else if (m_ack_error) begin
+                        // Give up on this block
+                        op_next    = OP_READ;
+                        state_next = NEXT_OP;
+                    end else begin
+                        state_next = NEXT_OP;
+                    end
+                end
+            end
+
+            //==================================================================
+            // NEXT_OP: Next operation of the block, or next block / speed
+            //==================================================================
+            NEXT_OP: begin
+                retry_next = '0;
+
+                if (op != OP_READ) begin
+                    op_next    = (op == OP_WRITE) ? OP_PTR : OP_READ;
+                    state_next = ISSUE;
+                end else begin
+                    blk_seed_next = prbs_step(blk_seed, 8 * BLOCK_LEN);
+                    word_next     = word + 8'(BLOCK_LEN);
+                    blk_left_next = blk_left - 1;
+                    op_next       = OP_WRITE;
+
+                    if (blk_left != 8'd1) begin
+                        state_next = ISSUE;
+                    end else if (spd == SPD_W'(NUM_SPEEDS - 1)) begin
+                        state_next = DONE;
+                    end else begin
+                        spd_next   = spd + 1;
+                        state_next = NEXT_SPD;
+                    end
+                end
+            end
+
+            //==================================================================
+            // DONE: Signal completion
+            //==================================================================
+            DONE: begin
+                done_next  = 1'b1;
+                state_next = IDLE;
+            end
+
+            default: begin
+                state_next = IDLE;
+            end
+        endcase
+    end
+
+endmodule
@@ -4,14 +4,58 @@
 // I2C Master Module
 //==============================================================================
 // Features:
-//  - 100 MHz system clock, 100 kHz SCL
+//  - CLK_FREQ system clock (100 MHz default), SCL_FREQ parameter
+//    (100 kHz default, 100 kHz-1 MHz)
+//  - scl_quarter overrides the SCL rate per transaction (quarter bit in
+//    clk cycles, latched at start; 0 = SCL_FREQ)
 //  - 7-bit addressing (0x55 default)
-//  - Single byte read/write operations
-//  - Proper I2C protocol: START-ADDR-ACK-DATA-ACK-STOP
+//  - Single or multi-byte (byte_count) read/write operations
+//  - Proper I2C protocol: START-ADDR-ACK-DATA-ACK-[DATA-ACK...]-STOP
+//  - Multi-byte write: tx_data is latched at start and after every ACKed
+//    byte; tx_next pulses on each latch so a FIFO can present the next byte
+//  - Multi-byte read: master ACKs every byte except the last (NACK);
+//    rx_valid pulses when rx_data holds a new byte
+//  - Optional SMBus PEC (pec_en): CRC-8 (x^8+x^2+x+1) over the address
+//    byte and every data byte. Writes append the PEC byte after the last
+//    data byte; reads fetch one extra byte (ACK all data, NACK the PEC),
+//    which is checked and not passed on rx_valid. pec_error is set on a
+//    mismatch and cleared by the next start
+//  - Address-only probe (addr_only, SMBus quick command):
+//    START-ADDR-ACK-STOP, no data phase and no tx_next; ack_error reports
+//    whether the address was ACKed. Use rw_bit = 0: after a read address
+//    the slave may already drive the first data bit and block the STOP
+//  - Repeated START (hold): a transaction started with hold = 1 ends
+//    without STOP after its last byte; SCL stays low, done pulses and busy
+//    drops. The next start then issues Sr instead of START (e.g. register
+//    pointer write, Sr, read). Dropping hold while waiting sends the STOP
+//    (done pulses again). NACK always ends with STOP
 //  - Tri-state SDA control
+//  - Open-drain SCL with clock stretching: SCL is only pulled low, never
+//    driven high. While SCL is released but still low (a slave stretching,
+//    or a slow rising edge) the FSM waits and restarts the phase count,
+//    so tHIGH and the sample point are timed from the synchronized rising
+//    edge. Needs a pull-up on SCL (board or tri1 net)
+//  - Stretch timeout: SCL held low by a slave for STRETCH_TIMEOUT clk
+//    (5 ms at 100 MHz by default, inside the driver's 10 ms wait; 0 =
+//    wait forever) ends the transaction: both lines are released, the
+//    FSM returns to IDLE without a STOP (it cannot be sent while SCL is
+//    low) and done pulses with ack_error and timeout set. timeout clears
+//    on the next start
+//  - Abort (pulse, any state but IDLE): ends the transaction the same
+//    way, with ack_error set and timeout clear (software deadline)
+//  - SDA input: 2-FF synchronizer, then an SDA_FILTER-tap majority vote
+//    that rejects spikes shorter than SDA_FILTER/2 clk (1 = no filter).
+//    ACK / read bits are sampled sample_point clk after SCL rises
+//    (0 = middle of the first high quarter, clamped to that quarter);
+//    a later point tolerates slow rising edges on long cables
 //==============================================================================
 
-module i2c_master (
+module i2c_master #(
+    parameter int CLK_FREQ   = 100_000_000, // System clock (Hz)
+    parameter int SCL_FREQ   = 100_000,     // SCL frequency (Hz)
+    parameter int SDA_FILTER = 3,           // Majority taps on SDA input (odd, 1 = off)
+    parameter int STRETCH_TIMEOUT = 500_000 // Longest SCL stretch (clk, 0 = no limit)
+)(
     // Global Signals
     input  logic        clk,            // 100 MHz system clock
     input  logic        rst_n,          // Active-low reset
@@ -20,15 +64,26 @@ module i2c_master (
     input  logic        start,          // Start I2C transaction (pulse)
     input  logic        rw_bit,         // 0=Write, 1=Read
     input  logic [6:0]  slave_addr,     // 7-bit slave address
+    input  logic [7:0]  byte_count,     // Data bytes per transaction (0 = 1)
     input  logic [7:0]  tx_data,        // Data to transmit
+    output logic        tx_next,        // tx_data latched (pulse)
     output logic [7:0]  rx_data,        // Received data
+    output logic        rx_valid,       // rx_data updated (pulse)
     output logic        busy,           // Transaction in progress
     output logic        done,           // Transaction completed (pulse)
     output logic        ack_error,      // NACK received or error
+    output logic        timeout,        // SCL stretched past STRETCH_TIMEOUT
+    input  logic        pec_en,         // Append / check SMBus PEC
+    output logic        pec_error,      // Read PEC mismatch
+    input  logic [7:0]  sample_point,   // SDA sample clk after SCL rise (0 = default)
+    input  logic [7:0]  scl_quarter,    // Quarter SCL period in clk (0 = SCL_FREQ)
+    input  logic        addr_only,      // Probe: STOP right after the address ACK
+    input  logic        hold,           // No STOP at the end, next start is Sr
+    input  logic        abort,          // Drop the transaction, release the lines (pulse)
 
     // I2C Bus
     inout  logic        sda,            // I2C data line (tri-state)
-    output logic        scl,            // I2C clock line
+    inout  logic        scl,            // I2C clock line (open-drain)
 
     // Debug Ports
     output logic        debug_busy,     // Master busy status
@@ -42,10 +97,9 @@ module i2c_master (
     //==========================================================================
     // Parameters
     //==========================================================================
-    localparam int CLK_FREQ    = 100_000_000;  // 100 MHz system clock
-    localparam int SCL_FREQ    = 100_000;      // 100 kHz I2C SCL
-    localparam int CLK_PER_BIT = CLK_FREQ / (SCL_FREQ * 4);  // 250 cycles per quarter bit
-    localparam int HALF_PERIOD = CLK_PER_BIT * 2;            // 500 cycles for half SCL period
+    localparam int CLK_PER_BIT = CLK_FREQ / (SCL_FREQ * 4);  // 250 cycles per quarter bit @ 100 kHz
+    localparam int SCL_SYNC    = 3;     // SCL released -> synchronized high (clk)
+    localparam int STRETCH_W   = (STRETCH_TIMEOUT > 0) ? $clog2(STRETCH_TIMEOUT + 1) : 1;
 
     // I2C Commands
     localparam logic I2C_WRITE = 1'b0;
@@ -72,7 +126,10 @@ module i2c_master (
         STOP_3     = 5'd11,  // SDA high, SCL high (stop condition)
         // Error/Done
         DONE       = 5'd12,
-        ERROR      = 5'd13
+        ERROR      = 5'd13,
+        // Repeated START
+        HOLD       = 5'd14,  // SCL low, bus kept after the last byte
+        RESTART    = 5'd15   // SDA high, SCL low (setup for Sr)
     } i2c_state_t;
 
     // SCL Clock States (sub-states for timing)
@@ -93,23 +150,54 @@ module i2c_master (
     // SCL Generation
     logic [9:0] clk_count, clk_count_next;      // Counter for SCL timing (0-999)
     logic       scl_reg, scl_next;              // SCL register
+    logic [9:0] quarter, quarter_next;          // Quarter bit of this transaction (clk)
+    logic [9:0] half;                           // Half SCL period (clk)
     scl_phase_t scl_phase, scl_phase_next;      // SCL phase within a bit
+    logic [1:0] scl_sync;                       // 2-FF synchronizer
+    logic       scl_in;                         // Synchronized SCL line
+    logic       scl_stretch;                    // Released, line still low
+    logic [STRETCH_W-1:0] stretch_cnt, stretch_cnt_next;  // clk of the current stretch
+    logic       stretch_expired;                // Stretch reached STRETCH_TIMEOUT
 
     // Data Registers
     logic [7:0] addr_rw;                        // Address + R/W bit
     logic [7:0] tx_shift, tx_shift_next;        // Transmit shift register
     logic [7:0] rx_shift, rx_shift_next;        // Receive shift register
     logic [2:0] bit_count, bit_count_next;      // Bit counter (0-7)
+    logic [7:0] bytes_left, bytes_left_next;    // Data bytes still to transfer
+    logic       last_byte;                      // Current byte is the last one
+    logic       last_data;                      // Current byte is the last data byte
+
+    // Address-only probe
+    logic       probe_on, probe_on_next;        // addr_only latched at start
+
+    // Repeated START
+    logic       hold_on, hold_on_next;          // hold latched at start
+    i2c_state_t end_state;                      // STOP_1, or HOLD when hold_on
+
+    // SMBus PEC
+    logic       pec_on, pec_on_next;            // pec_en latched at start
+    logic       pec_byte, pec_byte_next;        // Current byte is the PEC
+    logic [7:0] crc_reg, crc_next;              // CRC-8 since START
+    logic       pec_error_reg, pec_error_next;
 
     // SDA Control
     logic       sda_out, sda_out_next;          // SDA output value
     logic       sda_oe, sda_oe_next;            // SDA output enable (1=drive, 0=tri-state)
-    logic       sda_in;                         // SDA input value
+    logic       sda_pin;                        // Raw SDA pin
+    logic [1:0] sda_sync;                       // 2-FF synchronizer
+    logic [SDA_FILTER-1:0] sda_taps;            // Synchronized SDA history
+    logic       sda_in;                         // Filtered SDA input value
+    logic [9:0] sample_at;                      // clk_count of the sample in SCL_HIGH_1
+    logic       sample_now;                     // Sample SDA this cycle
 
     // Status Flags
     logic       ack_received, ack_received_next;
     logic       done_reg, done_next;
     logic       ack_error_reg, ack_error_next;
+    logic       timeout_reg, timeout_next;
+    logic       tx_next_reg, tx_next_next;
+    logic       rx_valid_reg, rx_valid_next;
 
     // Control
     logic       is_read_op;                     // Current operation is read
@@ -118,20 +206,75 @@ module i2c_master (
     // SDA Tri-State Buffer
     //==========================================================================
     assign sda = sda_oe ? sda_out : 1'bz;
-    assign sda_in = sda;
+    assign sda_pin = sda;
+
+    //==========================================================================
+    // SDA Input: Synchronizer + Majority Filter
+    //==========================================================================
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            sda_sync <= 2'b11;      // I2C idle = high
+            sda_taps <= '1;
+        end else begin
+            sda_sync <= {sda_sync[0], sda_pin};
+            sda_taps <= {sda_taps, sda_sync[1]};
+        end
+    end
+
+    // Majority of the last SDA_FILTER synchronized samples
+    function automatic logic majority(input logic [SDA_FILTER-1:0] taps);
+        int ones;
+        ones = 0;
+        for (int i = 0; i < SDA_FILTER; i++) begin
+            ones += taps[i];
+        end
+        return (ones > SDA_FILTER / 2);
+    endfunction
+
+    assign sda_in = majority(sda_taps);
+
+    // Sample point within the first SCL high quarter
+    assign sample_at  = (sample_point == 8'd0)         ? (quarter >> 1) :
+                        (sample_point >= quarter)      ? (quarter - 1)  :
+                                                         10'(sample_point);
+    assign sample_now = (scl_phase == SCL_HIGH_1) && (clk_count == sample_at);
 
     //==========================================================================
-    // SCL Output
+    // SCL Open-Drain Output + Stretch Detection
     //==========================================================================
-    assign scl = scl_reg;
+    assign scl = scl_reg ? 1'bz : 1'b0;
+
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            scl_sync <= 2'b11;      // I2C idle = high
+        end else begin
+            scl_sync <= {scl_sync[0], scl};
+        end
+    end
+
+    assign scl_in = scl_sync[1];
+
+    // Checked once the synchronizer has caught up with the release
+    assign scl_stretch = scl_reg && !scl_in && (clk_count >= 10'(SCL_SYNC)) &&
+                         (state != IDLE) && (state != HOLD);
+    assign stretch_expired = (STRETCH_TIMEOUT > 0) &&
+                             (stretch_cnt == STRETCH_W'(STRETCH_TIMEOUT));
 
     //==========================================================================
     // Output Assignments
     //==========================================================================
-    assign busy       = (state != IDLE) && (state != DONE);
+    assign busy       = (state != IDLE) && (state != DONE) && (state != HOLD);
     assign done       = done_reg;
     assign ack_error  = ack_error_reg;
+    assign timeout    = timeout_reg;
     assign rx_data    = rx_shift;
+    assign tx_next    = tx_next_reg;
+    assign rx_valid   = rx_valid_reg;
+    assign pec_error  = pec_error_reg;
+    assign last_data  = (bytes_left <= 8'd1);
+    assign last_byte  = pec_on ? pec_byte : last_data;
+    assign half       = {quarter[8:0], 1'b0};
+    assign end_state  = hold_on ? HOLD : STOP_1;
 
     // Debug Outputs
     assign debug_busy     = busy;
@@ -149,28 +292,52 @@ module i2c_master (
             state          <= IDLE;
             clk_count      <= 10'd0;
             scl_reg        <= 1'b1;     // I2C idle = high
+            quarter        <= 10'(CLK_PER_BIT);
             scl_phase      <= SCL_LOW_1;
             tx_shift       <= 8'd0;
             rx_shift       <= 8'd0;
             bit_count      <= 3'd0;
+            bytes_left     <= 8'd0;
             sda_out        <= 1'b1;     // I2C idle = high
             sda_oe         <= 1'b1;     // Drive high by default
             ack_received   <= 1'b0;
             done_reg       <= 1'b0;
             ack_error_reg  <= 1'b0;
+            timeout_reg    <= 1'b0;
+            stretch_cnt    <= '0;
+            tx_next_reg    <= 1'b0;
+            rx_valid_reg   <= 1'b0;
+            probe_on       <= 1'b0;
+            hold_on        <= 1'b0;
+            pec_on         <= 1'b0;
+            pec_byte       <= 1'b0;
+            crc_reg        <= 8'd0;
+            pec_error_reg  <= 1'b0;
         end else begin
             state          <= state_next;
             clk_count      <= clk_count_next;
             scl_reg        <= scl_next;
+            quarter        <= quarter_next;
             scl_phase      <= scl_phase_next;
             tx_shift       <= tx_shift_next;
             rx_shift       <= rx_shift_next;
             bit_count      <= bit_count_next;
+            bytes_left     <= bytes_left_next;
             sda_out        <= sda_out_next;
             sda_oe         <= sda_oe_next;
             ack_received   <= ack_received_next;
             done_reg       <= done_next;
             ack_error_reg  <= ack_error_next;
+            timeout_reg    <= timeout_next;
+            stretch_cnt    <= stretch_cnt_next;
+            tx_next_reg    <= tx_next_next;
+            rx_valid_reg   <= rx_valid_next;
+            probe_on       <= probe_on_next;
+            hold_on        <= hold_on_next;
+            pec_on         <= pec_on_next;
+            pec_byte       <= pec_byte_next;
+            crc_reg        <= crc_next;
+            pec_error_reg  <= pec_error_next;
         end
     end
 
@@ -179,6 +346,19 @@ module i2c_master (
     //==========================================================================
     assign addr_rw = {slave_addr, rw_bit};
 
+    //==========================================================================
+    // SMBus PEC (CRC-8, polynomial 0x07, init 0x00, MSB first)
+    //==========================================================================
+    function automatic logic [7:0] crc8(input logic [7:0] crc,
+                                        input logic [7:0] data);
+        logic [7:0] c;
+        c = crc ^ data;
+        for (int i = 0; i < 8; i++) begin
+            c = c[7] ? {c[6:0], 1'b0} ^ 8'h07 : {c[6:0], 1'b0};
+        end
+        return c;
+    endfunction
+
     //==========================================================================
     // Combinational FSM Logic
     //==========================================================================
@@ -187,22 +367,52 @@ module i2c_master (
         state_next        = state;
         clk_count_next    = clk_count;
         scl_next          = scl_reg;
+        quarter_next      = quarter;
         scl_phase_next    = scl_phase;
         tx_shift_next     = tx_shift;
         rx_shift_next     = rx_shift;
         bit_count_next    = bit_count;
+        bytes_left_next   = bytes_left;
         sda_out_next      = sda_out;
         sda_oe_next       = sda_oe;
         ack_received_next = ack_received;
         done_next         = 1'b0;       // Pulse signal
         ack_error_next    = ack_error_reg;
-
-        case (state)
+        timeout_next      = timeout_reg;
+        stretch_cnt_next  = '0;
+        tx_next_next      = 1'b0;       // Pulse signal
+        rx_valid_next     = 1'b0;       // Pulse signal
+        probe_on_next     = probe_on;
+        hold_on_next      = hold_on;
+        pec_on_next       = pec_on;
+        pec_byte_next     = pec_byte;
+        crc_next          = crc_reg;
+        pec_error_next    = pec_error_reg;
+
+        // Clock stretching: wait for SCL high, then time the phase from
+        // there (samples taken before the line rose are taken again).
+        // A stretch that outlasts STRETCH_TIMEOUT ends the transaction, as
+        // does abort
+        if ((abort && state != IDLE) || (scl_stretch && stretch_expired)) begin
+            scl_next       = 1'b1;
+            sda_out_next   = 1'b1;
+            sda_oe_next    = 1'b1;
+            clk_count_next = 10'd0;
+            hold_on_next   = 1'b0;
+            done_next      = 1'b1;
+            ack_error_next = 1'b1;
+            timeout_next   = !abort;
+            state_next     = IDLE;
+        end else if (scl_stretch) begin
+            clk_count_next   = 10'd0;
+            stretch_cnt_next = stretch_cnt + 1'b1;
+        end else case (state)
             //==================================================================
             // IDLE: Wait for start command
+            // HOLD: Same, but SCL stays low and start issues a repeated START
             //==================================================================
-            IDLE: begin
-                scl_next       = 1'b1;
+            IDLE, HOLD: begin
+                scl_next       = (state == IDLE);
                 sda_out_next   = 1'b1;
                 sda_oe_next    = 1'b1;
                 clk_count_next = 10'd0;
@@ -211,9 +421,38 @@ module i2c_master (
                 if (start) begin
                     // Load data for transmission
                     tx_shift_next  = tx_data;
+                    tx_next_next   = ~addr_only;    // Probe consumes no data
+                    probe_on_next  = addr_only;
+                    hold_on_next   = hold;
+                    bytes_left_next = (byte_count == 8'd0) ? 8'd1 : byte_count;
                     bit_count_next = 3'd0;
+                    quarter_next   = (scl_quarter == 8'd0) ? 10'(CLK_PER_BIT) : 10'(scl_quarter);
                     ack_error_next = 1'b0;  // Clear ack_error only when starting new transaction
+                    timeout_next   = 1'b0;
+                    pec_on_next    = pec_en;
+                    pec_byte_next  = 1'b0;
+                    crc_next       = crc8(8'h00, addr_rw);
+                    pec_error_next = 1'b0;
+                    state_next     = (state == HOLD) ? RESTART : START_1;
+                end else if (state == HOLD && !hold) begin
+                    // Bus released without a follow-up transaction
+                    state_next     = STOP_1;
+                end
+            end
+
+            //==================================================================
+            // RESTART: SDA high while SCL is still low, then START_1 (Sr)
+            //==================================================================
+            RESTART: begin
+                scl_next     = 1'b0;
+                sda_out_next = 1'b1;
+                sda_oe_next  = 1'b1;
+
+                if (clk_count == half - 1) begin
+                    clk_count_next = 10'd0;
                     state_next     = START_1;
+                end else begin
+                    clk_count_next = clk_count + 1;
                 end
             end
 
@@ -226,7 +465,7 @@ module i2c_master (
                 sda_out_next = 1'b1;
                 sda_oe_next  = 1'b1;
 
-                if (clk_count == HALF_PERIOD - 1) begin
+                if (clk_count == half - 1) begin
                     clk_count_next = 10'd0;
                     state_next     = START_2;
                 end else begin
@@ -240,7 +479,7 @@ module i2c_master (
                 sda_out_next = 1'b0;
                 sda_oe_next  = 1'b1;
 
-                if (clk_count == HALF_PERIOD - 1) begin
+                if (clk_count == half - 1) begin
                     clk_count_next = 10'd0;
                     state_next     = START_3;
                 end else begin
@@ -254,7 +493,7 @@ module i2c_master (
                 sda_out_next = 1'b0;
                 sda_oe_next  = 1'b1;
 
-                if (clk_count == HALF_PERIOD - 1) begin
+                if (clk_count == half - 1) begin
                     clk_count_next = 10'd0;
                     bit_count_next = 3'd0;
                     scl_phase_next = SCL_LOW_1;
@@ -276,7 +515,7 @@ module i2c_master (
                         scl_next     = 1'b0;
                         sda_out_next = addr_rw[7 - bit_count];  // MSB first
 
-                        if (clk_count == CLK_PER_BIT - 1) begin
+                        if (clk_count == quarter - 1) begin
                             clk_count_next = 10'd0;
                             scl_phase_next = SCL_LOW_2;
                         end else begin
@@ -288,7 +527,7 @@ module i2c_master (
                         scl_next     = 1'b0;
                         sda_out_next = addr_rw[7 - bit_count];
 
-                        if (clk_count == CLK_PER_BIT - 1) begin
+                        if (clk_count == quarter - 1) begin
                             clk_count_next = 10'd0;
                             scl_phase_next = SCL_HIGH_1;
                         end else begin
@@ -301,7 +540,7 @@ module i2c_master (
                         scl_next     = 1'b1;
                         sda_out_next = addr_rw[7 - bit_count];
 
-                        if (clk_count == CLK_PER_BIT - 1) begin
+                        if (clk_count == quarter - 1) begin
                             clk_count_next = 10'd0;
                             scl_phase_next = SCL_HIGH_2;
                         end else begin
@@ -313,7 +552,7 @@ module i2c_master (
                         scl_next     = 1'b1;
                         sda_out_next = addr_rw[7 - bit_count];
 
-                        if (clk_count == CLK_PER_BIT - 1) begin
+                        if (clk_count == quarter - 1) begin
                             clk_count_next = 10'd0;
                             if (bit_count == 7) begin
                                 // All 8 bits sent, go to ACK
@@ -341,7 +580,7 @@ module i2c_master (
                         scl_next    = 1'b0;
                         sda_oe_next = 1'b0;  // Tri-state
 
-                        if (clk_count == CLK_PER_BIT - 1) begin
+                        if (clk_count == quarter - 1) begin
                             clk_count_next = 10'd0;
                             scl_phase_next = SCL_LOW_2;
                         end else begin
@@ -353,7 +592,7 @@ module i2c_master (
                         scl_next    = 1'b0;
                         sda_oe_next = 1'b0;
 
-                        if (clk_count == CLK_PER_BIT - 1) begin
+                        if (clk_count == quarter - 1) begin
                             clk_count_next = 10'd0;
                             scl_phase_next = SCL_HIGH_1;
                         end else begin
@@ -366,12 +605,12 @@ module i2c_master (
                         scl_next    = 1'b1;
                         sda_oe_next = 1'b0;
 
-                        if (clk_count == CLK_PER_BIT / 2) begin
-                            // Sample in middle of high period
+                        if (sample_now) begin
+                            // Sample at the programmed point of the high period
                             ack_received_next = ~sda_in;  // ACK = 0, NACK = 1
                         end
 
-                        if (clk_count == CLK_PER_BIT - 1) begin
+                        if (clk_count == quarter - 1) begin
                             clk_count_next = 10'd0;
                             scl_phase_next = SCL_HIGH_2;
                         end else begin
@@ -383,7 +622,7 @@ module i2c_master (
                         scl_next    = 1'b1;
                         sda_oe_next = 1'b0;
 
-                        if (clk_count == CLK_PER_BIT - 1) begin
+                        if (clk_count == quarter - 1) begin
                             clk_count_next = 10'd0;
                             scl_phase_next = SCL_LOW_1;
 
@@ -391,6 +630,10 @@ module i2c_master (
                                 // NACK received - abort
                                 ack_error_next = 1'b1;
                                 state_next     = STOP_1;
+                            end else if (probe_on) begin
+                                // Probe: address ACKed, no data phase
+                                done_next      = hold_on;
+                                state_next     = end_state;
                             end else begin
                                 // ACK received - proceed to data
                                 bit_count_next = 3'd0;
@@ -420,7 +663,7 @@ module i2c_master (
                             sda_oe_next = 1'b0;
                         end
 
-                        if (clk_count == CLK_PER_BIT - 1) begin
+                        if (clk_count == quarter - 1) begin
                             clk_count_next = 10'd0;
                             scl_phase_next = SCL_LOW_2;
                         end else begin
@@ -438,7 +681,7 @@ module i2c_master (
                             sda_oe_next = 1'b0;
                         end
 
-                        if (clk_count == CLK_PER_BIT - 1) begin
+                        if (clk_count == quarter - 1) begin
                             clk_count_next = 10'd0;
                             scl_phase_next = SCL_HIGH_1;
                         end else begin
@@ -455,12 +698,12 @@ module i2c_master (
                         end else begin
                             sda_oe_next = 1'b0;
                             // Sample data bit
-                            if (clk_count == CLK_PER_BIT / 2) begin
+                            if (sample_now) begin
                                 rx_shift_next[7 - bit_count] = sda_in;
                             end
                         end
 
-                        if (clk_count == CLK_PER_BIT - 1) begin
+                        if (clk_count == quarter - 1) begin
                             clk_count_next = 10'd0;
                             scl_phase_next = SCL_HIGH_2;
                         end else begin
@@ -478,11 +721,16 @@ module i2c_master (
                             sda_oe_next = 1'b0;
                         end
 
-                        if (clk_count == CLK_PER_BIT - 1) begin
+                        if (clk_count == quarter - 1) begin
                             clk_count_next = 10'd0;
 
                             if (bit_count == 7) begin
-                                // All 8 bits done
+                                // All 8 bits done (PEC byte: CRC -> 0 if good)
+                                if (rw_bit == I2C_READ && !pec_byte) begin
+                                    rx_valid_next = 1'b1;
+                                end
+                                crc_next = crc8(crc_reg, (rw_bit == I2C_READ) ?
+                                                         rx_shift : tx_shift);
                                 bit_count_next = 3'd0;
                                 scl_phase_next = SCL_LOW_1;
                                 state_next     = DATA_ACK;
@@ -511,10 +759,10 @@ module i2c_master (
                         end else begin
                             // Read: Master sends ACK (0) or NACK (1)
                             sda_oe_next  = 1'b1;
-                            sda_out_next = 1'b1;  // NACK (end of read)
+                            sda_out_next = last_byte;  // NACK only after last byte
                         end
 
-                        if (clk_count == CLK_PER_BIT - 1) begin
+                        if (clk_count == quarter - 1) begin
                             clk_count_next = 10'd0;
                             scl_phase_next = SCL_LOW_2;
                         end else begin
@@ -529,10 +777,10 @@ module i2c_master (
                             sda_oe_next = 1'b0;
                         end else begin
                             sda_oe_next  = 1'b1;
-                            sda_out_next = 1'b1;
+                            sda_out_next = last_byte;
                         end
 
-                        if (clk_count == CLK_PER_BIT - 1) begin
+                        if (clk_count == quarter - 1) begin
                             clk_count_next = 10'd0;
                             scl_phase_next = SCL_HIGH_1;
                         end else begin
@@ -546,15 +794,15 @@ module i2c_master (
                         if (rw_bit == I2C_WRITE) begin
                             sda_oe_next = 1'b0;
                             // Sample slave ACK
-                            if (clk_count == CLK_PER_BIT / 2) begin
+                            if (sample_now) begin
                                 ack_received_next = ~sda_in;
                             end
                         end else begin
                             sda_oe_next  = 1'b1;
-                            sda_out_next = 1'b1;
+                            sda_out_next = last_byte;
                         end
 
-                        if (clk_count == CLK_PER_BIT - 1) begin
+                        if (clk_count == quarter - 1) begin
                             clk_count_next = 10'd0;
                             scl_phase_next = SCL_HIGH_2;
                         end else begin
@@ -569,20 +817,42 @@ module i2c_master (
                             sda_oe_next = 1'b0;
                         end else begin
                             sda_oe_next  = 1'b1;
-                            sda_out_next = 1'b1;
+                            sda_out_next = last_byte;
                         end
 
-                        if (clk_count == CLK_PER_BIT - 1) begin
+                        if (clk_count == quarter - 1) begin
                             clk_count_next = 10'd0;
                             scl_phase_next = SCL_LOW_1;
 
-                            // Check for error only on write
                             if ((rw_bit == I2C_WRITE) && !ack_received) begin
+                                // Check for error only on write
                                 ack_error_next = 1'b1;
+                                state_next     = STOP_1;
+                            end else if (!last_byte && last_data) begin
+                                // Last data byte done: PEC byte follows
+                                pec_byte_next  = 1'b1;
+                                bit_count_next = 3'd0;
+                                if (rw_bit == I2C_WRITE) begin
+                                    tx_shift_next = crc_reg;
+                                end
+                                state_next = DATA_BIT;
+                            end else if (!last_byte) begin
+                                // More bytes: load next TX byte, continue
+                                bytes_left_next = bytes_left - 1;
+                                bit_count_next  = 3'd0;
+                                if (rw_bit == I2C_WRITE) begin
+                                    tx_shift_next = tx_data;
+                                    tx_next_next  = 1'b1;
+                                end
+                                state_next = DATA_BIT;
+                            end else begin
+                                // Go to STOP (read PEC: CRC over data + PEC = 0)
+                                if (pec_on && rw_bit == I2C_READ) begin
+                                    pec_error_next = (crc_reg != 8'h00);
+                                end
+                                done_next  = hold_on;   // HOLD: no STOP_3
+                                state_next = end_state;
                             end
-
-                            // Go to STOP
-                            state_next = STOP_1;
                         end else begin
                             clk_count_next = clk_count + 1;
                         end
@@ -599,7 +869,7 @@ module i2c_master (
                 sda_out_next = 1'b0;
                 sda_oe_next  = 1'b1;
 
-                if (clk_count == HALF_PERIOD - 1) begin
+                if (clk_count == half - 1) begin
                     clk_count_next = 10'd0;
                     state_next     = STOP_2;
                 end else begin
@@ -613,7 +883,7 @@ module i2c_master (
                 sda_out_next = 1'b0;
                 sda_oe_next  = 1'b1;
 
-                if (clk_count == HALF_PERIOD - 1) begin
+                if (clk_count == half - 1) begin
                     clk_count_next = 10'd0;
                     state_next     = STOP_3;
                 end else begin
@@ -627,7 +897,7 @@ module i2c_master (
                 sda_out_next = 1'b1;
                 sda_oe_next  = 1'b1;
 
-                if (clk_count == HALF_PERIOD - 1) begin
+                if (clk_count == half - 1) begin
                     clk_count_next = 10'd0;
                     done_next      = 1'b1;  // Signal completion
                     state_next     = IDLE;
@@ -0,0 +1,218 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// I2C Register Window Engine
+//==============================================================================
+// Turns one memory-mapped access to (slave, reg) into I2C transactions on
+// i2c_master, for register-pointer slaves (EEPROM word address, register
+// maps):
+//   Store : [START][ADDR+W][REG][DATA][STOP]
+//   Load  : [START][ADDR+W][REG][Sr][ADDR+R][DATA+NACK][STOP]
+// Features:
+//  - One access at a time; req is accepted only while busy = 0
+//  - busy doubles as the arbiter request; waits for grant before taking
+//    i2c_master (owner = 1 from then on)
+//  - Load uses i2c_master hold: no STOP between pointer write and read
+//  - nack reports a NACK on any byte; a NACKed load returns 8'hFF
+//==============================================================================
+
+module i2c_reg_window (
+    // Global Signals
+    input  logic        clk,            // 100 MHz system clock
+    input  logic        rst_n,          // Active-low reset
+
+    // Request Interface
+    input  logic        req,            // Start an access (pulse, busy = 0)
+    input  logic        req_read,       // 1 = load, 0 = store
+    input  logic [6:0]  req_addr,       // 7-bit slave address
+    input  logic [7:0]  req_reg,        // Register / word address
+    input  logic [7:0]  req_data,       // Store data
+    input  logic        grant,          // Arbiter grant: i2c_master is ours
+    output logic        busy,           // Access pending or in progress (request)
+    output logic        owner,          // Engine drives i2c_master
+    output logic        ack,            // Access finished (pulse)
+    output logic [7:0]  rd_data,        // Load data (valid with ack)
+    output logic        nack,           // Slave NACKed (valid with ack)
+
+    // i2c_master Control
+    output logic        m_start,
+    output logic        m_rw,
+    output logic [6:0]  m_addr,
+    output logic [7:0]  m_count,
+    output logic [7:0]  m_tx_data,
+    output logic        m_hold,
+    input  logic        m_tx_next,
+    input  logic [7:0]  m_rx_data,
+    input  logic        m_rx_valid,
+    input  logic        m_done,
+    input  logic        m_ack_error
+);
+
+    //==========================================================================
+    // Parameters
+    //==========================================================================
+    // State Encoding
+    typedef enum logic [2:0] {
+        IDLE      = 3'd0,
+        WAIT_BUS  = 3'd1,    // Request latched, waiting for the grant
+        ISSUE_WR  = 3'd2,    // Pulse m_start: [ADDR+W][REG]([DATA])
+        WAIT_WR   = 3'd3,    // Wait for m_done (HOLD after a load pointer)
+        ISSUE_RD  = 3'd4,    // Pulse m_start: Sr [ADDR+R][DATA]
+        WAIT_RD   = 3'd5     // Wait for m_done, capture data
+    } win_state_t;
+
+    //==========================================================================
+    // Internal Signals
+    //==========================================================================
+    win_state_t state, state_next;
+
+    logic       rd_op, rd_op_next;              // Access is a load
+    logic [6:0] addr, addr_next;
+    logic [7:0] reg_addr, reg_addr_next;
+    logic [7:0] data, data_next;                // Store data / load result
+    logic       tx_sel, tx_sel_next;            // 0 = REG is next, 1 = DATA
+    logic       m_start_reg, m_start_next;
+    logic       ack_reg, ack_next;
+    logic       nack_reg, nack_next;
+
+    //==========================================================================
+    // Output Assignments
+    //==========================================================================
+    assign busy      = (state != IDLE);
+    assign owner     = (state != IDLE) && (state != WAIT_BUS);
+    assign ack       = ack_reg;
+    assign nack      = nack_reg;
+    assign rd_data   = data;
+    assign m_start   = m_start_reg;
+    assign m_addr    = addr;
+    assign m_rw      = (state == ISSUE_RD) || (state == WAIT_RD);
+    assign m_count   = (rd_op || m_rw) ? 8'd1 : 8'd2;
+    assign m_tx_data = tx_sel ? data : reg_addr;
+    // Latched by i2c_master with the first start, held until the Sr start
+    assign m_hold    = rd_op && ((state == WAIT_WR) || (state == ISSUE_RD));
+
+    //==========================================================================
+    // Sequential Logic
+    //==========================================================================
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            state       <= IDLE;
+            rd_op       <= 1'b0;
+            addr        <= 7'd0;
+            reg_addr    <= 8'd0;
+            data        <= 8'd0;
+            tx_sel      <= 1'b0;
+            m_start_reg <= 1'b0;
+            ack_reg     <= 1'b0;
+            nack_reg    <= 1'b0;
+        end else begin
+            state       <= state_next;
+            rd_op       <= rd_op_next;
+            addr        <= addr_next;
+            reg_addr    <= reg_addr_next;
+            data        <= data_next;
+            tx_sel      <= tx_sel_next;
+            m_start_reg <= m_start_next;
+            ack_reg     <= ack_next;
+            nack_reg    <= nack_next;
+        end
+    end
+
+    //==========================================================================
+    // Combinational FSM
+    //==========================================================================
+    always_comb begin
+        // Defaults
+        state_next    = state;
+        rd_op_next    = rd_op;
+        addr_next     = addr;
+        reg_addr_next = reg_addr;
+        data_next     = data;
+        tx_sel_next   = tx_sel;
+        m_start_next  = 1'b0;   // Pulse
+        ack_next      = 1'b0;   // Pulse
+        nack_next     = nack_reg;
+
+        case (state)
+            //==================================================================
+            // IDLE: Latch a request
+            //==================================================================
+            IDLE: begin
+                if (req) begin
+                    rd_op_next    = req_read;
+                    addr_next     = req_addr;
+                    reg_addr_next = req_reg;
+                    data_next     = req_data;
+                    nack_next     = 1'b0;
+                    state_next    = WAIT_BUS;
+                end
+            end
+
+            //==================================================================
+            // WAIT_BUS: Take i2c_master once granted
+            //==================================================================
+            WAIT_BUS: begin
+                if (grant) begin
+                    state_next = ISSUE_WR;
+                end
+            end
+
+            //==================================================================
+            // ISSUE_WR / WAIT_WR: Register pointer (+ store data)
+            //==================================================================
+            ISSUE_WR: begin
+                tx_sel_next  = 1'b0;
+                m_start_next = 1'b1;
+                state_next   = WAIT_WR;
+            end
+
+            WAIT_WR: begin
+                if (m_tx_next) begin
+                    tx_sel_next = 1'b1;
+                end
+
+                if (m_done) begin
+                    if (m_ack_error) begin
+                        nack_next  = 1'b1;
+                        data_next  = rd_op ? 8'hFF : data;
+                        ack_next   = 1'b1;
+                        state_next = IDLE;
+                    end else if (rd_op) begin
+                        state_next = ISSUE_RD;
+                    end else begin
+                        ack_next   = 1'b1;
+                        state_next = IDLE;
+                    end
+                end
+            end
+
+            //==================================================================
+            // ISSUE_RD / WAIT_RD: Repeated START, read one byte
+            //==================================================================
+            ISSUE_RD: begin
+                m_start_next = 1'b1;
+                state_next   = WAIT_RD;
+            end
+
+            WAIT_RD: begin
+                if (m_rx_valid) begin
+                    data_next = m_rx_data;
+                end
+
+                if (m_done) begin
+                    if (m_ack_error) begin
+                        nack_next = 1'b1;
+                        data_next = 8'hFF;
+                    end
+                    ack_next   = 1'b1;
+                    state_next = IDLE;
+                end
+            end
+
+            default: begin
+                state_next = IDLE;
+            end
+        endcase
+    end
+
+endmodule
@@ -0,0 +1,299 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// SPI Master Module
+//==============================================================================
+// SPI transport for slave_register_map (spi_slave_protocol on the far end).
+// Uses the same control interface as i2c_master so the AXI IP can switch
+// between the two without changing the FIFO plumbing.
+// Features:
+//  - SPI mode 0 (CPOL=0, CPHA=0), MSB first, CS_N active low
+//  - SCK half period = clk_div clk cycles (5 = 10 MHz, 4 = 12.5 MHz max)
+//  - Write: [0x02][tx_data x byte_count]        (first byte = register)
+//  - Read:  [0x03][tx_data][DUMMY][rx_data x byte_count]
+//  - tx_next pulses each time tx_data is latched, rx_valid per read byte
+//  - MISO sampled at the end of the SCK high phase
+//==============================================================================
+
+module spi_master (
+    // Global Signals
+    input  logic        clk,            // 100 MHz system clock
+    input  logic        rst_n,          // Active-low reset
+
+    // Control Interface
+    input  logic        start,          // Start SPI frame (pulse)
+    input  logic        rw_bit,         // 0=Write, 1=Read
+    input  logic [7:0]  byte_count,     // Write: bytes incl. register, Read: data bytes (0 = 1)
+    input  logic [7:0]  clk_div,        // SCK half period in clk cycles (0 = 1)
+    input  logic [7:0]  tx_data,        // Data to transmit
+    output logic        tx_next,        // tx_data latched (pulse)
+    output logic [7:0]  rx_data,        // Received data
+    output logic        rx_valid,       // rx_data updated (pulse)
+    output logic        busy,           // Frame in progress
+    output logic        done,           // Frame completed (pulse)
+
+    // SPI Bus
+    output logic        sck,
+    output logic        mosi,
+    input  logic        miso,
+    output logic        cs_n,
+
+    // Debug Ports
+    output logic [2:0]  debug_state     // Current FSM state
+);
+
+    //==========================================================================
+    // Parameters
+    //==========================================================================
+    localparam logic [7:0] CMD_WRITE = 8'h02;
+    localparam logic [7:0] CMD_READ  = 8'h03;
+
+    // State Encoding
+    typedef enum logic [2:0] {
+        IDLE     = 3'd0,
+        SCK_LOW  = 3'd1,     // MOSI valid, SCK low
+        SCK_HIGH = 3'd2,     // SCK high, slave samples MOSI
+        CS_HOLD  = 3'd3,     // Last SCK fall -> CS_N rise
+        CS_IDLE  = 3'd4,     // CS_N high time before the next frame
+        DONE     = 3'd5
+    } spi_state_t;
+
+    // Byte phase within the frame
+    typedef enum logic [2:0] {
+        PH_CMD   = 3'd0,     // Command byte
+        PH_WDATA = 3'd1,     // Write: register + data bytes from tx_data
+        PH_ADDR  = 3'd2,     // Read: register byte from tx_data
+        PH_DUMMY = 3'd3,     // Read: turnaround byte
+        PH_RDATA = 3'd4      // Read: data bytes
+    } spi_phase_t;
+
+    //==========================================================================
+    // Internal Signals
+    //==========================================================================
+
+    // FSM State
+    spi_state_t state, state_next;
+    spi_phase_t phase, phase_next;
+
+    // SCK Generation
+    logic [7:0] clk_count, clk_count_next;
+    logic [7:0] half_period;                    // Latched clk_div (>= 1)
+    logic [7:0] half_period_next;
+    logic       half_done;
+    logic       sck_reg, sck_next;
+    logic       cs_n_reg, cs_n_next;
+
+    // Data Registers
+    logic       is_read_op, is_read_op_next;
+    logic [7:0] tx_shift, tx_shift_next;
+    logic [7:0] rx_shift, rx_shift_next;
+    logic [7:0] rx_byte;                        // Byte completed this edge
+    logic [2:0] bit_count, bit_count_next;
+    logic [7:0] bytes_left, bytes_left_next;
+
+    // Status Flags
+    logic [7:0] rx_data_reg, rx_data_next;
+    logic       tx_next_reg, tx_next_next;
+    logic       rx_valid_reg, rx_valid_next;
+    logic       done_reg, done_next;
+
+    //==========================================================================
+    // Output Assignments
+    //==========================================================================
+    assign sck      = sck_reg;
+    assign mosi     = tx_shift[7];
+    assign cs_n     = cs_n_reg;
+    assign rx_data  = rx_data_reg;
+    assign tx_next  = tx_next_reg;
+    assign rx_valid = rx_valid_reg;
+    assign done     = done_reg;
+    assign busy     = (state != IDLE);
+
+    assign debug_state = state;
+
+    assign half_done = (clk_count == half_period - 1);
+    assign rx_byte   = {rx_shift[6:0], miso};
+
+    //==========================================================================
+    // Sequential Logic
+    //==========================================================================
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            state        <= IDLE;
+            phase        <= PH_CMD;
+            clk_count    <= 8'd0;
+            half_period  <= 8'd1;
+            sck_reg      <= 1'b0;
+            cs_n_reg     <= 1'b1;
+            is_read_op   <= 1'b0;
+            tx_shift     <= 8'd0;
+            rx_shift     <= 8'd0;
+            bit_count    <= 3'd0;
+            bytes_left   <= 8'd0;
+            rx_data_reg  <= 8'd0;
+            tx_next_reg  <= 1'b0;
+            rx_valid_reg <= 1'b0;
+            done_reg     <= 1'b0;
+        end else begin
+            state        <= state_next;
+            phase        <= phase_next;
+            clk_count    <= clk_count_next;
+            half_period  <= half_period_next;
+            sck_reg      <= sck_next;
+            cs_n_reg     <= cs_n_next;
+            is_read_op   <= is_read_op_next;
+            tx_shift     <= tx_shift_next;
+            rx_shift     <= rx_shift_next;
+            bit_count    <= bit_count_next;
+            bytes_left   <= bytes_left_next;
+            rx_data_reg  <= rx_data_next;
+            tx_next_reg  <= tx_next_next;
+            rx_valid_reg <= rx_valid_next;
+            done_reg     <= done_next;
+        end
+    end
+
+    //==========================================================================
+    // Combinational FSM
+    //==========================================================================
+    always_comb begin
+        // Defaults
+        state_next       = state;
+        phase_next       = phase;
+        clk_count_next   = half_done ? 8'd0 : clk_count + 1;
+        half_period_next = half_period;
+        sck_next         = sck_reg;
+        cs_n_next        = cs_n_reg;
+        is_read_op_next  = is_read_op;
+        tx_shift_next    = tx_shift;
+        rx_shift_next    = rx_shift;
+        bit_count_next   = bit_count;
+        bytes_left_next  = bytes_left;
+        rx_data_next     = rx_data_reg;
+        tx_next_next     = 1'b0;  // Pulse
+        rx_valid_next    = 1'b0;  // Pulse
+        done_next        = 1'b0;  // Pulse
+
+        case (state)
+            //==================================================================
+            // IDLE: CS_N falls with the command MSB already on MOSI
+            //==================================================================
+            IDLE: begin
+                clk_count_next = 8'd0;
+                sck_next       = 1'b0;
+                cs_n_next      = 1'b1;
+
+                if (start) begin
+                    half_period_next = (clk_div == 8'd0) ? 8'd1 : clk_div;
+                    is_read_op_next  = rw_bit;
+                    bytes_left_next  = (byte_count == 8'd0) ? 8'd1 : byte_count;
+                    tx_shift_next    = rw_bit ? CMD_READ : CMD_WRITE;
+                    bit_count_next   = 3'd0;
+                    phase_next       = PH_CMD;
+                    cs_n_next        = 1'b0;
+                    state_next       = SCK_LOW;
+                end
+            end
+
+            //==================================================================
+            // SCK_LOW: Setup half, then rising edge
+            //==================================================================
+            SCK_LOW: begin
+                if (half_done) begin
+                    sck_next   = 1'b1;
+                    state_next = SCK_HIGH;
+                end
+            end
+
+            //==================================================================
+            // SCK_HIGH: Sample MISO, falling edge, next bit or next byte
+            //==================================================================
+            SCK_HIGH: begin
+                if (half_done) begin
+                    sck_next       = 1'b0;
+                    rx_shift_next  = rx_byte;
+                    bit_count_next = bit_count + 1;
+                    state_next     = SCK_LOW;
+
+                    if (bit_count != 3'd7) begin
+                        tx_shift_next = {tx_shift[6:0], 1'b0};
+                    end else begin
+                        // Byte boundary: pick the next byte by phase
+                        tx_shift_next = 8'h00;
+
+                        case (phase)
+                            PH_CMD: begin
+                                tx_shift_next = tx_data;
+                                tx_next_next  = 1'b1;
+                                phase_next    = is_read_op ? PH_ADDR : PH_WDATA;
+                            end
+
+                            PH_WDATA: begin
+                                bytes_left_next = bytes_left - 1;
+                                if (bytes_left == 8'd1) begin
+                                    state_next = CS_HOLD;
+                                end else begin
+                                    tx_shift_next = tx_data;
+                                    tx_next_next  = 1'b1;
+                                end
+                            end
+
+                            PH_ADDR: begin
+                                phase_next = PH_DUMMY;
+                            end
+
+                            PH_DUMMY: begin
+                                phase_next = PH_RDATA;
+                            end
+
+                            PH_RDATA: begin
+                                rx_data_next    = rx_byte;
+                                rx_valid_next   = 1'b1;
+                                bytes_left_next = bytes_left - 1;
+                                if (bytes_left == 8'd1) begin
+                                    state_next = CS_HOLD;
+                                end
+                            end
+
+                            default: begin
+                                state_next = CS_HOLD;
+                            end
+                        endcase
+                    end
+                end
+            end
+
+            //==================================================================
+            // CS_HOLD: Half period after the last falling edge, then CS_N high
+            //==================================================================
+            CS_HOLD: begin
+                if (half_done) begin
+                    cs_n_next  = 1'b1;
+                    state_next = CS_IDLE;
+                end
+            end
+
+            //==================================================================
+            // CS_IDLE: Keep CS_N high long enough for the slave to see it
+            //==================================================================
+            CS_IDLE: begin
+                if (half_done) begin
+                    state_next = DONE;
+                end
+            end
+
+            //==================================================================
+            // DONE: Signal completion
+            //==================================================================
+            DONE: begin
+                done_next  = 1'b1;
+                state_next = IDLE;
+            end
+
+            default: begin
+                state_next = IDLE;
+            end
+        endcase
+    end
+
+endmodule
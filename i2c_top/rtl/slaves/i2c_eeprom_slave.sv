@@ -0,0 +1,466 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// I2C EEPROM Slave (Address: 0x50, 24C02-compatible, 256 bytes)
+//==============================================================================
+// Bulk-transfer target backed by block RAM, modeled on a 24C02 EEPROM
+// Protocol:
+//   Byte/page write : [START][0xA0][WORD][D0][D1]...[STOP]
+//   Current read    : [START][0xA1][D0][ACK][D1]...[NACK][STOP]
+//   Random read     : [START][0xA0][WORD][Sr][0xA1][D0][ACK]...[NACK][STOP]
+//
+// Features:
+//  - Word-address pointer shared by reads and writes
+//  - Page write: pointer low bits wrap inside a PAGE_SIZE page (>= 2)
+//  - Sequential read: pointer wraps over the whole 256-byte array
+//  - Optional write cycle (WRITE_CYCLE_US > 0): after a write STOP the
+//    device NACKs its address until the cycle ends (ACK polling)
+//  - 256 x 8 memory with registered read (infers BRAM)
+//  - 50 ns spike filter, Fast-mode Plus (1 MHz) and Hs-mode (3.4 MHz)
+//    capable front end (see i2c_slave_frontend.sv)
+//==============================================================================
+
+module i2c_eeprom_slave #(
+    parameter int         CLK_FREQ       = 100_000_000,  // System clock (Hz)
+    parameter int         SPIKE_NS       = 50,           // F/S/Fm+ spike filter (tSP)
+    parameter int         HS_SPIKE_NS    = 10,           // Hs-mode spike filter (tSP)
+    parameter bit         HS_MODE_EN     = 1'b1,         // Recognize Hs-mode master code
+    parameter logic [6:0] SLAVE_ADDR     = 7'h50,        // 1010 + A2..A0
+    parameter int         PAGE_SIZE      = 8,            // Page write size (power of 2)
+    parameter int         WRITE_CYCLE_US = 0             // tWR (0 = no busy time)
+)(
+    // System
+    input  logic       clk,              // 100 MHz system clock
+    input  logic       rst_n,            // Active-low reset
+
+    // I2C Bus
+    input  logic       scl,              // I2C clock from master
+    inout  logic       sda,              // I2C data (bidirectional)
+
+    // Status
+    output logic       write_busy,       // Internal write cycle in progress
+
+    // Debug (optional)
+    output logic       debug_addr_match,
+    output logic [3:0] debug_state
+);
+
+    //==========================================================================
+    // Configuration
+    //==========================================================================
+    localparam int MEM_DEPTH = 256;
+    localparam int PAGE_W    = $clog2(PAGE_SIZE);
+    localparam int WR_CYCLES = WRITE_CYCLE_US * (CLK_FREQ / 1_000_000);
+    localparam int WR_CNT_W  = (WR_CYCLES > 1) ? $clog2(WR_CYCLES + 1) : 1;
+
+    //==========================================================================
+    // FSM States
+    //==========================================================================
+    typedef enum logic [3:0] {
+        IDLE          = 4'd0,    // Wait for START
+        RX_DEV_ADDR   = 4'd1,    // Receive device address (7-bit + R/W)
+        DEV_ADDR_ACK  = 4'd2,    // Send ACK for device address
+        RX_WORD_ADDR  = 4'd3,    // Receive word address
+        WORD_ADDR_ACK = 4'd4,    // Send ACK for word address
+        RX_DATA       = 4'd5,    // Receive write data
+        RX_DATA_ACK   = 4'd6,    // Send ACK for write data
+        TX_DATA       = 4'd7,    // Transmit read data
+        TX_DATA_ACK   = 4'd8,    // Wait for master ACK/NACK
+        WAIT_STOP     = 4'd9     // Wait for STOP
+    } state_t;
+
+    //==========================================================================
+    // Internal Signals
+    //==========================================================================
+    state_t state, state_next;
+
+    // Filtered bus view (from i2c_slave_frontend)
+    logic       scl_rising_edge;
+    logic       scl_falling_edge;
+    logic       scl_high;
+    logic       sda_in;
+
+    // Hs-mode (entered by master code 00001XXX, left on STOP)
+    logic       hs_mode, hs_mode_next;
+
+    // START/STOP detection
+    logic       start_detected;
+    logic       stop_detected;
+
+    // Data registers
+    logic [7:0] dev_addr_reg, dev_addr_next;
+    logic [7:0] rx_shift, rx_shift_next;
+    logic [7:0] tx_shift, tx_shift_next;
+    logic [2:0] bit_count, bit_count_next;
+    logic [7:0] received_addr;  // Address matching temp variable
+    logic [7:0] received_byte;  // Data byte temp variable
+
+    // Word-address pointer
+    logic [7:0] ptr, ptr_next;
+
+    // Control flags
+    logic       addr_match, addr_match_next;
+    logic       rd_ack, rd_ack_next;            // Master ACKed last read byte
+    logic       wr_dirty, wr_dirty_next;        // Data written in this frame
+    logic       rw_bit;
+
+    // SDA control
+    logic       sda_out, sda_out_next;
+    logic       sda_oe, sda_oe_next;
+
+    // Memory port
+    logic [7:0] mem [MEM_DEPTH];
+    logic       mem_we;
+    logic [7:0] mem_waddr;
+    logic [7:0] mem_wdata;
+    logic [7:0] mem_rdata;                      // mem[ptr], one cycle behind
+
+    // Write cycle timer
+    logic [WR_CNT_W-1:0] wr_cnt;
+    logic                wr_start;
+
+    //==========================================================================
+    // Output Assignments
+    //==========================================================================
+    assign sda = sda_oe ? sda_out : 1'bz;
+    assign rw_bit = dev_addr_reg[0];
+
+    assign write_busy       = (wr_cnt != 0);
+    assign debug_addr_match = addr_match;
+    assign debug_state      = state;
+
+    //==========================================================================
+    // Bus Front End (synchronizer + spike filter + START/STOP detect)
+    //==========================================================================
+    i2c_slave_frontend #(
+        .CLK_FREQ(CLK_FREQ),
+        .SPIKE_NS(SPIKE_NS),
+        .HS_SPIKE_NS(HS_SPIKE_NS)
+    ) frontend (
+        .clk(clk),
+        .rst_n(rst_n),
+        .hs_mode(hs_mode),
+        .scl(scl),
+        .sda(sda),
+        .scl_rising_edge(scl_rising_edge),
+        .scl_falling_edge(scl_falling_edge),
+        .scl_high(scl_high),
+        .sda_in(sda_in),
+        .start_detected(start_detected),
+        .stop_detected(stop_detected)
+    );
+
+    //==========================================================================
+    // Memory (single write port, registered read -> block RAM)
+    //==========================================================================
+    // Erased EEPROM reads 0xFF (BRAM init value, no reset). Plain always
+    // block: mem is also written by the initial block
+    initial begin
+        for (int i = 0; i < MEM_DEPTH; i++) mem[i] = 8'hFF;
+    end
+
+    always @(posedge clk) begin
+        if (mem_we) begin
+            mem[mem_waddr] <= mem_wdata;
+        end
+        mem_rdata <= mem[ptr];
+    end
+
+    //==========================================================================
+    // Write Cycle Timer (starts on STOP after a write, NACK while running)
+    //==========================================================================
+    assign wr_start = stop_detected && (state != IDLE) && wr_dirty;
+
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            wr_cnt <= '0;
+        end else if (wr_start && WR_CYCLES > 0) begin
+            wr_cnt <= WR_CNT_W'(WR_CYCLES);
+        end else if (wr_cnt != 0) begin
+            wr_cnt <= wr_cnt - 1;
+        end
+    end
+
+    //==========================================================================
+    // Sequential Logic
+    //==========================================================================
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            state        <= IDLE;
+            dev_addr_reg <= 8'd0;
+            rx_shift     <= 8'd0;
+            tx_shift     <= 8'd0;
+            bit_count    <= 3'd0;
+            ptr          <= 8'd0;
+            sda_out      <= 1'b1;
+            sda_oe       <= 1'b0;
+            addr_match   <= 1'b0;
+            rd_ack       <= 1'b0;
+            wr_dirty     <= 1'b0;
+            hs_mode      <= 1'b0;
+        end else begin
+            state        <= state_next;
+            dev_addr_reg <= dev_addr_next;
+            rx_shift     <= rx_shift_next;
+            tx_shift     <= tx_shift_next;
+            bit_count    <= bit_count_next;
+            ptr          <= ptr_next;
+            sda_out      <= sda_out_next;
+            sda_oe       <= sda_oe_next;
+            addr_match   <= addr_match_next;
+            rd_ack       <= rd_ack_next;
+            wr_dirty     <= wr_dirty_next;
+            hs_mode      <= hs_mode_next;
+        end
+    end
+
+    //==========================================================================
+    // Combinational FSM
+    //==========================================================================
+    always_comb begin
+        // Defaults
+        state_next      = state;
+        dev_addr_next   = dev_addr_reg;
+        rx_shift_next   = rx_shift;
+        tx_shift_next   = tx_shift;
+        bit_count_next  = bit_count;
+        ptr_next        = ptr;
+        sda_out_next    = sda_out;
+        sda_oe_next     = sda_oe;
+        addr_match_next = addr_match;
+        rd_ack_next     = rd_ack;
+        wr_dirty_next   = wr_dirty;
+        hs_mode_next    = hs_mode;
+        mem_we          = 1'b0;
+        mem_waddr       = ptr;
+        mem_wdata       = 8'h00;
+        received_addr   = 8'h00;  // Default to avoid latch
+        received_byte   = 8'h00;
+
+        // Global STOP detection
+        if (stop_detected && (state != IDLE)) begin
+            state_next      = IDLE;
+            sda_oe_next     = 1'b0;
+            bit_count_next  = 3'd0;
+            addr_match_next = 1'b0;
+            rd_ack_next     = 1'b0;
+            wr_dirty_next   = 1'b0;   // Write cycle timer takes over
+            hs_mode_next    = 1'b0;   // Hs-mode ends at STOP
+        end else begin
+            case (state)
+                //==============================================================
+                // IDLE: Wait for START
+                //==============================================================
+                IDLE: begin
+                    sda_oe_next     = 1'b0;
+                    bit_count_next  = 3'd0;
+                    addr_match_next = 1'b0;
+
+                    if (start_detected) begin
+                        // Go directly to RX_DEV_ADDR to avoid missing first bit
+                        state_next = RX_DEV_ADDR;
+                    end
+                end
+
+                //==============================================================
+                // RX_DEV_ADDR: Receive device address (7-bit + R/W)
+                //==============================================================
+                RX_DEV_ADDR: begin
+                    sda_oe_next = 1'b0;
+
+                    if (scl_rising_edge) begin
+                        dev_addr_next = {dev_addr_reg[6:0], sda_in};
+                        bit_count_next = bit_count + 1;
+
+                        if (bit_count == 7) begin
+                            bit_count_next = 3'd0;
+                            state_next = DEV_ADDR_ACK;
+
+                            // Use intermediate variable for Vivado XSim compatibility
+                            // Busy write cycle: NACK so the master can poll
+                            received_addr = {dev_addr_reg[6:0], sda_in};
+                            addr_match_next = (received_addr[7:1] == SLAVE_ADDR) &&
+                                              !write_busy;
+
+                            // Hs-mode master code (00001XXX): never ACKed,
+                            // switch filters and wait for repeated START
+                            if (HS_MODE_EN && received_addr[7:3] == 5'b00001) begin
+                                hs_mode_next = 1'b1;
+                            end
+                        end
+                    end
+                end
+
+                //==============================================================
+                // DEV_ADDR_ACK: Send ACK if address matched
+                //==============================================================
+                DEV_ADDR_ACK: begin
+                    if (addr_match) begin
+                        if (scl_falling_edge) begin
+                            sda_oe_next  = 1'b1;
+                            sda_out_next = 1'b0;  // ACK
+                        end
+
+                        if (scl_rising_edge) begin
+                            sda_oe_next  = 1'b1;
+                            sda_out_next = 1'b0;
+                        end
+
+                        if (scl_falling_edge && sda_oe) begin
+                            if (rw_bit) begin
+                                // Read at current pointer, drive MSB now
+                                sda_oe_next    = 1'b1;
+                                sda_out_next   = mem_rdata[7];
+                                tx_shift_next  = mem_rdata;
+                                ptr_next       = ptr + 1;
+                                bit_count_next = 3'd0;
+                                state_next     = TX_DATA;
+                            end else begin
+                                sda_oe_next = 1'b0;
+                                state_next  = RX_WORD_ADDR;
+                            end
+                        end
+                    end else begin
+                        sda_oe_next = 1'b0;
+                        state_next = WAIT_STOP;
+                    end
+                end
+
+                //==============================================================
+                // RX_WORD_ADDR: Receive word address (pointer)
+                //==============================================================
+                RX_WORD_ADDR: begin
+                    sda_oe_next = 1'b0;
+
+                    if (scl_rising_edge) begin
+                        rx_shift_next = {rx_shift[6:0], sda_in};
+                        bit_count_next = bit_count + 1;
+
+                        if (bit_count == 7) begin
+                            bit_count_next = 3'd0;
+                            ptr_next = {rx_shift[6:0], sda_in};
+                            state_next = WORD_ADDR_ACK;
+                        end
+                    end
+                end
+
+                //==============================================================
+                // WORD_ADDR_ACK / RX_DATA_ACK: Send ACK, then more write data
+                //==============================================================
+                WORD_ADDR_ACK, RX_DATA_ACK: begin
+                    if (scl_falling_edge) begin
+                        sda_oe_next  = 1'b1;
+                        sda_out_next = 1'b0;  // ACK
+                    end
+
+                    if (scl_rising_edge) begin
+                        sda_oe_next  = 1'b1;
+                        sda_out_next = 1'b0;
+                    end
+
+                    if (scl_falling_edge && sda_oe) begin
+                        sda_oe_next = 1'b0;
+                        state_next = RX_DATA;
+                    end
+                end
+
+                //==============================================================
+                // RX_DATA: Receive write data (or Sr for random read)
+                //==============================================================
+                RX_DATA: begin
+                    sda_oe_next = 1'b0;
+
+                    if (start_detected) begin
+                        // Repeated START: random read after word address
+                        bit_count_next = 3'd0;
+                        state_next = RX_DEV_ADDR;
+                    end else if (scl_rising_edge) begin
+                        rx_shift_next = {rx_shift[6:0], sda_in};
+                        bit_count_next = bit_count + 1;
+
+                        if (bit_count == 7) begin
+                            // Write at pointer, roll over inside the page
+                            received_byte  = {rx_shift[6:0], sda_in};
+                            mem_we         = 1'b1;
+                            mem_waddr      = ptr;
+                            mem_wdata      = received_byte;
+                            ptr_next       = {ptr[7:PAGE_W], ptr[PAGE_W-1:0] + 1'b1};
+                            wr_dirty_next  = 1'b1;
+                            bit_count_next = 3'd0;
+                            state_next     = RX_DATA_ACK;
+                        end
+                    end
+                end
+
+                //==============================================================
+                // TX_DATA: Transmit read data
+                //==============================================================
+                TX_DATA: begin
+                    if (scl_falling_edge) begin
+                        sda_oe_next  = 1'b1;
+                        sda_out_next = tx_shift[7];  // MSB first
+                    end
+
+                    if (scl_rising_edge) begin
+                        bit_count_next = bit_count + 1;
+
+                        if (bit_count == 7) begin
+                            bit_count_next = 3'd0;
+                            state_next = TX_DATA_ACK;
+                        end else begin
+                            tx_shift_next = {tx_shift[6:0], 1'b0};
+                        end
+                    end
+                end
+
+                //==============================================================
+                // TX_DATA_ACK: ACK -> next sequential byte, NACK -> done
+                //==============================================================
+                TX_DATA_ACK: begin
+                    // Release SDA on falling edge to ensure last bit is stable
+                    if (scl_falling_edge) begin
+                        sda_oe_next = 1'b0;
+                    end
+
+                    if (scl_rising_edge) begin
+                        if (sda_in) begin
+                            state_next = WAIT_STOP;   // NACK: last byte
+                        end else begin
+                            rd_ack_next = 1'b1;
+                        end
+                    end
+
+                    if (scl_falling_edge && rd_ack) begin
+                        // ACK slot over, drive next byte MSB
+                        rd_ack_next    = 1'b0;
+                        sda_oe_next    = 1'b1;
+                        sda_out_next   = mem_rdata[7];
+                        tx_shift_next  = mem_rdata;
+                        ptr_next       = ptr + 1;
+                        bit_count_next = 3'd0;
+                        state_next     = TX_DATA;
+                    end
+                end
+
+                //==============================================================
+                // WAIT_STOP: Wait for STOP
+                //==============================================================
+                WAIT_STOP: begin
+                    sda_oe_next     = 1'b0;
+                    bit_count_next  = 3'd0;
+                    // Will return to IDLE on STOP detection
+
+                    // Repeated START (e.g. after Hs-mode master code)
+                    if (start_detected) begin
+                        state_next = RX_DEV_ADDR;
+                    end
+                end
+
+                default: begin
+                    state_next = IDLE;
+                end
+            endcase
+        end
+    end
+
+endmodule
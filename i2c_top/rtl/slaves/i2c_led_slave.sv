@@ -11,9 +11,26 @@
 //  - Single-byte write-only protocol
 //  - No register addressing needed
 //  - Direct LED control
+//  - 50 ns spike filter, Fast-mode Plus (1 MHz) and Hs-mode (3.4 MHz)
+//    capable front end (see i2c_slave_frontend.sv)
+//  - General call (GCALL_EN): [START][0x00][CMD][DATA...][STOP]
+//      CMD[7:4] opcode, CMD[3:0] device mask (bit GC_ID selects this slave)
+//      0x1m WRITE : data -> shadow, all selected devices update at STOP
+//      0x2m STAGE : data -> shadow, held until a LATCH
+//      0x3m LATCH : no data, shadow -> output at STOP ("latch now")
+//    Data byte k goes to the k-th selected device in GC_ID order
+//    (LED = 0, FND = 1), so one transaction updates several slaves and
+//    every slave sees the same STOP, updating in the same clock cycle
 //==============================================================================
 
-module i2c_led_slave (
+module i2c_led_slave #(
+    parameter int CLK_FREQ    = 100_000_000,  // System clock (Hz)
+    parameter int SPIKE_NS    = 50,           // F/S/Fm+ spike filter (tSP)
+    parameter int HS_SPIKE_NS = 10,           // Hs-mode spike filter (tSP)
+    parameter bit HS_MODE_EN  = 1'b1,         // Recognize Hs-mode master code
+    parameter bit GCALL_EN    = 1'b1,         // Respond to general call (0x00)
+    parameter int GC_ID       = 0             // Bit in general-call device mask
+)(
     // System
     input  logic       clk,              // 100 MHz system clock
     input  logic       rst_n,            // Active-low reset
@@ -35,6 +52,11 @@ module i2c_led_slave (
     //==========================================================================
     localparam logic [6:0] SLAVE_ADDR = 7'h55;
 
+    // General call command opcodes (CMD[7:4])
+    localparam logic [3:0] GC_OP_WRITE = 4'h1;
+    localparam logic [3:0] GC_OP_STAGE = 4'h2;
+    localparam logic [3:0] GC_OP_LATCH = 4'h3;
+
     //==========================================================================
     // FSM States
     //==========================================================================
@@ -54,14 +76,14 @@ module i2c_led_slave (
     //==========================================================================
     state_t state, state_next;
 
-    // SCL/SDA synchronization
-    logic [2:0] scl_sync;
-    logic [2:0] sda_sync;
+    // Filtered bus view (from i2c_slave_frontend)
     logic       scl_rising_edge;
     logic       scl_falling_edge;
     logic       scl_high;
     logic       sda_in;
-    logic       sda_prev;
+
+    // Hs-mode (entered by master code 00001XXX, left on STOP)
+    logic       hs_mode, hs_mode_next;
 
     // START/STOP detection
     logic       start_detected;
@@ -77,12 +99,23 @@ module i2c_led_slave (
     logic       addr_match, addr_match_next;
     logic       rw_bit;
 
+    // General call
+    logic       gc_active, gc_active_next;        // Current transfer is 0x00
+    logic       gc_cmd_valid, gc_cmd_valid_next;  // Command byte received
+    logic [7:0] gc_cmd, gc_cmd_next;
+    logic [3:0] gc_byte_idx, gc_byte_idx_next;    // Data bytes after CMD
+    logic       gc_selected;                      // Mask bit for this slave
+    logic       gc_ack;                           // ACK current byte
+    logic       latch_pending, latch_pending_next;
+    logic       shadow_valid, shadow_valid_next;
+
     // SDA control
     logic       sda_out, sda_out_next;
     logic       sda_oe, sda_oe_next;
 
     // LED register
     logic [7:0] led_reg, led_reg_next;
+    logic [7:0] shadow_reg, shadow_reg_next;      // General-call staging
 
     //==========================================================================
     // Output Assignments
@@ -91,34 +124,47 @@ module i2c_led_slave (
     assign rw_bit = dev_addr_reg[0];
     assign LED = led_reg;
 
+    assign gc_selected = gc_cmd[GC_ID];
+
+    // Unknown general-call commands are NACKed
+    assign gc_ack = !gc_active || gc_cmd_valid ||
+                    (rx_shift[7:4] == GC_OP_WRITE) ||
+                    (rx_shift[7:4] == GC_OP_STAGE) ||
+                    (rx_shift[7:4] == GC_OP_LATCH);
+
     assign debug_addr_match = addr_match;
     assign debug_state = state;
 
     //==========================================================================
-    // SCL/SDA Synchronization
+    // Bus Front End (synchronizer + spike filter + START/STOP detect)
     //==========================================================================
-    always_ff @(posedge clk or negedge rst_n) begin
-        if (!rst_n) begin
-            scl_sync <= 3'b111;
-            sda_sync <= 3'b111;
-            sda_prev <= 1'b1;
-        end else begin
-            scl_sync <= {scl_sync[1:0], scl};
-            sda_sync <= {sda_sync[1:0], sda};
-            sda_prev <= sda_in;
-        end
-    end
-
-    assign scl_rising_edge  = (scl_sync[2:1] == 2'b01);
-    assign scl_falling_edge = (scl_sync[2:1] == 2'b10);
-    assign scl_high         = scl_sync[2];
-    assign sda_in           = sda_sync[2];
-
-    // START: SDA falls while SCL high
-    assign start_detected = (sda_prev & ~sda_in) & scl_high;
+    i2c_slave_frontend #(
+        .CLK_FREQ(CLK_FREQ),
+        .SPIKE_NS(SPIKE_NS),
+        .HS_SPIKE_NS(HS_SPIKE_NS)
+    ) frontend (
+        .clk(clk),
+        .rst_n(rst_n),
+        .hs_mode(hs_mode),
+        .scl(scl),
+        .sda(sda),
+        .scl_rising_edge(scl_rising_edge),
+        .scl_falling_edge(scl_falling_edge),
+        .scl_high(scl_high),
+        .sda_in(sda_in),
+        .start_detected(start_detected),
+        .stop_detected(stop_detected)
+    );
 
-    // STOP: SDA rises while SCL high
-    assign stop_detected = (~sda_prev & sda_in) & scl_high;
+    //==========================================================================
+    // General-Call Data Slot: selected devices below GC_ID come first
+    //==========================================================================
+    function automatic logic [3:0] gc_slot(input logic [3:0] mask);
+        gc_slot = 4'd0;
+        for (int i = 0; i < GC_ID; i++) begin
+            gc_slot = gc_slot + mask[i];
+        end
+    endfunction
 
     //==========================================================================
     // Sequential Logic
@@ -132,6 +178,14 @@ module i2c_led_slave (
             sda_out      <= 1'b1;
             sda_oe       <= 1'b0;
             addr_match   <= 1'b0;
+            hs_mode      <= 1'b0;
+            gc_active    <= 1'b0;
+            gc_cmd_valid <= 1'b0;
+            gc_cmd       <= 8'd0;
+            gc_byte_idx  <= 4'd0;
+            latch_pending <= 1'b0;
+            shadow_valid <= 1'b0;
+            shadow_reg   <= '0;
             led_reg      <= 8'd0;
         end else begin
             state        <= state_next;
@@ -141,6 +195,14 @@ module i2c_led_slave (
             sda_out      <= sda_out_next;
             sda_oe       <= sda_oe_next;
             addr_match   <= addr_match_next;
+            hs_mode      <= hs_mode_next;
+            gc_active    <= gc_active_next;
+            gc_cmd_valid <= gc_cmd_valid_next;
+            gc_cmd       <= gc_cmd_next;
+            gc_byte_idx  <= gc_byte_idx_next;
+            latch_pending <= latch_pending_next;
+            shadow_valid <= shadow_valid_next;
+            shadow_reg   <= shadow_reg_next;
             led_reg      <= led_reg_next;
         end
     end
@@ -157,6 +219,14 @@ module i2c_led_slave (
         sda_out_next   = sda_out;
         sda_oe_next    = sda_oe;
         addr_match_next = addr_match;
+        hs_mode_next   = hs_mode;
+        gc_active_next = gc_active;
+        gc_cmd_valid_next = gc_cmd_valid;
+        gc_cmd_next    = gc_cmd;
+        gc_byte_idx_next = gc_byte_idx;
+        latch_pending_next = latch_pending;
+        shadow_valid_next = shadow_valid;
+        shadow_reg_next = shadow_reg;
         led_reg_next   = led_reg;
         received_addr  = 8'h00;  // Default to avoid latch
 
@@ -166,6 +236,15 @@ module i2c_led_slave (
             sda_oe_next     = 1'b0;
             bit_count_next  = 3'd0;
             addr_match_next = 1'b0;
+            hs_mode_next    = 1'b0;   // Hs-mode ends at STOP
+            gc_active_next  = 1'b0;
+
+            // General call: every selected slave updates on this STOP
+            if (latch_pending && shadow_valid) begin
+                led_reg_next = shadow_reg;
+                shadow_valid_next = 1'b0;
+            end
+            latch_pending_next = 1'b0;
         end else begin
             case (state)
                 //==============================================================
@@ -202,9 +281,21 @@ module i2c_led_slave (
                             if (received_addr[7:1] == SLAVE_ADDR &&
                                 received_addr[0] == 1'b0) begin
                                 addr_match_next = 1'b1;
+                            end else if (GCALL_EN && received_addr == 8'h00) begin
+                                addr_match_next = 1'b1;   // General call
                             end else begin
                                 addr_match_next = 1'b0;
                             end
+
+                            gc_active_next    = GCALL_EN && (received_addr == 8'h00);
+                            gc_cmd_valid_next = 1'b0;
+                            gc_byte_idx_next  = 4'd0;
+
+                            // Hs-mode master code (00001XXX): never ACKed,
+                            // switch filters and wait for repeated START
+                            if (HS_MODE_EN && received_addr[7:3] == 5'b00001) begin
+                                hs_mode_next = 1'b1;
+                            end
                         end
                     end
                 end
@@ -240,7 +331,11 @@ module i2c_led_slave (
                 RX_DATA: begin
                     sda_oe_next = 1'b0;
 
-                    if (scl_rising_edge) begin
+                    if (start_detected) begin
+                        // Repeated START between general-call bytes
+                        bit_count_next = 3'd0;
+                        state_next = RX_DEV_ADDR;
+                    end else if (scl_rising_edge) begin
                         rx_shift_next = {rx_shift[6:0], sda_in};
                         bit_count_next = bit_count + 1;
 
@@ -255,20 +350,49 @@ module i2c_led_slave (
                 // RX_DATA_ACK: Send ACK and update LED
                 //==============================================================
                 RX_DATA_ACK: begin
-                    if (scl_falling_edge) begin
-                        sda_oe_next  = 1'b1;
-                        sda_out_next = 1'b0;  // ACK
-                    end
+                    if (!gc_ack) begin
+                        sda_oe_next = 1'b0;   // NACK unknown general-call command
+                        state_next = WAIT_STOP;
+                    end else begin
+                        if (scl_falling_edge) begin
+                            sda_oe_next  = 1'b1;
+                            sda_out_next = 1'b0;  // ACK
+                        end
 
-                    if (scl_rising_edge) begin
-                        sda_oe_next  = 1'b1;
-                        sda_out_next = 1'b0;
-                    end
+                        if (scl_rising_edge) begin
+                            sda_oe_next  = 1'b1;
+                            sda_out_next = 1'b0;
+                        end
 
-                    if (scl_falling_edge && sda_oe) begin
-                        sda_oe_next = 1'b0;
-                        led_reg_next = rx_shift[7:0];  // rx_shift already has all 8 bits
-                        state_next = WAIT_STOP;
+                        if (scl_falling_edge && sda_oe) begin
+                            sda_oe_next = 1'b0;
+
+                            if (!gc_active) begin
+                                led_reg_next = rx_shift[7:0];  // rx_shift already has all 8 bits
+                                state_next = WAIT_STOP;
+                            end else if (!gc_cmd_valid) begin
+                                // General call command byte
+                                gc_cmd_valid_next = 1'b1;
+                                gc_cmd_next       = rx_shift;
+                                if (rx_shift[7:4] == GC_OP_LATCH && rx_shift[GC_ID]) begin
+                                    latch_pending_next = 1'b1;
+                                end
+                                state_next = RX_DATA;
+                            end else begin
+                                // General call data byte: keep only this slave's slot
+                                if (gc_selected && gc_byte_idx == gc_slot(gc_cmd[3:0])) begin
+                                    shadow_reg_next   = rx_shift[7:0];
+                                    shadow_valid_next = 1'b1;
+                                    if (gc_cmd[7:4] == GC_OP_WRITE) begin
+                                        latch_pending_next = 1'b1;
+                                    end
+                                end
+                                if (gc_byte_idx != 4'hF) begin
+                                    gc_byte_idx_next = gc_byte_idx + 1;
+                                end
+                                state_next = RX_DATA;
+                            end
+                        end
                     end
                 end
 
@@ -278,6 +402,12 @@ module i2c_led_slave (
                 WAIT_STOP: begin
                     sda_oe_next = 1'b0;
                     // Will return to IDLE on STOP detection
+
+                    // Repeated START (e.g. after Hs-mode master code)
+                    if (start_detected) begin
+                        bit_count_next = 3'd0;
+                        state_next = RX_DEV_ADDR;
+                    end
                 end
 
                 //==============================================================
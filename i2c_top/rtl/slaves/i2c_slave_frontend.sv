@@ -0,0 +1,161 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// I2C Slave Front End (Synchronizer + Spike Filter + Bus Condition Detect)
+//==============================================================================
+// Shared input stage for the i2c_top slaves
+//
+// Pipeline per line:
+//   pin -> 2-FF synchronizer -> spike filter -> edge / START / STOP detect
+//
+// Features:
+//  - Spike filter: a level change must be stable for SPIKE_NS before it is
+//    accepted (I2C tSP = 50 ns for Standard / Fast / Fast-mode Plus)
+//  - Hs-mode: shorter filter (HS_SPIKE_NS, tSP = 10 ns) selected by hs_mode
+//  - SDA hold: in F/S mode SDA is delayed SDA_HOLD_CYCLES behind SCL so a
+//    data change right after SCL falls is never seen as START/STOP
+//
+// Latency (100 MHz, defaults):
+//   F/S/Fm+ : SCL 2 + 5 + 1 = 8 cycles (80 ns), SDA +2 cycles
+//   Hs      : SCL 2 + 1 + 1 = 4 cycles (40 ns)
+//==============================================================================
+
+module i2c_slave_frontend #(
+    parameter int CLK_FREQ        = 100_000_000,  // System clock (Hz)
+    parameter int SPIKE_NS        = 50,           // F/S/Fm+ spike width (ns)
+    parameter int HS_SPIKE_NS     = 10,           // Hs-mode spike width (ns)
+    parameter int SDA_HOLD_CYCLES = 2             // F/S SDA delay vs SCL
+)(
+    input  logic clk,
+    input  logic rst_n,
+
+    // Mode select (from slave FSM)
+    input  logic hs_mode,            // 1 = Hs-mode filter / no SDA delay
+
+    // Raw I2C pins
+    input  logic scl,
+    input  logic sda,
+
+    // Filtered bus view
+    output logic scl_rising_edge,
+    output logic scl_falling_edge,
+    output logic scl_high,
+    output logic sda_in,
+    output logic start_detected,     // SDA falls while SCL high
+    output logic stop_detected       // SDA rises while SCL high
+);
+
+    //==========================================================================
+    // Filter Length (in clk cycles, rounded up, minimum 1)
+    //==========================================================================
+    localparam int CLK_NS          = 1_000_000_000 / CLK_FREQ;
+    localparam int FS_SPIKE_CYCLES = (SPIKE_NS    + CLK_NS - 1) / CLK_NS;
+    localparam int HS_SPIKE_CYCLES = (HS_SPIKE_NS + CLK_NS - 1) / CLK_NS;
+    localparam int FS_LIMIT        = (FS_SPIKE_CYCLES > 0) ? FS_SPIKE_CYCLES : 1;
+    localparam int HS_LIMIT        = (HS_SPIKE_CYCLES > 0) ? HS_SPIKE_CYCLES : 1;
+    localparam int CNT_W           = $clog2(FS_LIMIT + 1);
+    localparam int HOLD_W          = (SDA_HOLD_CYCLES > 0) ? SDA_HOLD_CYCLES : 1;
+
+    //==========================================================================
+    // Internal Signals
+    //==========================================================================
+    logic [1:0]       scl_sync;
+    logic [1:0]       sda_sync;
+    logic             scl_filt, sda_filt;
+    logic [CNT_W-1:0] scl_cnt,  sda_cnt;
+    logic [CNT_W-1:0] filt_limit;
+    logic             scl_prev;
+    logic [HOLD_W-1:0] sda_dly;
+    logic             sda_cur;
+    logic             sda_prev;
+
+    assign filt_limit = hs_mode ? CNT_W'(HS_LIMIT) : CNT_W'(FS_LIMIT);
+
+    //==========================================================================
+    // 2-FF Synchronizer
+    //==========================================================================
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            scl_sync <= 2'b11;
+            sda_sync <= 2'b11;
+        end else begin
+            scl_sync <= {scl_sync[0], scl};
+            sda_sync <= {sda_sync[0], sda};
+        end
+    end
+
+    //==========================================================================
+    // Spike Filter: output follows input only after FS/HS_LIMIT stable cycles
+    //==========================================================================
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            scl_filt <= 1'b1;
+            scl_cnt  <= '0;
+        end else if (scl_sync[1] == scl_filt) begin
+            scl_cnt  <= '0;
+        end else if (scl_cnt >= filt_limit - 1) begin
+            scl_filt <= scl_sync[1];
+            scl_cnt  <= '0;
+        end else begin
+            scl_cnt  <= scl_cnt + 1;
+        end
+    end
+
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            sda_filt <= 1'b1;
+            sda_cnt  <= '0;
+        end else if (sda_sync[1] == sda_filt) begin
+            sda_cnt  <= '0;
+        end else if (sda_cnt >= filt_limit - 1) begin
+            sda_filt <= sda_sync[1];
+            sda_cnt  <= '0;
+        end else begin
+            sda_cnt  <= sda_cnt + 1;
+        end
+    end
+
+    //==========================================================================
+    // SDA Hold Delay (F/S only) and Edge History
+    //==========================================================================
+    generate
+        if (SDA_HOLD_CYCLES > 1) begin : g_sda_hold
+            always_ff @(posedge clk or negedge rst_n) begin
+                if (!rst_n) sda_dly <= '1;
+                else        sda_dly <= {sda_dly[HOLD_W-2:0], sda_filt};
+            end
+        end else begin : g_sda_hold_1
+            always_ff @(posedge clk or negedge rst_n) begin
+                if (!rst_n) sda_dly <= '1;
+                else        sda_dly <= sda_filt;
+            end
+        end
+    endgenerate
+
+    assign sda_cur = (hs_mode || SDA_HOLD_CYCLES == 0) ? sda_filt : sda_dly[HOLD_W-1];
+
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            scl_prev <= 1'b1;
+            sda_prev <= 1'b1;
+        end else begin
+            scl_prev <= scl_filt;
+            sda_prev <= sda_cur;
+        end
+    end
+
+    //==========================================================================
+    // Outputs
+    //==========================================================================
+    assign scl_rising_edge  = ~scl_prev &  scl_filt;
+    assign scl_falling_edge =  scl_prev & ~scl_filt;
+    assign scl_high         =  scl_filt;
+    assign sda_in           =  sda_cur;
+
+    // START: SDA falls while SCL high
+    assign start_detected = (sda_prev & ~sda_cur) & scl_high;
+
+    // STOP: SDA rises while SCL high
+    assign stop_detected  = (~sda_prev & sda_cur) & scl_high;
+
+endmodule
@@ -12,9 +12,16 @@
 //  - Single-byte read-only protocol
 //  - Returns SW[7:0] value
 //  - No register addressing needed
+//  - 50 ns spike filter, Fast-mode Plus (1 MHz) and Hs-mode (3.4 MHz)
+//    capable front end (see i2c_slave_frontend.sv)
 //==============================================================================
 
-module i2c_switch_slave (
+module i2c_switch_slave #(
+    parameter int CLK_FREQ    = 100_000_000,  // System clock (Hz)
+    parameter int SPIKE_NS    = 50,           // F/S/Fm+ spike filter (tSP)
+    parameter int HS_SPIKE_NS = 10,           // Hs-mode spike filter (tSP)
+    parameter bit HS_MODE_EN  = 1'b1          // Recognize Hs-mode master code
+)(
     // System
     input  logic       clk,              // 100 MHz system clock
     input  logic       rst_n,            // Active-low reset
@@ -55,14 +62,14 @@ module i2c_switch_slave (
     //==========================================================================
     state_t state, state_next;
 
-    // SCL/SDA synchronization
-    logic [2:0] scl_sync;
-    logic [2:0] sda_sync;
+    // Filtered bus view (from i2c_slave_frontend)
     logic       scl_rising_edge;
     logic       scl_falling_edge;
     logic       scl_high;
     logic       sda_in;
-    logic       sda_prev;
+
+    // Hs-mode (entered by master code 00001XXX, left on STOP)
+    logic       hs_mode, hs_mode_next;
 
     // START/STOP detection
     logic       start_detected;
@@ -92,30 +99,25 @@ module i2c_switch_slave (
     assign debug_state = state;
 
     //==========================================================================
-    // SCL/SDA Synchronization
+    // Bus Front End (synchronizer + spike filter + START/STOP detect)
     //==========================================================================
-    always_ff @(posedge clk or negedge rst_n) begin
-        if (!rst_n) begin
-            scl_sync <= 3'b111;
-            sda_sync <= 3'b111;
-            sda_prev <= 1'b1;
-        end else begin
-            scl_sync <= {scl_sync[1:0], scl};
-            sda_sync <= {sda_sync[1:0], sda};
-            sda_prev <= sda_in;
-        end
-    end
-
-    assign scl_rising_edge  = (scl_sync[2:1] == 2'b01);
-    assign scl_falling_edge = (scl_sync[2:1] == 2'b10);
-    assign scl_high         = scl_sync[2];
-    assign sda_in           = sda_sync[2];
-
-    // START: SDA falls while SCL high
-    assign start_detected = (sda_prev & ~sda_in) & scl_high;
-
-    // STOP: SDA rises while SCL high
-    assign stop_detected = (~sda_prev & sda_in) & scl_high;
+    i2c_slave_frontend #(
+        .CLK_FREQ(CLK_FREQ),
+        .SPIKE_NS(SPIKE_NS),
+        .HS_SPIKE_NS(HS_SPIKE_NS)
+    ) frontend (
+        .clk(clk),
+        .rst_n(rst_n),
+        .hs_mode(hs_mode),
+        .scl(scl),
+        .sda(sda),
+        .scl_rising_edge(scl_rising_edge),
+        .scl_falling_edge(scl_falling_edge),
+        .scl_high(scl_high),
+        .sda_in(sda_in),
+        .start_detected(start_detected),
+        .stop_detected(stop_detected)
+    );
 
     //==========================================================================
     // Sequential Logic
@@ -129,6 +131,7 @@ module i2c_switch_slave (
             sda_out      <= 1'b1;
             sda_oe       <= 1'b0;
             addr_match   <= 1'b0;
+            hs_mode      <= 1'b0;
         end else begin
             state        <= state_next;
             dev_addr_reg <= dev_addr_next;
@@ -137,6 +140,7 @@ module i2c_switch_slave (
             sda_out      <= sda_out_next;
             sda_oe       <= sda_oe_next;
             addr_match   <= addr_match_next;
+            hs_mode      <= hs_mode_next;
         end
     end
 
@@ -152,6 +156,7 @@ module i2c_switch_slave (
         sda_out_next   = sda_out;
         sda_oe_next    = sda_oe;
         addr_match_next = addr_match;
+        hs_mode_next   = hs_mode;
         received_addr  = 8'h00;  // Default to avoid latch
 
         // Global STOP detection
@@ -160,6 +165,7 @@ module i2c_switch_slave (
             sda_oe_next     = 1'b0;
             bit_count_next  = 3'd0;
             addr_match_next = 1'b0;
+            hs_mode_next    = 1'b0;   // Hs-mode ends at STOP
         end else begin
             case (state)
                 //==============================================================
@@ -200,6 +206,12 @@ module i2c_switch_slave (
                             end else begin
                                 addr_match_next = 1'b0;
                             end
+
+                            // Hs-mode master code (00001XXX): never ACKed,
+                            // switch filters and wait for repeated START
+                            if (HS_MODE_EN && received_addr[7:3] == 5'b00001) begin
+                                hs_mode_next = 1'b1;
+                            end
                         end
                     end
                 end
@@ -277,6 +289,11 @@ module i2c_switch_slave (
                     sda_oe_next     = 1'b0;
                     bit_count_next  = 3'd0;  // Ensure clean state
                     // Will return to IDLE on STOP detection
+
+                    // Repeated START (e.g. after Hs-mode master code)
+                    if (start_detected) begin
+                        state_next = RX_DEV_ADDR;
+                    end
                 end
 
                 //==============================================================
@@ -14,7 +14,7 @@ PASS_COUNT=0
 FAIL_COUNT=0
 
 # Test 1: LED Slave
-echo ">>> Test 1/4: LED Slave"
+echo ">>> Test 1/18: LED Slave"
 ./run_led_slave.sh > /tmp/led_test.log 2>&1
 if [ $? -eq 0 ]; then
     echo "✓ LED Slave test passed"
@@ -26,7 +26,7 @@ fi
 echo ""
 
 # Test 2: FND Slave
-echo ">>> Test 2/4: FND Slave"
+echo ">>> Test 2/18: FND Slave"
 ./run_fnd_slave.sh > /tmp/fnd_test.log 2>&1
 if [ $? -eq 0 ]; then
     echo "✓ FND Slave test passed"
@@ -38,7 +38,7 @@ fi
 echo ""
 
 # Test 3: Switch Slave
-echo ">>> Test 3/4: Switch Slave"
+echo ">>> Test 3/18: Switch Slave"
 ./run_switch_slave.sh > /tmp/switch_test.log 2>&1
 if [ $? -eq 0 ]; then
     echo "✓ Switch Slave test passed"
@@ -50,7 +50,7 @@ fi
 echo ""
 
 # Test 4: System Integration
-echo ">>> Test 4/4: System Integration"
+echo ">>> Test 4/18: System Integration"
 ./run_system.sh > /tmp/system_test.log 2>&1
 if [ $? -eq 0 ]; then
     echo "✓ System Integration test passed"
@@ -61,12 +61,180 @@ else
 fi
 echo ""
 
+# Test 5: Slave Bus-Speed Sweep
+echo ">>> Test 5/18: Slave Speed Sweep"
+./run_speed_sweep.sh > /tmp/speed_sweep_test.log 2>&1
+if [ $? -eq 0 ]; then
+    echo "✓ Slave Speed Sweep test passed"
+    ((PASS_COUNT++))
+else
+    echo "✗ Slave Speed Sweep test failed (see /tmp/speed_sweep_test.log)"
+    ((FAIL_COUNT++))
+fi
+echo ""
+
+# Test 6: General Call
+echo ">>> Test 6/18: General Call"
+./run_general_call.sh > /tmp/general_call_test.log 2>&1
+if [ $? -eq 0 ]; then
+    echo "✓ General Call test passed"
+    ((PASS_COUNT++))
+else
+    echo "✗ General Call test failed (see /tmp/general_call_test.log)"
+    ((FAIL_COUNT++))
+fi
+echo ""
+
+# Test 7: EEPROM Slave
+echo ">>> Test 7/18: EEPROM Slave"
+./run_eeprom_slave.sh > /tmp/eeprom_test.log 2>&1
+if [ $? -eq 0 ]; then
+    echo "✓ EEPROM Slave test passed"
+    ((PASS_COUNT++))
+else
+    echo "✗ EEPROM Slave test failed (see /tmp/eeprom_test.log)"
+    ((FAIL_COUNT++))
+fi
+echo ""
+
+# Test 8: SPI Register-Map Transport
+echo ">>> Test 8/18: SPI Register-Map Transport"
+./run_spi_regmap.sh > /tmp/spi_regmap_test.log 2>&1
+if [ $? -eq 0 ]; then
+    echo "✓ SPI Register-Map test passed"
+    ((PASS_COUNT++))
+else
+    echo "✗ SPI Register-Map test failed (see /tmp/spi_regmap_test.log)"
+    ((FAIL_COUNT++))
+fi
+echo ""
+
+# Test 9: SMBus PEC
+echo ">>> Test 9/18: SMBus PEC"
+./run_pec.sh > /tmp/pec_test.log 2>&1
+if [ $? -eq 0 ]; then
+    echo "✓ SMBus PEC test passed"
+    ((PASS_COUNT++))
+else
+    echo "✗ SMBus PEC test failed (see /tmp/pec_test.log)"
+    ((FAIL_COUNT++))
+fi
+echo ""
+
+# Test 10: Master SDA Filter
+echo ">>> Test 10/18: Master SDA Filter"
+./run_sda_filter.sh > /tmp/sda_filter_test.log 2>&1
+if [ $? -eq 0 ]; then
+    echo "✓ Master SDA Filter test passed"
+    ((PASS_COUNT++))
+else
+    echo "✗ Master SDA Filter test failed (see /tmp/sda_filter_test.log)"
+    ((FAIL_COUNT++))
+fi
+echo ""
+
+# Test 11: Link Tester
+echo ">>> Test 11/18: Link Tester (PRBS Loopback)"
+./run_link_test.sh > /tmp/link_test.log 2>&1
+if [ $? -eq 0 ]; then
+    echo "✓ Link Tester test passed"
+    ((PASS_COUNT++))
+else
+    echo "✗ Link Tester test failed (see /tmp/link_test.log)"
+    ((FAIL_COUNT++))
+fi
+echo ""
+
+# Test 12: Per-Address Speed Table
+echo ">>> Test 12/18: Per-Address Speed Table (AXI)"
+./run_speed_table.sh > /tmp/speed_table_test.log 2>&1
+if [ $? -eq 0 ]; then
+    echo "✓ Speed Table test passed"
+    ((PASS_COUNT++))
+else
+    echo "✗ Speed Table test failed (see /tmp/speed_table_test.log)"
+    ((FAIL_COUNT++))
+fi
+echo ""
+
+# Test 13: Address-Only Probe / Bus Scan
+echo ">>> Test 13/18: Address-Only Probe / Bus Scan (AXI)"
+./run_bus_scan.sh > /tmp/bus_scan_test.log 2>&1
+if [ $? -eq 0 ]; then
+    echo "✓ Bus Scan test passed"
+    ((PASS_COUNT++))
+else
+    echo "✗ Bus Scan test failed (see /tmp/bus_scan_test.log)"
+    ((FAIL_COUNT++))
+fi
+echo ""
+
+# Test 14: Register Window
+echo ">>> Test 14/18: Register Window (AXI S01)"
+./run_reg_window.sh > /tmp/reg_window_test.log 2>&1
+if [ $? -eq 0 ]; then
+    echo "✓ Register Window test passed"
+    ((PASS_COUNT++))
+else
+    echo "✗ Register Window test failed (see /tmp/reg_window_test.log)"
+    ((FAIL_COUNT++))
+fi
+echo ""
+
+# Test 15: Command Ports / Arbiter
+echo ">>> Test 15/18: Command Ports / Arbiter (AXI)"
+./run_arbiter.sh > /tmp/arbiter_test.log 2>&1
+if [ $? -eq 0 ]; then
+    echo "✓ Arbiter test passed"
+    ((PASS_COUNT++))
+else
+    echo "✗ Arbiter test failed (see /tmp/arbiter_test.log)"
+    ((FAIL_COUNT++))
+fi
+echo ""
+
+# Test 16: Core / AXI Clock Crossing
+echo ">>> Test 16/18: Core / AXI Clock Crossing (AXI)"
+./run_axi_cdc.sh > /tmp/axi_cdc_test.log 2>&1
+if [ $? -eq 0 ]; then
+    echo "✓ Clock crossing test passed"
+    ((PASS_COUNT++))
+else
+    echo "✗ Clock crossing test failed (see /tmp/axi_cdc_test.log)"
+    ((FAIL_COUNT++))
+fi
+echo ""
+
+# Test 17: CONTROL Hold / Repeated START
+echo ">>> Test 17/18: CONTROL Hold / Repeated START (AXI)"
+./run_transfer.sh > /tmp/transfer_test.log 2>&1
+if [ $? -eq 0 ]; then
+    echo "✓ Repeated START test passed"
+    ((PASS_COUNT++))
+else
+    echo "✗ Repeated START test failed (see /tmp/transfer_test.log)"
+    ((FAIL_COUNT++))
+fi
+echo ""
+
+# Test 18: Firmware Driver on the Host Model
+echo ">>> Test 18/18: Firmware Driver Host Tests (gcc)"
+./run_firmware_host.sh > /tmp/firmware_host_test.log 2>&1
+if [ $? -eq 0 ]; then
+    echo "✓ Firmware host tests passed"
+    ((PASS_COUNT++))
+else
+    echo "✗ Firmware host tests failed (see /tmp/firmware_host_test.log)"
+    ((FAIL_COUNT++))
+fi
+echo ""
+
 # Summary
 echo "========================================="
 echo "Test Summary"
 echo "========================================="
-echo "Passed: $PASS_COUNT/4"
-echo "Failed: $FAIL_COUNT/4"
+echo "Passed: $PASS_COUNT/18"
+echo "Failed: $FAIL_COUNT/18"
 echo "========================================="
 
 if [ $FAIL_COUNT -eq 0 ]; then
@@ -18,9 +18,11 @@ rm -f i2c_board2board_tb i2c_board2board_tb.vcd
 echo "Compiling RTL and testbench..."
 iverilog -g2012 -o i2c_board2board_tb \
     ../rtl/master/i2c_master.sv \
+    ../rtl/slaves/i2c_slave_frontend.sv \
     ../rtl/slaves/i2c_led_slave.sv \
     ../rtl/slaves/i2c_fnd_slave.sv \
     ../rtl/slaves/i2c_switch_slave.sv \
+    ../rtl/slaves/i2c_eeprom_slave.sv \
     ../rtl/integration/i2c_master_board.sv \
     ../rtl/integration/i2c_slave_board.sv \
     ../tb/i2c_board2board_tb.sv
@@ -13,9 +13,11 @@ create_project -force board2board_sim ./vivado_sim -part xc7a35tcpg236-1
 # Add RTL files
 add_files -norecurse {
     ../rtl/master/i2c_master.sv
+    ../rtl/slaves/i2c_slave_frontend.sv
     ../rtl/slaves/i2c_led_slave.sv
     ../rtl/slaves/i2c_fnd_slave.sv
     ../rtl/slaves/i2c_switch_slave.sv
+    ../rtl/slaves/i2c_eeprom_slave.sv
     ../rtl/integration/i2c_master_board.sv
     ../rtl/integration/i2c_slave_board.sv
 }
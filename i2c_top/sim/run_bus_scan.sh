@@ -0,0 +1,55 @@
+#!/bin/bash
+
+#==============================================================================
+# Simulation script for I2C Address-Only Probe / Bus Scan
+#==============================================================================
+
+echo "========================================="
+echo "I2C Address-Only Probe / Bus Scan Simulation"
+echo "========================================="
+
+# Clean previous builds
+rm -f i2c_bus_scan_tb i2c_bus_scan_tb.vcd
+
+# Compile with Icarus Verilog
+echo "Compiling..."
+iverilog -g2012 -o i2c_bus_scan_tb \
+    ../rtl/master/i2c_master.sv \
+    ../rtl/master/spi_master.sv \
+    ../rtl/master/i2c_link_tester.sv \
+    ../rtl/master/i2c_bus_scanner.sv \
+    ../rtl/master/i2c_reg_window.sv \
+    ../rtl/master/i2c_arbiter.sv \
+    ../rtl/master/i2c_cmd_ports.sv \
+    ../rtl/axi/axi_lite_cdc.v \
+    ../rtl/axi/i2c_master_v1_0_S00_AXI.v \
+    ../rtl/axi/i2c_master_v1_0_S01_AXI.v \
+    ../rtl/axi/i2c_master_v1_0.v \
+    ../rtl/slaves/i2c_slave_frontend.sv \
+    ../rtl/slaves/i2c_eeprom_slave.sv \
+    ../rtl/slaves/i2c_led_slave.sv \
+    ../rtl/slaves/i2c_fnd_slave.sv \
+    ../rtl/slaves/i2c_switch_slave.sv \
+    ../tb/i2c_bus_scan_tb.sv
+
+if [ $? -ne 0 ]; then
+    echo "✗ Compilation failed!"
+    exit 1
+fi
+
+# Run simulation
+echo "Running simulation..."
+vvp i2c_bus_scan_tb
+
+if [ $? -eq 0 ]; then
+    echo ""
+    echo "========================================="
+    echo "✓ Simulation completed"
+    echo "========================================="
+    echo ""
+    echo "To view waveform:"
+    echo "  gtkwave i2c_bus_scan_tb.vcd"
+else
+    echo "✗ Simulation failed!"
+    exit 1
+fi
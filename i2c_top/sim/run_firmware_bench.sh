@@ -0,0 +1,43 @@
+#!/bin/bash
+
+#==============================================================================
+# Driver microbenchmarks on the host model (JSON Lines on stdout)
+# Usage: ./run_firmware_bench.sh [scl_hz] > bench.jsonl
+#==============================================================================
+
+# Clean previous builds
+rm -f firmware_bench firmware_bench_hpp
+
+# Compile with the host compiler, register accesses go to the model
+gcc -std=c99 -Wall -Wextra -O2 -DI2C_HOST_MOCK \
+    -I../firmware -I../firmware/host \
+    -o firmware_bench \
+    ../firmware/i2c_driver.c \
+    ../firmware/timebase.c \
+    ../firmware/bench_driver.c \
+    ../firmware/host/i2c_mock.c \
+    ../firmware/host/bench_main.c >&2
+
+if [ $? -ne 0 ]; then
+    echo "✗ Compilation failed!" >&2
+    exit 1
+fi
+
+# Same operations through the header-only C++ driver
+gcc -std=c99 -Wall -Wextra -O2 -DI2C_HOST_MOCK \
+    -I../firmware -I../firmware/host \
+    -c -o firmware_bench_mock.o ../firmware/host/i2c_mock.c >&2 &&
+g++ -std=c++17 -Wall -Wextra -O2 -DI2C_HOST_MOCK \
+    -I../firmware -I../firmware/host \
+    -o firmware_bench_hpp \
+    ../firmware/host/bench_hpp.cpp firmware_bench_mock.o >&2
+status=$?
+rm -f firmware_bench_mock.o
+
+if [ $status -ne 0 ]; then
+    echo "✗ Compilation failed!" >&2
+    exit 1
+fi
+
+./firmware_bench "${1:-100000}"
+./firmware_bench_hpp "${1:-100000}"
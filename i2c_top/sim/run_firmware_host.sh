@@ -0,0 +1,43 @@
+#!/bin/bash
+
+#==============================================================================
+# Host build of the firmware driver against the simulated IP (i2c_mock.c)
+#==============================================================================
+
+echo "========================================="
+echo "I2C Firmware Driver Host Tests"
+echo "========================================="
+
+# Clean previous builds
+rm -f firmware_host_test firmware_sched_test
+
+CFLAGS="-std=c99 -Wall -Wextra -O2 -DI2C_HOST_MOCK -I../firmware -I../firmware/host"
+DRIVER="../firmware/i2c_driver.c ../firmware/timebase.c ../firmware/host/i2c_mock.c"
+
+# Compile with the host compiler, register accesses go to the model
+echo "Compiling..."
+gcc $CFLAGS -o firmware_host_test $DRIVER \
+    ../firmware/host/test_driver.c && \
+gcc $CFLAGS -o firmware_sched_test $DRIVER \
+    ../firmware/sched.c \
+    ../firmware/demo_tasks.c \
+    ../firmware/host/test_sched.c
+
+if [ $? -ne 0 ]; then
+    echo "✗ Compilation failed!"
+    exit 1
+fi
+
+# Run tests
+echo "Running tests..."
+./firmware_host_test && ./firmware_sched_test
+
+if [ $? -eq 0 ]; then
+    echo ""
+    echo "========================================="
+    echo "✓ Host tests passed"
+    echo "========================================="
+else
+    echo "✗ Host tests failed!"
+    exit 1
+fi
@@ -14,6 +14,7 @@ rm -f i2c_fnd_slave_tb i2c_fnd_slave_tb.vcd
 # Compile with Icarus Verilog
 echo "Compiling..."
 iverilog -g2012 -o i2c_fnd_slave_tb \
+    ../rtl/slaves/i2c_slave_frontend.sv \
     ../rtl/slaves/i2c_fnd_slave.sv \
     ../tb/i2c_fnd_slave_tb.sv
 
@@ -0,0 +1,45 @@
+#!/bin/bash
+
+#==============================================================================
+# Simulation script for I2C General Call
+#==============================================================================
+
+echo "========================================="
+echo "I2C General Call Simulation"
+echo "Broadcast write + synchronized latch (0x00)"
+echo "========================================="
+
+# Clean previous builds
+rm -f i2c_general_call_tb i2c_general_call_tb.vcd
+
+# Compile with Icarus Verilog
+echo "Compiling..."
+iverilog -g2012 -o i2c_general_call_tb \
+    ../rtl/master/i2c_master.sv \
+    ../rtl/slaves/i2c_slave_frontend.sv \
+    ../rtl/slaves/i2c_led_slave.sv \
+    ../rtl/slaves/i2c_fnd_slave.sv \
+    ../rtl/slaves/i2c_switch_slave.sv \
+    ../tb/i2c_general_call_tb.sv
+
+if [ $? -ne 0 ]; then
+    echo "✗ Compilation failed!"
+    exit 1
+fi
+
+# Run simulation
+echo "Running simulation..."
+vvp i2c_general_call_tb
+
+if [ $? -eq 0 ]; then
+    echo ""
+    echo "========================================="
+    echo "✓ Simulation completed"
+    echo "========================================="
+    echo ""
+    echo "To view waveform:"
+    echo "  gtkwave i2c_general_call_tb.vcd"
+else
+    echo "✗ Simulation failed!"
+    exit 1
+fi
@@ -0,0 +1,43 @@
+#!/bin/bash
+
+#==============================================================================
+# Simulation script for I2C Link Tester (PRBS Loopback)
+#==============================================================================
+
+echo "========================================="
+echo "I2C Link Tester (PRBS Loopback) Simulation"
+echo "========================================="
+
+# Clean previous builds
+rm -f i2c_link_test_tb i2c_link_test_tb.vcd
+
+# Compile with Icarus Verilog
+echo "Compiling..."
+iverilog -g2012 -o i2c_link_test_tb \
+    ../rtl/master/i2c_master.sv \
+    ../rtl/master/i2c_link_tester.sv \
+    ../rtl/slaves/i2c_slave_frontend.sv \
+    ../rtl/slaves/i2c_eeprom_slave.sv \
+    ../tb/i2c_link_test_tb.sv
+
+if [ $? -ne 0 ]; then
+    echo "✗ Compilation failed!"
+    exit 1
+fi
+
+# Run simulation
+echo "Running simulation..."
+vvp i2c_link_test_tb
+
+if [ $? -eq 0 ]; then
+    echo ""
+    echo "========================================="
+    echo "✓ Simulation completed"
+    echo "========================================="
+    echo ""
+    echo "To view waveform:"
+    echo "  gtkwave i2c_link_test_tb.vcd"
+else
+    echo "✗ Simulation failed!"
+    exit 1
+fi
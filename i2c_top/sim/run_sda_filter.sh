@@ -0,0 +1,43 @@
+#!/bin/bash
+
+#==============================================================================
+# Simulation script for I2C Master SDA Filter
+#==============================================================================
+
+echo "========================================="
+echo "I2C Master SDA Filter Simulation"
+echo "========================================="
+
+# Clean previous builds
+rm -f i2c_sda_filter_tb i2c_sda_filter_tb.vcd
+
+# Compile with Icarus Verilog
+echo "Compiling..."
+iverilog -g2012 -o i2c_sda_filter_tb \
+    ../rtl/master/i2c_master.sv \
+    ../../slave_register_mapped/i2c_slave_protocol.sv \
+    ../../slave_register_mapped/slave_register_map.sv \
+    ../../slave_register_mapped/i2c_slave_top.sv \
+    ../tb/i2c_sda_filter_tb.sv
+
+if [ $? -ne 0 ]; then
+    echo "✗ Compilation failed!"
+    exit 1
+fi
+
+# Run simulation
+echo "Running simulation..."
+vvp i2c_sda_filter_tb
+
+if [ $? -eq 0 ]; then
+    echo ""
+    echo "========================================="
+    echo "✓ Simulation completed"
+    echo "========================================="
+    echo ""
+    echo "To view waveform:"
+    echo "  gtkwave i2c_sda_filter_tb.vcd"
+else
+    echo "✗ Simulation failed!"
+    exit 1
+fi
@@ -0,0 +1,44 @@
+#!/bin/bash
+
+#==============================================================================
+# Simulation script for I2C Slave Speed Sweep
+#==============================================================================
+
+echo "========================================="
+echo "I2C Slave Speed Sweep Simulation"
+echo "100 kHz -> 1 MHz (Fm+) -> 3.4 MHz (Hs)"
+echo "========================================="
+
+# Clean previous builds
+rm -f i2c_slave_speed_sweep_tb i2c_slave_speed_sweep_tb.vcd
+
+# Compile with Icarus Verilog
+echo "Compiling..."
+iverilog -g2012 -o i2c_slave_speed_sweep_tb \
+    ../rtl/slaves/i2c_slave_frontend.sv \
+    ../rtl/slaves/i2c_led_slave.sv \
+    ../rtl/slaves/i2c_fnd_slave.sv \
+    ../rtl/slaves/i2c_switch_slave.sv \
+    ../tb/i2c_slave_speed_sweep_tb.sv
+
+if [ $? -ne 0 ]; then
+    echo "✗ Compilation failed!"
+    exit 1
+fi
+
+# Run simulation
+echo "Running simulation..."
+vvp i2c_slave_speed_sweep_tb
+
+if [ $? -eq 0 ]; then
+    echo ""
+    echo "========================================="
+    echo "✓ Simulation completed"
+    echo "========================================="
+    echo ""
+    echo "To view waveform:"
+    echo "  gtkwave i2c_slave_speed_sweep_tb.vcd"
+else
+    echo "✗ Simulation failed!"
+    exit 1
+fi
@@ -0,0 +1,43 @@
+#!/bin/bash
+
+#==============================================================================
+# Simulation script for SPI transport (spi_master -> slave_register_map)
+#==============================================================================
+
+echo "========================================="
+echo "SPI Register-Map Transport Simulation"
+echo "========================================="
+
+# Clean previous builds
+rm -f spi_regmap_tb spi_regmap_tb.vcd
+
+# Compile with Icarus Verilog
+echo "Compiling..."
+iverilog -g2012 -o spi_regmap_tb \
+    ../rtl/master/spi_master.sv \
+    ../../slave_register_mapped/spi_slave_protocol.sv \
+    ../../slave_register_mapped/slave_register_map.sv \
+    ../../slave_register_mapped/spi_slave_top.sv \
+    ../tb/spi_regmap_tb.sv
+
+if [ $? -ne 0 ]; then
+    echo "✗ Compilation failed!"
+    exit 1
+fi
+
+# Run simulation
+echo "Running simulation..."
+vvp spi_regmap_tb
+
+if [ $? -eq 0 ]; then
+    echo ""
+    echo "========================================="
+    echo "✓ Simulation completed"
+    echo "========================================="
+    echo ""
+    echo "To view waveform:"
+    echo "  gtkwave spi_regmap_tb.vcd"
+else
+    echo "✗ Simulation failed!"
+    exit 1
+fi
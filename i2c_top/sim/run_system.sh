@@ -16,9 +16,11 @@ rm -f i2c_system_tb i2c_system_tb.vcd
 echo "Compiling..."
 iverilog -g2012 -o i2c_system_tb \
     ../rtl/master/i2c_master.sv \
+    ../rtl/slaves/i2c_slave_frontend.sv \
     ../rtl/slaves/i2c_led_slave.sv \
     ../rtl/slaves/i2c_fnd_slave.sv \
     ../rtl/slaves/i2c_switch_slave.sv \
+    ../rtl/slaves/i2c_eeprom_slave.sv \
     ../rtl/integration/i2c_system_top.sv \
     ../tb/i2c_system_tb.sv
 
@@ -0,0 +1,390 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// I2C Command Port / Arbiter Testbench
+//==============================================================================
+// AXI4-Lite -> i2c_master_v1_0 -> EEPROM (0x50), LED (0x55), Switch (0x57)
+// Checks:
+//   - Port write / read: status done, received byte, LED output
+//   - Two-byte port write (EEPROM pointer + data), read back on another port
+//   - Absent slave on a port: ack_error, 0xFF, CONTROL status untouched
+//   - Priority: with the bus busy, a priority 3 switch read is granted before
+//     a priority 0 LED write queued earlier
+//   - Equal priority: ports are granted in round-robin order
+//   - Overrun: a second command on a pending port is dropped and flagged
+//   - CONTROL busy stays low during port traffic, STATUS[7] shows it
+//==============================================================================
+
+module i2c_arbiter_tb;
+
+    //==========================================================================
+    // Parameters
+    //==========================================================================
+    localparam CLK_PERIOD = 10;         // 100 MHz
+
+    localparam [6:0] ADDR_EE     = 7'h50;
+    localparam [6:0] ADDR_ABSENT = 7'h51;
+    localparam [6:0] ADDR_LED    = 7'h55;
+    localparam [6:0] ADDR_SW     = 7'h57;
+
+    // AXI register offsets (i2c_regs.h)
+    localparam [6:0] REG_CONTROL  = 7'h00;
+    localparam [6:0] REG_STATUS   = 7'h04;
+    localparam [6:0] REG_PORT0    = 7'h48;
+    localparam [6:0] REG_ARB_PRIO = 7'h58;
+
+    // Arbiter requester index (grant bit)
+    localparam int REQ_PORT0   = 2;
+
+    //==========================================================================
+    // Signals
+    //==========================================================================
+    logic        clk;
+    logic        rst_n;
+    tri1         scl;
+    tri1         sda;
+
+    // AXI4-Lite
+    logic [6:0]  awaddr;
+    logic        awvalid;
+    wire         awready;
+    logic [31:0] wdata;
+    logic [3:0]  wstrb;
+    logic        wvalid;
+    wire         wready;
+    wire  [1:0]  bresp;
+    wire         bvalid;
+    logic        bready;
+    logic [6:0]  araddr;
+    logic        arvalid;
+    wire         arready;
+    wire  [31:0] rdata;
+    wire  [1:0]  rresp;
+    wire         rvalid;
+    logic        rready;
+
+    // Slave I/O
+    logic [7:0]  SW;
+    logic [7:0]  LED;
+
+    // Grant order (requester index per new grant)
+    int          grants[$];
+    logic [5:0]  last_grant;
+
+    int          test_pass;
+    int          test_fail;
+
+    always @(posedge clk) begin
+        if (dut.arb_grant != 6'd0 && dut.arb_grant != last_grant) begin
+            for (int i = 0; i < 6; i++) begin
+                if (dut.arb_grant[i]) grants.push_back(i);
+            end
+        end
+        last_grant <= dut.arb_grant;
+    end
+
+    //==========================================================================
+    // DUTs
+    //==========================================================================
+    i2c_master_v1_0 dut (
+        .sda(sda),
+        .scl(scl),
+        .spi_sck(),
+        .spi_mosi(),
+        .spi_miso(1'b0),
+        .spi_cs_n(),
+        .i2c_clk(clk),
+        .i2c_aresetn(rst_n),
+        .s00_axi_aclk(clk),
+        .s00_axi_aresetn(rst_n),
+        .s00_axi_awaddr(awaddr),
+        .s00_axi_awprot(3'b000),
+        .s00_axi_awvalid(awvalid),
+        .s00_axi_awready(awready),
+        .s00_axi_wdata(wdata),
+        .s00_axi_wstrb(wstrb),
+        .s00_axi_wvalid(wvalid),
+        .s00_axi_wready(wready),
+        .s00_axi_bresp(bresp),
+        .s00_axi_bvalid(bvalid),
+        .s00_axi_bready(bready),
+        .s00_axi_araddr(araddr),
+        .s00_axi_arprot(3'b000),
+        .s00_axi_arvalid(arvalid),
+        .s00_axi_arready(arready),
+        .s00_axi_rdata(rdata),
+        .s00_axi_rresp(rresp),
+        .s00_axi_rvalid(rvalid),
+        .s00_axi_rready(rready),
+        .s01_axi_aclk(clk),
+        .s01_axi_aresetn(rst_n),
+        .s01_axi_awaddr(17'd0),
+        .s01_axi_awprot(3'b000),
+        .s01_axi_awvalid(1'b0),
+        .s01_axi_awready(),
+        .s01_axi_wdata(32'd0),
+        .s01_axi_wstrb(4'h0),
+        .s01_axi_wvalid(1'b0),
+        .s01_axi_wready(),
+        .s01_axi_bresp(),
+        .s01_axi_bvalid(),
+        .s01_axi_bready(1'b0),
+        .s01_axi_araddr(17'd0),
+        .s01_axi_arprot(3'b000),
+        .s01_axi_arvalid(1'b0),
+        .s01_axi_arready(),
+        .s01_axi_rdata(),
+        .s01_axi_rresp(),
+        .s01_axi_rvalid(),
+        .s01_axi_rready(1'b0)
+    );
+
+    i2c_eeprom_slave #(
+        .SLAVE_ADDR(ADDR_EE)
+    ) eeprom (
+        .clk(clk), .rst_n(rst_n), .scl(scl), .sda(sda),
+        .write_busy(), .debug_addr_match(), .debug_state()
+    );
+
+    i2c_led_slave led_slave (
+        .clk(clk), .rst_n(rst_n), .scl(scl), .sda(sda),
+        .LED(LED), .debug_addr_match(), .debug_state()
+    );
+
+    i2c_switch_slave switch_slave (
+        .clk(clk), .rst_n(rst_n), .scl(scl), .sda(sda),
+        .SW(SW), .debug_addr_match(), .debug_state()
+    );
+
+    //==========================================================================
+    // Clock
+    //==========================================================================
+    initial begin
+        clk = 0;
+        forever #(CLK_PERIOD/2) clk = ~clk;
+    end
+
+    //==========================================================================
+    // AXI4-Lite Tasks
+    //==========================================================================
+    task automatic axi_write(input [6:0] addr, input [31:0] data, input [3:0] strb = 4'hF);
+        @(posedge clk);
+        awaddr  <= addr;
+        awvalid <= 1;
+        wdata   <= data;
+        wstrb   <= strb;
+        wvalid  <= 1;
+        bready  <= 1;
+        @(posedge clk iff (awready && wready));
+        awvalid <= 0;
+        wvalid  <= 0;
+        @(posedge clk iff bvalid);
+        bready  <= 0;
+    endtask
+
+    task automatic axi_read(input [6:0] addr, output [31:0] data);
+        @(posedge clk);
+        araddr  <= addr;
+        arvalid <= 1;
+        rready  <= 1;
+        @(posedge clk iff arready);
+        arvalid <= 0;
+        @(posedge clk iff rvalid);
+        data    = rdata;
+        rready  <= 0;
+    endtask
+
+    //==========================================================================
+    // Command Port Tasks
+    //==========================================================================
+    function automatic [31:0] port_cmd(input [6:0] addr, input bit rw, input [1:0] count,
+                                       input [7:0] d0, input [7:0] d1);
+        return {d1, d0, 6'h0, count, addr, rw};
+    endfunction
+
+    task automatic port_issue(input int port, input [31:0] cmd);
+        axi_write(REG_PORT0 + 4 * port, cmd);
+    endtask
+
+    // Poll the port status until pending clears
+    task automatic port_wait(input int port, output logic [31:0] st);
+        repeat(5) @(posedge clk);
+        do axi_read(REG_PORT0 + 4 * port, st); while (st[31]);
+    endtask
+
+    // Poll STATUS.busy and STATUS.bus_busy
+    task automatic wait_bus_idle(output logic [31:0] st);
+        repeat(5) @(posedge clk);
+        do axi_read(REG_STATUS, st); while (st[0] || st[7]);
+    endtask
+
+    task automatic check(input bit cond, input string msg);
+        if (cond) begin
+            $display("  ✓ %s", msg);
+            test_pass++;
+        end else begin
+            $display("  ✗ %s", msg);
+            test_fail++;
+        end
+    endtask
+
+    //==========================================================================
+    // Test Sequence
+    //==========================================================================
+    initial begin
+        logic [31:0] st, ps;
+        bit          saw_busy;
+
+        $display("========================================");
+        $display("I2C Command Port / Arbiter Test");
+        $display("========================================");
+
+        test_pass  = 0;
+        test_fail  = 0;
+        rst_n      = 0;
+        awaddr     = 0;
+        awvalid    = 0;
+        wdata      = 0;
+        wstrb      = 0;
+        wvalid     = 0;
+        bready     = 0;
+        araddr     = 0;
+        arvalid    = 0;
+        rready     = 0;
+        last_grant = 0;
+        SW         = 8'h5A;
+
+        repeat(20) @(posedge clk);
+        rst_n = 1;
+        repeat(20) @(posedge clk);
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 1: Port write / read ===", $time);
+        port_issue(0, port_cmd(ADDR_LED, 1'b0, 2'd1, 8'hA5, 8'h00));
+        port_wait(0, ps);
+        check(ps[9] && !ps[8] && LED == 8'hA5,
+              $sformatf("Port 0 LED write: status 0x%08h, LED 0x%02h", ps, LED));
+
+        port_issue(1, port_cmd(ADDR_SW, 1'b1, 2'd1, 8'h00, 8'h00));
+        port_wait(1, ps);
+        check(ps[9] && !ps[8] && ps[7:0] == 8'h5A,
+              $sformatf("Port 1 switch read: 0x%02h", ps[7:0]));
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 2: Two-byte write, read on another port ===", $time);
+        port_issue(2, port_cmd(ADDR_EE, 1'b0, 2'd2, 8'h30, 8'h99));
+        port_wait(2, ps);
+        check(ps[9] && !ps[8], "Port 2 EEPROM [0x30] = 0x99");
+        repeat(100) @(posedge clk);
+        port_issue(3, port_cmd(ADDR_EE, 1'b0, 2'd1, 8'h30, 8'h00));
+        port_wait(3, ps);
+        port_issue(3, port_cmd(ADDR_EE, 1'b1, 2'd1, 8'h00, 8'h00));
+        port_wait(3, ps);
+        check(ps[9] && !ps[8] && ps[7:0] == 8'h99,
+              $sformatf("Port 3 read back 0x%02h", ps[7:0]));
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 3: Absent slave ===", $time);
+        port_issue(1, port_cmd(ADDR_ABSENT, 1'b1, 2'd1, 8'h00, 8'h00));
+        port_wait(1, ps);
+        check(ps[9] && ps[8] && ps[7:0] == 8'hFF,
+              $sformatf("Port 1 NACK, data 0x%02h", ps[7:0]));
+        axi_read(REG_STATUS, st);
+        check(!st[2], "CONTROL ack_error untouched");
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 4: Priority ===", $time);
+        // Port 0 = bulk LED (0), port 1 = switch read (3), others 1
+        axi_write(REG_ARB_PRIO, 32'h0000_05C5);
+        axi_read(REG_ARB_PRIO, st);
+        check(st == 32'h0000_05C5, $sformatf("ARB_PRIO = 0x%03h", st));
+
+        axi_write(REG_CONTROL, {16'h0001, 8'h3C, ADDR_LED, 1'b0});
+        port_issue(0, port_cmd(ADDR_LED, 1'b0, 2'd1, 8'h11, 8'h00));
+        port_issue(1, port_cmd(ADDR_SW, 1'b1, 2'd1, 8'h00, 8'h00));
+        grants.delete();
+        port_wait(0, ps);
+        check(ps[9] && LED == 8'h11, $sformatf("LED upload done (0x%02h)", LED));
+        port_wait(1, ps);
+        check(ps[9] && ps[7:0] == 8'h5A, "Switch read done");
+        check(grants.size() == 2 && grants[0] == REQ_PORT0 + 1 && grants[1] == REQ_PORT0,
+              $sformatf("Switch read granted before LED upload (%p)", grants));
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 5: Equal priority, round robin ===", $time);
+        axi_write(REG_ARB_PRIO, 32'h0000_0555);
+        axi_write(REG_CONTROL, {16'h0001, 8'h0F, ADDR_LED, 1'b0});
+        repeat(10) @(posedge clk);
+        grants.delete();
+        // CONTROL holds the bus while the ports queue up
+        port_issue(3, port_cmd(ADDR_SW, 1'b1, 2'd1, 8'h00, 8'h00));
+        port_issue(0, port_cmd(ADDR_LED, 1'b0, 2'd1, 8'h22, 8'h00));
+        port_issue(2, port_cmd(ADDR_SW, 1'b1, 2'd1, 8'h00, 8'h00));
+        wait_bus_idle(st);
+        // Last winner CONTROL -> scan from the window: port 0, 2, 3
+        check(grants.size() == 3 && grants[0] == REQ_PORT0 && grants[1] == REQ_PORT0 + 2 &&
+              grants[2] == REQ_PORT0 + 3, $sformatf("Grant order %p", grants));
+        check(LED == 8'h22, $sformatf("LED 0x%02h", LED));
+
+        axi_write(REG_CONTROL, {16'h0001, 8'h33, ADDR_LED, 1'b0});
+        wait_bus_idle(st);
+        check(!st[2] && LED == 8'h33, "CONTROL write after port traffic");
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 6: Overrun ===", $time);
+        port_issue(0, port_cmd(ADDR_LED, 1'b0, 2'd1, 8'h44, 8'h00));
+        port_issue(0, port_cmd(ADDR_LED, 1'b0, 2'd1, 8'h55, 8'h00));
+        port_wait(0, ps);
+        check(ps[10] && ps[9] && LED == 8'h44,
+              $sformatf("Second command dropped, overrun set (LED 0x%02h)", LED));
+        port_issue(0, port_cmd(ADDR_LED, 1'b0, 2'd1, 8'h55, 8'h00));
+        port_wait(0, ps);
+        check(!ps[10] && LED == 8'h55, "Next command clears overrun");
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 7: CONTROL status during port traffic ===", $time);
+        port_issue(1, port_cmd(ADDR_SW, 1'b1, 2'd1, 8'h00, 8'h00));
+        saw_busy = 1'b0;
+        do begin
+            axi_read(REG_STATUS, st);
+            if (st[0]) saw_busy = 1'b1;
+        end while (!st[7]);
+        check(!saw_busy, "STATUS[0] low, STATUS[7] high while port 1 runs");
+        port_wait(1, ps);
+        wait_bus_idle(st);
+        check(!st[7], "STATUS[7] clears");
+
+        //----------------------------------------------------------------------
+        $display("\n========================================");
+        $display("Test Summary:");
+        $display("  PASSED: %0d", test_pass);
+        $display("  FAILED: %0d", test_fail);
+        $display("========================================");
+
+        if (test_fail == 0) begin
+            $display("✓ ALL TESTS PASSED!");
+        end else begin
+            $display("✗ SOME TESTS FAILED!");
+        end
+
+        $finish;
+    end
+
+    //==========================================================================
+    // Waveform
+    //==========================================================================
+    initial begin
+        $dumpfile("i2c_arbiter_tb.vcd");
+        $dumpvars(0, i2c_arbiter_tb);
+    end
+
+    //==========================================================================
+    // Timeout
+    //==========================================================================
+    initial begin
+        #50000000;
+        $display("\n✗ ERROR: Simulation timeout!");
+        $finish;
+    end
+
+endmodule
@@ -0,0 +1,430 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// I2C Core / AXI Clock Crossing Testbench
+//==============================================================================
+// i2c_master_v1_0 with C_I2C_ASYNC_CLK = 1:
+//   S00_AXI at ~143 MHz (7 ns), S01_AXI at ~111 MHz (9 ns),
+//   I2C core at 50 MHz (I2C_CLK_FREQ = 50 MHz), slaves at 100 MHz
+//   -> i2c_eeprom_slave (0x50), i2c_led_slave (0x55), i2c_switch_slave (0x57)
+// Checks:
+//   - Register write / read back across the crossing, back-to-back
+//   - SCL period follows the core clock parameter (100 kHz at 50 MHz)
+//   - CONTROL write / read, TX FIFO pushes and RX FIFO pops are neither
+//     lost nor repeated
+//   - Register window load on its own clock, command port read
+//   - Tick counter runs on the core clock, done stamp precedes the poll
+//==============================================================================
+
+module i2c_axi_cdc_tb;
+
+    //==========================================================================
+    // Parameters
+    //==========================================================================
+    localparam ACLK_PERIOD = 7;         // S00 AXI
+    localparam WCLK_PERIOD = 9;         // S01 AXI
+    localparam CORE_PERIOD = 20;        // I2C core, 50 MHz
+    localparam CLK_PERIOD  = 10;        // Slaves, 100 MHz
+
+    localparam [6:0] ADDR_EE  = 7'h50;
+    localparam [6:0] ADDR_LED = 7'h55;
+    localparam [6:0] ADDR_SW  = 7'h57;
+
+    // AXI register offsets (i2c_regs.h)
+    localparam [6:0] REG_CONTROL = 7'h00;
+    localparam [6:0] REG_STATUS  = 7'h04;
+    localparam [6:0] REG_RX_DATA = 7'h08;
+    localparam [6:0] REG_TX_FIFO = 7'h0C;
+    localparam [6:0] REG_RX_FIFO = 7'h10;
+    localparam [6:0] REG_CONFIG  = 7'h14;
+    localparam [6:0] REG_SPEED   = 7'h30;
+    localparam [6:0] REG_PORT0   = 7'h48;
+    localparam [6:0] REG_TICKS   = 7'h5C;
+    localparam [6:0] REG_DONE_TK = 7'h60;
+
+    //==========================================================================
+    // Signals
+    //==========================================================================
+    logic        aclk;
+    logic        wclk;
+    logic        core_clk;
+    logic        clk;
+    logic        rst_n;
+    logic        core_rst_n;
+    tri1         scl;
+    tri1         sda;
+
+    // AXI4-Lite S00
+    logic [6:0]  awaddr;
+    logic        awvalid;
+    wire         awready;
+    logic [31:0] wdata;
+    logic [3:0]  wstrb;
+    logic        wvalid;
+    wire         wready;
+    wire  [1:0]  bresp;
+    wire         bvalid;
+    logic        bready;
+    logic [6:0]  araddr;
+    logic        arvalid;
+    wire         arready;
+    wire  [31:0] rdata;
+    wire  [1:0]  rresp;
+    wire         rvalid;
+    logic        rready;
+
+    // AXI4-Lite S01 (window)
+    logic [16:0] w_awaddr;
+    logic        w_awvalid;
+    wire         w_awready;
+    logic [31:0] w_wdata;
+    logic [3:0]  w_wstrb;
+    logic        w_wvalid;
+    wire         w_wready;
+    wire  [1:0]  w_bresp;
+    wire         w_bvalid;
+    logic        w_bready;
+    logic [16:0] w_araddr;
+    logic        w_arvalid;
+    wire         w_arready;
+    wire  [31:0] w_rdata;
+    wire  [1:0]  w_rresp;
+    wire         w_rvalid;
+    logic        w_rready;
+
+    // Slave I/O
+    logic [7:0]  SW;
+    logic [7:0]  LED;
+
+    // SCL period
+    time         scl_rise;
+    time         scl_period;
+
+    int          test_pass;
+    int          test_fail;
+
+    always @(posedge scl) begin
+        if (scl_rise != 0 && $time - scl_rise < scl_period) begin
+            scl_period = $time - scl_rise;
+        end
+        scl_rise = $time;
+    end
+
+    //==========================================================================
+    // DUTs
+    //==========================================================================
+    i2c_master_v1_0 #(
+        .I2C_SCL_FREQ(100_000),
+        .I2C_CLK_FREQ(50_000_000),
+        .C_I2C_ASYNC_CLK(1)
+    ) dut (
+        .sda(sda),
+        .scl(scl),
+        .spi_sck(),
+        .spi_mosi(),
+        .spi_miso(1'b0),
+        .spi_cs_n(),
+        .i2c_clk(core_clk),
+        .i2c_aresetn(core_rst_n),
+        .s00_axi_aclk(aclk),
+        .s00_axi_aresetn(rst_n),
+        .s00_axi_awaddr(awaddr),
+        .s00_axi_awprot(3'b000),
+        .s00_axi_awvalid(awvalid),
+        .s00_axi_awready(awready),
+        .s00_axi_wdata(wdata),
+        .s00_axi_wstrb(wstrb),
+        .s00_axi_wvalid(wvalid),
+        .s00_axi_wready(wready),
+        .s00_axi_bresp(bresp),
+        .s00_axi_bvalid(bvalid),
+        .s00_axi_bready(bready),
+        .s00_axi_araddr(araddr),
+        .s00_axi_arprot(3'b000),
+        .s00_axi_arvalid(arvalid),
+        .s00_axi_arready(arready),
+        .s00_axi_rdata(rdata),
+        .s00_axi_rresp(rresp),
+        .s00_axi_rvalid(rvalid),
+        .s00_axi_rready(rready),
+        .s01_axi_aclk(wclk),
+        .s01_axi_aresetn(rst_n),
+        .s01_axi_awaddr(w_awaddr),
+        .s01_axi_awprot(3'b000),
+        .s01_axi_awvalid(w_awvalid),
+        .s01_axi_awready(w_awready),
+        .s01_axi_wdata(w_wdata),
+        .s01_axi_wstrb(w_wstrb),
+        .s01_axi_wvalid(w_wvalid),
+        .s01_axi_wready(w_wready),
+        .s01_axi_bresp(w_bresp),
+        .s01_axi_bvalid(w_bvalid),
+        .s01_axi_bready(w_bready),
+        .s01_axi_araddr(w_araddr),
+        .s01_axi_arprot(3'b000),
+        .s01_axi_arvalid(w_arvalid),
+        .s01_axi_arready(w_arready),
+        .s01_axi_rdata(w_rdata),
+        .s01_axi_rresp(w_rresp),
+        .s01_axi_rvalid(w_rvalid),
+        .s01_axi_rready(w_rready)
+    );
+
+    i2c_eeprom_slave #(
+        .SLAVE_ADDR(ADDR_EE)
+    ) eeprom (
+        .clk(clk), .rst_n(rst_n), .scl(scl), .sda(sda),
+        .write_busy(), .debug_addr_match(), .debug_state()
+    );
+
+    i2c_led_slave led_slave (
+        .clk(clk), .rst_n(rst_n), .scl(scl), .sda(sda),
+        .LED(LED), .debug_addr_match(), .debug_state()
+    );
+
+    i2c_switch_slave switch_slave (
+        .clk(clk), .rst_n(rst_n), .scl(scl), .sda(sda),
+        .SW(SW), .debug_addr_match(), .debug_state()
+    );
+
+    //==========================================================================
+    // Clocks (unrelated periods and phases)
+    //==========================================================================
+    initial begin
+        aclk = 0;
+        forever #(ACLK_PERIOD/2.0) aclk = ~aclk;
+    end
+
+    initial begin
+        wclk = 0;
+        #3;
+        forever #(WCLK_PERIOD/2.0) wclk = ~wclk;
+    end
+
+    initial begin
+        core_clk = 0;
+        #1;
+        forever #(CORE_PERIOD/2) core_clk = ~core_clk;
+    end
+
+    initial begin
+        clk = 0;
+        forever #(CLK_PERIOD/2) clk = ~clk;
+    end
+
+    //==========================================================================
+    // AXI4-Lite Tasks (S00 on aclk)
+    //==========================================================================
+    task automatic axi_write(input [6:0] addr, input [31:0] data, input [3:0] strb = 4'hF);
+        @(posedge aclk);
+        awaddr  <= addr;
+        awvalid <= 1;
+        wdata   <= data;
+        wstrb   <= strb;
+        wvalid  <= 1;
+        bready  <= 1;
+        @(posedge aclk iff (awready && wready));
+        awvalid <= 0;
+        wvalid  <= 0;
+        @(posedge aclk iff bvalid);
+        bready  <= 0;
+    endtask
+
+    task automatic axi_read(input [6:0] addr, output [31:0] data);
+        @(posedge aclk);
+        araddr  <= addr;
+        arvalid <= 1;
+        rready  <= 1;
+        @(posedge aclk iff arready);
+        arvalid <= 0;
+        @(posedge aclk iff rvalid);
+        data    = rdata;
+        rready  <= 0;
+    endtask
+
+    // Window load (S01 on wclk)
+    task automatic win_load(input [6:0] slave, input [7:0] reg_addr,
+                            output [31:0] data, output [1:0] resp);
+        @(posedge wclk);
+        w_araddr  <= {slave, reg_addr, 2'b00};
+        w_arvalid <= 1;
+        w_rready  <= 1;
+        @(posedge wclk iff w_arready);
+        w_arvalid <= 0;
+        @(posedge wclk iff w_rvalid);
+        data      = w_rdata;
+        resp      = w_rresp;
+        w_rready  <= 0;
+    endtask
+
+    // Poll STATUS.busy and STATUS.bus_busy
+    task automatic wait_idle(output logic [31:0] st);
+        repeat(5) @(posedge aclk);
+        do axi_read(REG_STATUS, st); while (st[0] || st[7]);
+    endtask
+
+    task automatic check(input bit cond, input string msg);
+        if (cond) begin
+            $display("  ✓ %s", msg);
+            test_pass++;
+        end else begin
+            $display("  ✗ %s", msg);
+            test_fail++;
+        end
+    endtask
+
+    //==========================================================================
+    // Test Sequence
+    //==========================================================================
+    initial begin
+        logic [31:0] rd, st;
+        logic [1:0]  resp;
+        logic [7:0]  buf_rx [3];
+        logic [31:0] tk0, tk1;
+        time         t0;
+
+        $display("========================================");
+        $display("I2C Core / AXI Clock Crossing Test");
+        $display("========================================");
+
+        test_pass  = 0;
+        test_fail  = 0;
+        rst_n      = 0;
+        core_rst_n = 0;
+        awaddr     = 0;
+        awvalid    = 0;
+        wdata      = 0;
+        wstrb      = 0;
+        wvalid     = 0;
+        bready     = 0;
+        araddr     = 0;
+        arvalid    = 0;
+        rready     = 0;
+        w_awaddr   = 0;
+        w_awvalid  = 0;
+        w_wdata    = 0;
+        w_wstrb    = 0;
+        w_wvalid   = 0;
+        w_bready   = 0;
+        w_araddr   = 0;
+        w_arvalid  = 0;
+        w_rready   = 0;
+        SW         = 8'hC3;
+        scl_rise   = 0;
+        scl_period = '1;
+
+        #400;
+        rst_n      = 1;
+        core_rst_n = 1;
+        #400;
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 1: Register access across the crossing ===", $time);
+        axi_write(REG_CONFIG, 32'h0003_0500);
+        axi_write(REG_SPEED, {17'h0, ADDR_SW, 8'd125});            // 100 kHz at 50 MHz
+        axi_read(REG_CONFIG, rd);
+        check(rd == 32'h0003_0500, $sformatf("CONFIG = 0x%08h", rd));
+        axi_read(REG_SPEED, rd);
+        check(rd == {17'h0, ADDR_SW, 8'd125}, $sformatf("SPEED = 0x%08h", rd));
+        axi_write(REG_CONFIG, 32'h0000_0500);
+        t0 = $time;
+        axi_read(REG_CONFIG, rd);
+        check(rd == 32'h0000_0500, "Back-to-back write / read ordered");
+        $display("  Register read: %0t ns (%0d AXI clocks)", $time - t0,
+                 ($time - t0) / ACLK_PERIOD);
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 2: CONTROL write, SCL from the core clock ===", $time);
+        axi_write(REG_CONTROL, {16'h0001, 8'hA5, ADDR_LED, 1'b0});
+        wait_idle(st);
+        check(!st[2] && LED == 8'hA5, $sformatf("LED = 0x%02h", LED));
+        check(scl_period >= 9900 && scl_period <= 10100,
+              $sformatf("SCL period %0t ns at a 50 MHz core", scl_period));
+
+        axi_write(REG_CONTROL, {16'h0001, 8'h00, ADDR_SW, 1'b1});
+        wait_idle(st);
+        axi_read(REG_RX_DATA, rd);
+        check(!st[2] && rd[7:0] == 8'hC3, $sformatf("Switch read 0x%02h", rd[7:0]));
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 3: TX / RX FIFO across the crossing ===", $time);
+        axi_write(REG_TX_FIFO, 32'h11);
+        axi_write(REG_TX_FIFO, 32'h22);
+        axi_write(REG_TX_FIFO, 32'h33);
+        axi_read(REG_STATUS, st);
+        check(st[15:8] == 8'd3, $sformatf("TX level %0d", st[15:8]));
+        axi_write(REG_CONTROL, {16'h0004, 8'h40, ADDR_EE, 1'b0});   // [0x40] 11 22 33
+        wait_idle(st);
+        check(!st[2], "EEPROM page write ACKed");
+
+        axi_write(REG_CONTROL, {16'h0001, 8'h40, ADDR_EE, 1'b0});   // Pointer = 0x40
+        wait_idle(st);
+        axi_write(REG_CONTROL, {16'h0003, 8'h00, ADDR_EE, 1'b1});   // Read 3
+        wait_idle(st);
+        check(st[23:16] == 8'd3, $sformatf("RX level %0d", st[23:16]));
+        for (int i = 0; i < 3; i++) begin
+            axi_read(REG_RX_FIFO, rd);
+            buf_rx[i] = rd[7:0];
+        end
+        axi_read(REG_STATUS, st);
+        check(buf_rx[0] == 8'h11 && buf_rx[1] == 8'h22 && buf_rx[2] == 8'h33 && st[4],
+              $sformatf("RX FIFO %02h %02h %02h, then empty", buf_rx[0], buf_rx[1], buf_rx[2]));
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 4: Window and command port ===", $time);
+        win_load(ADDR_EE, 8'h41, rd, resp);
+        check(resp == 2'b00 && rd[7:0] == 8'h22, $sformatf("Window load 0x50[0x41] = 0x%02h", rd[7:0]));
+
+        axi_write(REG_PORT0, {24'h0, ADDR_SW, 1'b1});
+        do axi_read(REG_PORT0, rd); while (rd[31]);
+        check(rd[9] && !rd[8] && rd[7:0] == 8'hC3, $sformatf("Port 0 switch read 0x%02h", rd[7:0]));
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 5: Timebase ===", $time);
+        axi_read(REG_TICKS, tk0);
+        #10000;
+        axi_read(REG_TICKS, tk1);
+        check(tk1 - tk0 >= 500 && tk1 - tk0 <= 530,
+              $sformatf("%0d core clocks in 10 us", tk1 - tk0));
+
+        axi_write(REG_CONTROL, {16'h0001, 8'h5A, ADDR_LED, 1'b0});
+        wait_idle(st);
+        axi_read(REG_DONE_TK, tk0);
+        axi_read(REG_TICKS, tk1);
+        check(LED == 8'h5A && tk1 > tk0 && tk1 - tk0 < 200,
+              $sformatf("Done -> poll return: %0d core clocks", tk1 - tk0));
+
+        //----------------------------------------------------------------------
+        $display("\n========================================");
+        $display("Test Summary:");
+        $display("  PASSED: %0d", test_pass);
+        $display("  FAILED: %0d", test_fail);
+        $display("========================================");
+
+        if (test_fail == 0) begin
+            $display("✓ ALL TESTS PASSED!");
+        end else begin
+            $display("✗ SOME TESTS FAILED!");
+        end
+
+        $finish;
+    end
+
+    //==========================================================================
+    // Waveform
+    //==========================================================================
+    initial begin
+        $dumpfile("i2c_axi_cdc_tb.vcd");
+        $dumpvars(0, i2c_axi_cdc_tb);
+    end
+
+    //==========================================================================
+    // Timeout
+    //==========================================================================
+    initial begin
+        #20000000;
+        $display("\n✗ ERROR: Simulation timeout!");
+        $finish;
+    end
+
+endmodule
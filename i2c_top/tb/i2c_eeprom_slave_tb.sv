@@ -0,0 +1,343 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// I2C EEPROM Slave Testbench
+//==============================================================================
+// Bit-level master against two EEPROM slaves on one bus:
+//   0x50 : no write cycle (bulk-throughput target)
+//   0x51 : WRITE_CYCLE_US = 100 (ACK polling)
+// Checks:
+//   - Page write + random read (word address, Sr, sequential read)
+//   - Page rollover: bytes past the page end wrap to the page start
+//   - Current-address read continues after the last read byte
+//   - Sequential read wraps 0xFF -> 0x00
+//   - Write cycle: address NACKed until tWR ends, then ACKed
+// Reports sustained throughput for 256-byte reads at 100 kHz / 400 kHz / 1 MHz
+//==============================================================================
+
+module i2c_eeprom_slave_tb;
+
+    //==========================================================================
+    // Parameters
+    //==========================================================================
+    localparam CLK_PERIOD = 10;         // 100 MHz
+    localparam NUM_SPEEDS = 3;
+
+    localparam [6:0] ADDR_EE      = 7'h50;
+    localparam [6:0] ADDR_EE_SLOW = 7'h51;
+
+    // Quarter-bit length (clk cycles) and label per speed
+    int    quarter [NUM_SPEEDS] = '{250, 62, 25};
+    string label   [NUM_SPEEDS] = '{"100 kHz", "400 kHz", "1 MHz (Fm+)"};
+
+    //==========================================================================
+    // Signals
+    //==========================================================================
+    logic       clk;
+    logic       rst_n;
+    logic       scl;
+    tri1        sda;
+
+    logic       master_sda_oe;
+    logic       master_sda_out;
+    logic       slow_busy;
+
+    int         test_pass;
+    int         test_fail;
+
+    assign sda = master_sda_oe ? master_sda_out : 1'bz;
+
+    //==========================================================================
+    // DUTs (shared bus)
+    //==========================================================================
+    i2c_eeprom_slave #(
+        .SLAVE_ADDR(ADDR_EE)
+    ) eeprom (
+        .clk(clk), .rst_n(rst_n), .scl(scl), .sda(sda),
+        .write_busy(), .debug_addr_match(), .debug_state()
+    );
+
+    i2c_eeprom_slave #(
+        .SLAVE_ADDR(ADDR_EE_SLOW),
+        .WRITE_CYCLE_US(100)
+    ) eeprom_slow (
+        .clk(clk), .rst_n(rst_n), .scl(scl), .sda(sda),
+        .write_busy(slow_busy), .debug_addr_match(), .debug_state()
+    );
+
+    //==========================================================================
+    // Clock
+    //==========================================================================
+    initial begin
+        clk = 0;
+        forever #(CLK_PERIOD/2) clk = ~clk;
+    end
+
+    //==========================================================================
+    // Bit-Level Master (quarter-bit timing, data changes mid SCL low)
+    //==========================================================================
+    task automatic wait_q(input int q);
+        repeat(q) @(posedge clk);
+    endtask
+
+    task automatic bus_start(input int q);
+        if (scl == 1'b0) begin
+            wait_q(q);
+            master_sda_oe  = 1;
+            master_sda_out = 1;
+            wait_q(q);
+            scl = 1;
+            wait_q(2*q);
+        end
+        master_sda_oe  = 1;
+        master_sda_out = 0;
+        wait_q(2*q);
+        scl = 0;
+    endtask
+
+    task automatic bus_stop(input int q);
+        wait_q(q);
+        master_sda_oe  = 1;
+        master_sda_out = 0;
+        wait_q(q);
+        scl = 1;
+        wait_q(2*q);
+        master_sda_out = 1;
+        wait_q(2*q);
+        master_sda_oe  = 0;
+    endtask
+
+    task automatic send_bit(input bit value, input int q);
+        wait_q(q);
+        master_sda_oe  = 1;
+        master_sda_out = value;
+        wait_q(q);
+        scl = 1;
+        wait_q(2*q);
+        scl = 0;
+    endtask
+
+    task automatic recv_bit(output bit value, input int q);
+        wait_q(q);
+        master_sda_oe = 0;
+        wait_q(q);
+        scl = 1;
+        wait_q(q);
+        value = sda;
+        wait_q(q);
+        scl = 0;
+    endtask
+
+    task automatic send_byte(input [7:0] data, input int q, output bit ack);
+        bit b;
+        for (int i = 7; i >= 0; i--) send_bit(data[i], q);
+        recv_bit(b, q);
+        ack = ~b;
+    endtask
+
+    task automatic recv_byte(output [7:0] data, input bit last, input int q);
+        bit b;
+        for (int i = 7; i >= 0; i--) begin
+            recv_bit(b, q);
+            data[i] = b;
+        end
+        send_bit(last, q);  // ACK = 0, NACK on last byte
+    endtask
+
+    //==========================================================================
+    // EEPROM Transactions
+    //==========================================================================
+    // [START][addr W][word][data...][STOP]
+    task automatic ee_write(input [6:0] addr, input [7:0] word,
+                            input logic [7:0] data [$], input int q, output bit ok);
+        bit ack;
+        ok = 1;
+        bus_start(q);
+        send_byte({addr, 1'b0}, q, ack);  ok &= ack;
+        send_byte(word, q, ack);          ok &= ack;
+        foreach (data[i]) begin
+            send_byte(data[i], q, ack);
+            ok &= ack;
+        end
+        bus_stop(q);
+    endtask
+
+    // [START][addr W][word][Sr][addr R][data...][NACK][STOP]
+    task automatic ee_random_read(input [6:0] addr, input [7:0] word, input int n,
+                                  input int q, output logic [7:0] data [$], output bit ok);
+        bit ack;
+        logic [7:0] b;
+        ok = 1;
+        data.delete();
+        bus_start(q);
+        send_byte({addr, 1'b0}, q, ack);  ok &= ack;
+        send_byte(word, q, ack);          ok &= ack;
+        bus_start(q);                     // Sr
+        send_byte({addr, 1'b1}, q, ack);  ok &= ack;
+        for (int i = 0; i < n; i++) begin
+            recv_byte(b, (i == n-1), q);
+            data.push_back(b);
+        end
+        bus_stop(q);
+    endtask
+
+    // [START][addr R][data...][NACK][STOP]
+    task automatic ee_current_read(input [6:0] addr, input int n, input int q,
+                                   output logic [7:0] data [$], output bit ok);
+        bit ack;
+        logic [7:0] b;
+        data.delete();
+        bus_start(q);
+        send_byte({addr, 1'b1}, q, ack);
+        ok = ack;
+        for (int i = 0; i < n; i++) begin
+            recv_byte(b, (i == n-1), q);
+            data.push_back(b);
+        end
+        bus_stop(q);
+    endtask
+
+    // Address-only probe: [START][addr W][STOP], returns ACK
+    task automatic ee_poll(input [6:0] addr, input int q, output bit ack);
+        bus_start(q);
+        send_byte({addr, 1'b0}, q, ack);
+        bus_stop(q);
+    endtask
+
+    task automatic check(input bit cond, input string msg);
+        if (cond) begin
+            $display("  ✓ %s", msg);
+            test_pass++;
+        end else begin
+            $display("  ✗ %s", msg);
+            test_fail++;
+        end
+    endtask
+
+    //==========================================================================
+    // Test Sequence
+    //==========================================================================
+    initial begin
+        logic [7:0] wr [$];
+        logic [7:0] rd [$];
+        bit         ok, ack;
+        bit         match;
+        int         polls;
+        time        t0;
+        real        kbps;
+
+        $display("========================================");
+        $display("I2C EEPROM Slave Test");
+        $display("========================================");
+
+        test_pass      = 0;
+        test_fail      = 0;
+        rst_n          = 0;
+        scl            = 1;
+        master_sda_oe  = 0;
+        master_sda_out = 1;
+
+        repeat(20) @(posedge clk);
+        rst_n = 1;
+        repeat(20) @(posedge clk);
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 1: Page write + random read ===", $time);
+        wr = '{8'h11, 8'h22, 8'h33, 8'h44, 8'h55, 8'h66, 8'h77, 8'h88};
+        ee_write(ADDR_EE, 8'h10, wr, 62, ok);
+        check(ok, "Page write ACKed");
+        ee_random_read(ADDR_EE, 8'h10, 8, 62, rd, ok);
+        check(ok && rd == wr, "Random read returns page");
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 2: Current-address read ===", $time);
+        ee_write(ADDR_EE, 8'h18, '{8'hA0, 8'hA1}, 62, ok);
+        ee_random_read(ADDR_EE, 8'h17, 1, 62, rd, ok);
+        check(ok && rd[0] == 8'h88, "Read 0x17 = 0x88");
+        ee_current_read(ADDR_EE, 2, 62, rd, ok);
+        check(ok && rd[0] == 8'hA0 && rd[1] == 8'hA1, "Current read continues at 0x18");
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 3: Page rollover ===", $time);
+        // 3 bytes at 0x26 in page 0x20..0x27: third byte wraps to 0x20
+        ee_write(ADDR_EE, 8'h26, '{8'hC6, 8'hC7, 8'hC0}, 62, ok);
+        ee_random_read(ADDR_EE, 8'h20, 1, 62, rd, ok);
+        check(rd[0] == 8'hC0, "Byte past page end wrapped to 0x20");
+        ee_random_read(ADDR_EE, 8'h28, 1, 62, rd, ok);
+        check(rd[0] == 8'hFF, "Next page untouched (0x28 = 0xFF)");
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 4: Sequential read wraps 0xFF -> 0x00 ===", $time);
+        ee_write(ADDR_EE, 8'hFF, '{8'h5F}, 62, ok);
+        ee_write(ADDR_EE, 8'h00, '{8'h50}, 62, ok);
+        ee_random_read(ADDR_EE, 8'hFF, 2, 62, rd, ok);
+        check(rd[0] == 8'h5F && rd[1] == 8'h50, "0xFF then 0x00");
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 5: Write cycle ACK polling ===", $time);
+        ee_write(ADDR_EE_SLOW, 8'h00, '{8'h3C}, 62, ok);
+        check(ok && slow_busy, "Write accepted, write cycle started");
+        polls = 0;
+        do begin
+            ee_poll(ADDR_EE_SLOW, 62, ack);
+            polls++;
+        end while (!ack && polls < 100);
+        check(polls > 1, $sformatf("NACKed during tWR (%0d polls)", polls));
+        check(ack && !slow_busy, "ACKed after tWR");
+        ee_random_read(ADDR_EE_SLOW, 8'h00, 1, 62, rd, ok);
+        check(ok && rd[0] == 8'h3C, "Data readable after write cycle");
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 6: 256-byte sequential read throughput ===", $time);
+        for (int s = 0; s < NUM_SPEEDS; s++) begin
+            // Fill the array one page per transaction
+            for (int p = 0; p < 256; p += 8) begin
+                wr.delete();
+                for (int i = 0; i < 8; i++) wr.push_back(8'(p + i + s));
+                ee_write(ADDR_EE, 8'(p), wr, quarter[s], ok);
+            end
+
+            t0 = $time;
+            ee_random_read(ADDR_EE, 8'h00, 256, quarter[s], rd, ok);
+            kbps = 256.0 * 8.0 * 1.0e6 / real'($time - t0);
+
+            match = ok;
+            foreach (rd[i]) if (rd[i] !== 8'(i + s)) match = 0;
+            check(match, $sformatf("%-12s 256 bytes in %0t ns (%0.1f kbit/s payload)",
+                                   label[s], $time - t0, kbps));
+        end
+
+        //----------------------------------------------------------------------
+        $display("\n========================================");
+        $display("Test Summary:");
+        $display("  PASSED: %0d", test_pass);
+        $display("  FAILED: %0d", test_fail);
+        $display("========================================");
+
+        if (test_fail == 0) begin
+            $display("✓ ALL TESTS PASSED!");
+        end else begin
+            $display("✗ SOME TESTS FAILED!");
+        end
+
+        $finish;
+    end
+
+    //==========================================================================
+    // Waveform
+    //==========================================================================
+    initial begin
+        $dumpfile("i2c_eeprom_slave_tb.vcd");
+        $dumpvars(0, i2c_eeprom_slave_tb);
+    end
+
+    //==========================================================================
+    // Timeout
+    //==========================================================================
+    initial begin
+        #500000000;
+        $display("\n✗ ERROR: Simulation timeout!");
+        $finish;
+    end
+
+endmodule
@@ -0,0 +1,288 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// I2C General Call Testbench
+//==============================================================================
+// i2c_master (multi-byte write) + LED (0x55), FND (0x56), Switch (0x57)
+// slaves on one bus. Checks:
+//   - GC WRITE to LED+FND in one transaction, both outputs change in the
+//     same clock cycle
+//   - GC WRITE with a single-device mask leaves the other slave alone
+//   - GC STAGE holds outputs, GC LATCH ("latch now") updates them together
+//   - Unknown GC command is NACKed
+//   - Normal addressed write / read still work
+//==============================================================================
+
+module i2c_general_call_tb;
+
+    //==========================================================================
+    // Parameters
+    //==========================================================================
+    localparam CLK_PERIOD = 10;         // 100 MHz
+
+    localparam [6:0] ADDR_GC  = 7'h00;
+    localparam [6:0] ADDR_LED = 7'h55;
+    localparam [6:0] ADDR_SW  = 7'h57;
+
+    // General call commands: [7:4] opcode, [3:0] mask (bit0 LED, bit1 FND)
+    localparam [7:0] GC_WRITE_ALL = 8'h13;
+    localparam [7:0] GC_WRITE_FND = 8'h12;
+    localparam [7:0] GC_STAGE_ALL = 8'h23;
+    localparam [7:0] GC_LATCH_ALL = 8'h33;
+    localparam [7:0] GC_INVALID   = 8'h53;
+
+    //==========================================================================
+    // Signals
+    //==========================================================================
+    logic       clk;
+    logic       rst_n;
+    tri1        scl;
+    tri1        sda;
+
+    // Master control
+    logic       start;
+    logic       rw_bit;
+    logic [6:0] slave_addr;
+    logic [7:0] byte_count;
+    logic [7:0] tx_data;
+    logic       tx_next;
+    logic [7:0] rx_data;
+    logic       rx_valid;
+    logic       busy;
+    logic       done;
+    logic       ack_error;
+
+    // Slave outputs
+    logic [7:0] LED;
+    logic [6:0] SEG;
+    logic [3:0] AN;
+    logic [7:0] SW;
+
+    // TX byte source for the master (advanced by tx_next)
+    logic [7:0] tx_buf [16];
+    int         tx_idx;
+
+    // Output change timestamps (skew check)
+    time        led_change_time;
+    time        seg_change_time;
+
+    int         test_pass;
+    int         test_fail;
+
+    assign tx_data = tx_buf[tx_idx];
+
+    always @(posedge clk) begin
+        if (tx_next) tx_idx <= tx_idx + 1;
+    end
+
+    always @(LED) led_change_time = $time;
+    always @(SEG) seg_change_time = $time;
+
+    //==========================================================================
+    // DUTs
+    //==========================================================================
+    i2c_master master (
+        .clk(clk),
+        .rst_n(rst_n),
+        .start(start),
+        .rw_bit(rw_bit),
+        .slave_addr(slave_addr),
+        .byte_count(byte_count),
+        .tx_data(tx_data),
+        .tx_next(tx_next),
+        .rx_data(rx_data),
+        .rx_valid(rx_valid),
+        .busy(busy),
+        .done(done),
+        .ack_error(ack_error),
+        .timeout(),
+        .pec_en(1'b0),
+        .pec_error(),
+        .sample_point(8'd0),
+        .scl_quarter(8'd0),
+        .addr_only(1'b0),
+        .hold(1'b0),
+        .abort(1'b0),
+        .sda(sda),
+        .scl(scl),
+        .debug_busy(),
+        .debug_ack(),
+        .debug_state(),
+        .debug_scl(),
+        .debug_sda_out(),
+        .debug_sda_oe()
+    );
+
+    i2c_led_slave led_slave (
+        .clk(clk), .rst_n(rst_n), .scl(scl), .sda(sda),
+        .LED(LED), .debug_addr_match(), .debug_state()
+    );
+
+    i2c_fnd_slave fnd_slave (
+        .clk(clk), .rst_n(rst_n), .scl(scl), .sda(sda),
+        .SEG(SEG), .AN(AN), .debug_addr_match(), .debug_state()
+    );
+
+    i2c_switch_slave switch_slave (
+        .clk(clk), .rst_n(rst_n), .scl(scl), .sda(sda),
+        .SW(SW), .debug_addr_match(), .debug_state()
+    );
+
+    //==========================================================================
+    // Clock
+    //==========================================================================
+    initial begin
+        clk = 0;
+        forever #(CLK_PERIOD/2) clk = ~clk;
+    end
+
+    //==========================================================================
+    // Expected 7-segment pattern (common anode, active low)
+    //==========================================================================
+    function automatic [6:0] seg_of(input [3:0] d);
+        case (d)
+            4'h0: seg_of = 7'b1000000;  4'h1: seg_of = 7'b1111001;
+            4'h2: seg_of = 7'b0100100;  4'h3: seg_of = 7'b0110000;
+            4'h4: seg_of = 7'b0011001;  4'h5: seg_of = 7'b0010010;
+            4'h6: seg_of = 7'b0000010;  4'h7: seg_of = 7'b1111000;
+            4'h8: seg_of = 7'b0000000;  4'h9: seg_of = 7'b0010000;
+            4'hA: seg_of = 7'b0001000;  4'hB: seg_of = 7'b0000011;
+            4'hC: seg_of = 7'b1000110;  4'hD: seg_of = 7'b0100001;
+            4'hE: seg_of = 7'b0000110;  4'hF: seg_of = 7'b0001110;
+        endcase
+    endfunction
+
+    //==========================================================================
+    // Master Transaction Task
+    //==========================================================================
+    task automatic i2c_transaction(input [6:0] addr, input bit rw, input int n);
+        @(posedge clk);
+        tx_idx     = 0;
+        slave_addr = addr;
+        rw_bit     = rw;
+        byte_count = n;
+        start      = 1;
+        @(posedge clk);
+        start      = 0;
+        wait (done);
+        repeat(50) @(posedge clk);
+    endtask
+
+    task automatic check(input bit cond, input string msg);
+        if (cond) begin
+            $display("  ✓ %s", msg);
+            test_pass++;
+        end else begin
+            $display("  ✗ %s", msg);
+            test_fail++;
+        end
+    endtask
+
+    //==========================================================================
+    // Test Sequence
+    //==========================================================================
+    initial begin
+        $display("========================================");
+        $display("I2C General Call Test");
+        $display("========================================");
+
+        test_pass  = 0;
+        test_fail  = 0;
+        rst_n      = 0;
+        start      = 0;
+        rw_bit     = 0;
+        slave_addr = 7'h00;
+        byte_count = 8'd1;
+        tx_idx     = 0;
+        SW         = 8'h5A;
+
+        repeat(20) @(posedge clk);
+        rst_n = 1;
+        repeat(20) @(posedge clk);
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 1: GC WRITE LED+FND (one transaction) ===", $time);
+        tx_buf[0] = GC_WRITE_ALL;
+        tx_buf[1] = 8'hA5;      // LED (slot 0)
+        tx_buf[2] = 8'h07;      // FND (slot 1)
+        i2c_transaction(ADDR_GC, 1'b0, 3);
+        check(!ack_error, "General call ACKed");
+        check(LED == 8'hA5, $sformatf("LED = 0x%02h", LED));
+        check(SEG == seg_of(4'h7), "FND shows 7");
+        check(led_change_time == seg_change_time,
+              $sformatf("LED/FND updated in same cycle (skew = %0t)",
+                        seg_change_time - led_change_time));
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 2: GC WRITE FND only ===", $time);
+        tx_buf[0] = GC_WRITE_FND;
+        tx_buf[1] = 8'h03;      // FND is slot 0 when LED is not selected
+        i2c_transaction(ADDR_GC, 1'b0, 2);
+        check(SEG == seg_of(4'h3), "FND shows 3");
+        check(LED == 8'hA5, "LED unchanged");
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 3: GC STAGE then LATCH ===", $time);
+        tx_buf[0] = GC_STAGE_ALL;
+        tx_buf[1] = 8'h3C;
+        tx_buf[2] = 8'h0E;
+        i2c_transaction(ADDR_GC, 1'b0, 3);
+        check(LED == 8'hA5 && SEG == seg_of(4'h3), "Outputs held after STAGE");
+
+        tx_buf[0] = GC_LATCH_ALL;
+        i2c_transaction(ADDR_GC, 1'b0, 1);
+        check(LED == 8'h3C, $sformatf("LED = 0x%02h after LATCH", LED));
+        check(SEG == seg_of(4'hE), "FND shows E after LATCH");
+        check(led_change_time == seg_change_time, "LATCH updated both in same cycle");
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 4: Unknown GC command ===", $time);
+        tx_buf[0] = GC_INVALID;
+        tx_buf[1] = 8'hFF;
+        i2c_transaction(ADDR_GC, 1'b0, 2);
+        check(ack_error, "Unknown command NACKed");
+        check(LED == 8'h3C, "LED unchanged");
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 5: Addressed write / read ===", $time);
+        tx_buf[0] = 8'h81;
+        i2c_transaction(ADDR_LED, 1'b0, 1);
+        check(!ack_error && LED == 8'h81, "LED write 0x81");
+
+        i2c_transaction(ADDR_SW, 1'b1, 1);
+        check(!ack_error && rx_data == 8'h5A, $sformatf("Switch read 0x%02h", rx_data));
+
+        //----------------------------------------------------------------------
+        $display("\n========================================");
+        $display("Test Summary:");
+        $display("  PASSED: %0d", test_pass);
+        $display("  FAILED: %0d", test_fail);
+        $display("========================================");
+
+        if (test_fail == 0) begin
+            $display("✓ ALL TESTS PASSED!");
+        end else begin
+            $display("✗ SOME TESTS FAILED!");
+        end
+
+        $finish;
+    end
+
+    //==========================================================================
+    // Waveform
+    //==========================================================================
+    initial begin
+        $dumpfile("i2c_general_call_tb.vcd");
+        $dumpvars(0, i2c_general_call_tb);
+    end
+
+    //==========================================================================
+    // Timeout
+    //==========================================================================
+    initial begin
+        #20000000;
+        $display("\n✗ ERROR: Simulation timeout!");
+        $finish;
+    end
+
+endmodule
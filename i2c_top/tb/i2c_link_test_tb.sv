@@ -0,0 +1,308 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// I2C Link Tester Testbench
+//==============================================================================
+// i2c_link_tester -> i2c_master -> i2c_eeprom_slave (0x50, loopback)
+// Speeds: 100 kHz (250), 400 kHz (62), 1 MHz (25), 4th entry skipped
+// Checks:
+//   - Clean speeds: every byte verified, no bit errors, no NACKs
+//   - 2-clk spikes forced on the master's SDA input at 1 MHz only:
+//     bit errors counted at that speed
+//   - Skipped speed reports nothing
+//   - Wrong address: each transaction NACKed, retried MAX_RETRY times,
+//     block skipped
+// Prints throughput and error rate per speed like the firmware would
+//==============================================================================
+
+module i2c_link_test_tb;
+
+    //==========================================================================
+    // Parameters
+    //==========================================================================
+    localparam CLK_PERIOD = 10;         // 100 MHz
+    localparam NUM_SPEEDS = 4;
+    localparam BLOCK_LEN  = 8;
+    localparam MAX_RETRY  = 3;
+    localparam BLOCKS     = 4;
+
+    localparam [6:0] ADDR_EE = 7'h50;
+
+    localparam [31:0] SPEEDS       = 32'h0019_3EFA;     // 250, 62, 25, skip
+    localparam [7:0]  NOISY_Q      = 8'd25;              // Spikes at 1 MHz only
+    localparam        SPIKE_PERIOD = 7;                  // clk
+    localparam        SPIKE_WIDTH  = 2;                  // clk (passes SDA_FILTER = 3)
+
+    //==========================================================================
+    // Signals
+    //==========================================================================
+    logic        clk;
+    logic        rst_n;
+    tri1         scl;
+    tri1         sda;
+
+    // Tester control / results
+    logic        lt_start;
+    logic [6:0]  lt_addr;
+    logic [7:0]  lt_blocks;
+    logic [31:0] lt_speeds;
+    logic        lt_busy;
+    logic        lt_done;
+    logic [1:0]  res_sel;
+    logic [31:0] res_bytes;
+    logic [31:0] res_bit_errors;
+    logic [15:0] res_nacks;
+    logic [15:0] res_retries;
+    logic [31:0] res_cycles;
+
+    // Tester <-> master
+    logic        m_start, m_rw;
+    logic [6:0]  m_addr;
+    logic [7:0]  m_count, m_tx_data, m_quarter;
+    logic        m_tx_next;
+    logic [7:0]  m_rx_data;
+    logic        m_rx_valid;
+    logic        m_done;
+    logic        m_ack_error;
+
+    // Disturbance
+    int          spike_cnt;
+    logic        spike;
+
+    int          test_pass;
+    int          test_fail;
+
+    always @(posedge clk) begin
+        spike_cnt <= (spike_cnt == SPIKE_PERIOD - 1) ? 0 : spike_cnt + 1;
+    end
+
+    assign spike = lt_busy && (m_quarter == NOISY_Q) && (spike_cnt < SPIKE_WIDTH);
+
+    //==========================================================================
+    // DUTs
+    //==========================================================================
+    i2c_link_tester #(
+        .NUM_SPEEDS(NUM_SPEEDS),
+        .BLOCK_LEN(BLOCK_LEN),
+        .MAX_RETRY(MAX_RETRY)
+    ) tester (
+        .clk(clk),
+        .rst_n(rst_n),
+        .start(lt_start),
+        .slave_addr(lt_addr),
+        .blocks(lt_blocks),
+        .speeds(lt_speeds),
+        .busy(lt_busy),
+        .done(lt_done),
+        .res_sel(res_sel),
+        .res_bytes(res_bytes),
+        .res_bit_errors(res_bit_errors),
+        .res_nacks(res_nacks),
+        .res_retries(res_retries),
+        .res_cycles(res_cycles),
+        .m_start(m_start),
+        .m_rw(m_rw),
+        .m_addr(m_addr),
+        .m_count(m_count),
+        .m_tx_data(m_tx_data),
+        .m_quarter(m_quarter),
+        .m_tx_next(m_tx_next),
+        .m_rx_data(m_rx_data),
+        .m_rx_valid(m_rx_valid),
+        .m_done(m_done),
+        .m_ack_error(m_ack_error)
+    );
+
+    i2c_master master (
+        .clk(clk),
+        .rst_n(rst_n),
+        .start(m_start),
+        .rw_bit(m_rw),
+        .slave_addr(m_addr),
+        .byte_count(m_count),
+        .tx_data(m_tx_data),
+        .tx_next(m_tx_next),
+        .rx_data(m_rx_data),
+        .rx_valid(m_rx_valid),
+        .busy(),
+        .done(m_done),
+        .ack_error(m_ack_error),
+        .timeout(),
+        .pec_en(1'b0),
+        .pec_error(),
+        .sample_point(8'd0),
+        .scl_quarter(m_quarter),
+        .addr_only(1'b0),
+        .hold(1'b0),
+        .abort(1'b0),
+        .sda(sda),
+        .scl(scl),
+        .debug_busy(),
+        .debug_ack(),
+        .debug_state(),
+        .debug_scl(),
+        .debug_sda_out(),
+        .debug_sda_oe()
+    );
+
+    i2c_eeprom_slave #(
+        .SLAVE_ADDR(ADDR_EE)
+    ) eeprom (
+        .clk(clk), .rst_n(rst_n), .scl(scl), .sda(sda),
+        .write_busy(), .debug_addr_match(), .debug_state()
+    );
+
+    // Disturb what the master sees, not the bus
+    initial begin
+        force master.sda_pin = sda & ~spike;
+    end
+
+    //==========================================================================
+    // Clock
+    //==========================================================================
+    initial begin
+        clk = 0;
+        forever #(CLK_PERIOD/2) clk = ~clk;
+    end
+
+    //==========================================================================
+    // Tasks
+    //==========================================================================
+    task automatic run_test(input [6:0] addr, input [7:0] blocks, input [31:0] speeds);
+        @(posedge clk);
+        lt_addr   = addr;
+        lt_blocks = blocks;
+        lt_speeds = speeds;
+        lt_start  = 1;
+        @(posedge clk);
+        lt_start  = 0;
+        wait (lt_done);
+        repeat(10) @(posedge clk);
+    endtask
+
+    task automatic select(input int s);
+        res_sel = s;
+        @(posedge clk);
+        #1;
+    endtask
+
+    task automatic report(input int s);
+        real kbps, ber;
+        select(s);
+        kbps = (res_cycles == 0) ? 0.0 :
+               real'(res_bytes) * 8.0 * 1.0e5 / real'(res_cycles);
+        ber  = (res_bytes == 0) ? 0.0 :
+               real'(res_bit_errors) / (real'(res_bytes) * 8.0);
+        $display("  speed %0d (q=%0d): %0d bytes, %0d bit errors (%0.4f), %0d NACK, %0d retry, %0.1f kbit/s",
+                 s, lt_speeds[8*s +: 8], res_bytes, res_bit_errors, ber,
+                 res_nacks, res_retries, kbps);
+    endtask
+
+    task automatic check(input bit cond, input string msg);
+        if (cond) begin
+            $display("  ✓ %s", msg);
+            test_pass++;
+        end else begin
+            $display("  ✗ %s", msg);
+            test_fail++;
+        end
+    endtask
+
+    //==========================================================================
+    // Test Sequence
+    //==========================================================================
+    initial begin
+        logic [31:0] cycles_100k;
+        logic [31:0] cycles_400k;
+
+        $display("========================================");
+        $display("I2C Link Tester (PRBS Loopback) Test");
+        $display("========================================");
+
+        test_pass = 0;
+        test_fail = 0;
+        rst_n     = 0;
+        lt_start  = 0;
+        lt_addr   = ADDR_EE;
+        lt_blocks = BLOCKS;
+        lt_speeds = SPEEDS;
+        res_sel   = 0;
+        spike_cnt = 0;
+
+        repeat(20) @(posedge clk);
+        rst_n = 1;
+        repeat(20) @(posedge clk);
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 1: Sweep 100k / 400k / 1M, spikes at 1M ===", $time);
+        run_test(ADDR_EE, BLOCKS, SPEEDS);
+        for (int s = 0; s < NUM_SPEEDS; s++) report(s);
+
+        select(0);
+        cycles_100k = res_cycles;
+        check(res_bytes == BLOCKS * BLOCK_LEN && res_bit_errors == 0 && res_nacks == 0,
+              "100 kHz: all bytes verified, no errors");
+
+        select(1);
+        cycles_400k = res_cycles;
+        check(res_bytes == BLOCKS * BLOCK_LEN && res_bit_errors == 0 && res_nacks == 0,
+              "400 kHz: all bytes verified, no errors");
+        check(cycles_400k < cycles_100k, "400 kHz run is faster than 100 kHz");
+
+        select(2);
+        check(res_bytes == BLOCKS * BLOCK_LEN && res_bit_errors > 0,
+              $sformatf("1 MHz with spikes: %0d bit errors counted", res_bit_errors));
+
+        select(3);
+        check(res_bytes == 0 && res_cycles == 0, "Skipped speed reports nothing");
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 2: Absent slave, NACK retries ===", $time);
+        run_test(7'h51, 8'd2, 32'h0000_003E);
+        report(0);
+        select(0);
+        check(res_bytes == 0, "No bytes verified");
+        check(res_nacks == 2 * (MAX_RETRY + 1) && res_retries == 2 * MAX_RETRY,
+              $sformatf("%0d NACKs, %0d retries over 2 blocks", res_nacks, res_retries));
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 3: Clean rerun clears the results ===", $time);
+        run_test(ADDR_EE, 8'd1, 32'h0000_003E);
+        select(0);
+        check(res_bytes == BLOCK_LEN && res_bit_errors == 0 && res_nacks == 0,
+              "400 kHz single block clean");
+
+        //----------------------------------------------------------------------
+        $display("\n========================================");
+        $display("Test Summary:");
+        $display("  PASSED: %0d", test_pass);
+        $display("  FAILED: %0d", test_fail);
+        $display("========================================");
+
+        if (test_fail == 0) begin
+            $display("✓ ALL TESTS PASSED!");
+        end else begin
+            $display("✗ SOME TESTS FAILED!");
+        end
+
+        $finish;
+    end
+
+    //==========================================================================
+    // Waveform
+    //==========================================================================
+    initial begin
+        $dumpfile("i2c_link_test_tb.vcd");
+        $dumpvars(0, i2c_link_test_tb);
+    end
+
+    //==========================================================================
+    // Timeout
+    //==========================================================================
+    initial begin
+        #50000000;
+        $display("\n✗ ERROR: Simulation timeout!");
+        $finish;
+    end
+
+endmodule
@@ -0,0 +1,476 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// I2C SMBus PEC Testbench
+//==============================================================================
+// i2c_master (pec_en) -> i2c_slave_top (slave_register_mapped, 0x55)
+// Checks:
+//   - PEC write lands; PEC read returns data with pec_error = 0
+//   - Bit flipped on the slave's SDA input: burst dropped, PEC_STAT /
+//     PEC_ERRS updated
+//   - Write without PEC while the slave expects one is rejected
+//   - Bit flipped on the master's SDA input: pec_error set
+//   - PEC_CTRL[7] clears the error counter
+//   - Slow back end (0x56, ACCESS_LATENCY 10 us > SCL low): the slave
+//     stretches SCL, the master waits and reads correct data
+//   - SCL held low for good: the master gives up after STRETCH_TIMEOUT
+//     (done with ack_error + timeout, lines released), the next
+//     transaction clears timeout and works
+//   - abort in the middle of a write: done with ack_error, timeout clear,
+//     lines released
+// Faults are injected by forcing one SDA sample inside the receiver only,
+// so the sender still computes the PEC over the original byte.
+//==============================================================================
+
+module i2c_pec_tb;
+
+    //==========================================================================
+    // Parameters
+    //==========================================================================
+    localparam CLK_PERIOD = 10;         // 100 MHz
+
+    localparam [6:0] ADDR_REGMAP = 7'h55;
+    localparam [6:0] ADDR_SLOW   = 7'h56;   // Slow back end instance
+    localparam       SLOW_LATENCY = 1000;   // 10 us > SCL low phase (5 us)
+    localparam       STRETCH_MAX  = 3000;   // Master stretch timeout, 30 us
+
+    // slave_register_map registers
+    localparam [7:0] REG_SW_DATA  = 8'h00;
+    localparam [7:0] REG_LED_LOW  = 8'h01;
+    localparam [7:0] REG_PEC_CTRL = 8'h04;
+    localparam [7:0] REG_PEC_STAT = 8'h05;
+
+    // PEC_CTRL: enable, slave appends PEC after 4 read bytes
+    localparam [7:0] PEC_CTRL_ON    = 8'h31;
+    localparam [7:0] PEC_CTRL_CLEAR = 8'h80;
+
+    // FSM encodings used for fault injection
+    localparam [3:0] SLV_RX_DATA  = 4'd6;
+    localparam [4:0] MST_DATA_BIT = 5'd6;
+    localparam [1:0] SCL_HIGH_1   = 2'd2;
+    localparam [1:0] SCL_HIGH_2   = 2'd3;
+
+    //==========================================================================
+    // Signals
+    //==========================================================================
+    logic        clk;
+    logic        rst_n;
+    tri1         scl;
+    tri1         sda;
+
+    // Master control
+    logic        start;
+    logic        rw_bit;
+    logic [6:0]  slave_addr;
+    logic [7:0]  byte_count;
+    logic [7:0]  tx_data;
+    logic        tx_next;
+    logic [7:0]  rx_data;
+    logic        rx_valid;
+    logic        busy;
+    logic        done;
+    logic        ack_error;
+    logic        timeout;
+    logic        abort;
+    logic        pec_en;
+    logic        pec_error;
+
+    // Slave I/O
+    logic [15:0] SW;
+    logic [15:0] LED;
+    logic [6:0]  SEG;
+    logic [3:0]  AN;
+    logic [15:0] LED_slow;
+    logic [6:0]  target;
+
+    // SCL forced low by the testbench (stuck slave)
+    logic        scl_hold;
+    assign scl = scl_hold ? 1'b0 : 1'bz;
+
+    // Longest SCL low period (clock stretching)
+    time         scl_fall;
+    time         max_scl_low;
+
+    // TX byte source (advanced by tx_next) and RX sink
+    logic [7:0]  tx_buf [16];
+    int          tx_idx;
+    logic [7:0]  rx_q [$];
+
+    int          test_pass;
+    int          test_fail;
+
+    assign tx_data = tx_buf[tx_idx];
+
+    always @(posedge clk) begin
+        if (tx_next)  tx_idx <= tx_idx + 1;
+        if (rx_valid) rx_q.push_back(rx_data);
+    end
+
+    //==========================================================================
+    // DUTs
+    //==========================================================================
+    i2c_master #(
+        .STRETCH_TIMEOUT(STRETCH_MAX)
+    ) master (
+        .clk(clk),
+        .rst_n(rst_n),
+        .start(start),
+        .rw_bit(rw_bit),
+        .slave_addr(slave_addr),
+        .byte_count(byte_count),
+        .tx_data(tx_data),
+        .tx_next(tx_next),
+        .rx_data(rx_data),
+        .rx_valid(rx_valid),
+        .busy(busy),
+        .done(done),
+        .ack_error(ack_error),
+        .timeout(timeout),
+        .pec_en(pec_en),
+        .pec_error(pec_error),
+        .sample_point(8'd0),
+        .scl_quarter(8'd0),
+        .addr_only(1'b0),
+        .hold(1'b0),
+        .abort(abort),
+        .sda(sda),
+        .scl(scl),
+        .debug_busy(),
+        .debug_ack(),
+        .debug_state(),
+        .debug_scl(),
+        .debug_sda_out(),
+        .debug_sda_oe()
+    );
+
+    i2c_slave_top #(
+        .SLAVE_ADDR(ADDR_REGMAP)
+    ) slave (
+        .clk(clk),
+        .rst_n(rst_n),
+        .scl(scl),
+        .sda(sda),
+        .SW(SW),
+        .LED(LED),
+        .SEG(SEG),
+        .AN(AN),
+        .debug_addr_match(),
+        .debug_state()
+    );
+
+    i2c_slave_top #(
+        .SLAVE_ADDR(ADDR_SLOW),
+        .ACCESS_LATENCY(SLOW_LATENCY)
+    ) slave_slow (
+        .clk(clk),
+        .rst_n(rst_n),
+        .scl(scl),
+        .sda(sda),
+        .SW(SW),
+        .LED(LED_slow),
+        .SEG(),
+        .AN(),
+        .debug_addr_match(),
+        .debug_state()
+    );
+
+    always @(negedge scl) scl_fall = $time;
+    always @(posedge scl) begin
+        if (rst_n && ($time - scl_fall) > max_scl_low)
+            max_scl_low = $time - scl_fall;
+    end
+
+    //==========================================================================
+    // Clock
+    //==========================================================================
+    initial begin
+        clk = 0;
+        forever #(CLK_PERIOD/2) clk = ~clk;
+    end
+
+    //==========================================================================
+    // Master Transaction Tasks
+    //==========================================================================
+    task automatic i2c_transaction(input bit rw, input int n, input bit pec);
+        @(posedge clk);
+        tx_idx     = 0;
+        slave_addr = target;
+        rw_bit     = rw;
+        byte_count = n;
+        pec_en     = pec;
+        start      = 1;
+        @(posedge clk);
+        start      = 0;
+        wait (done);
+        repeat(50) @(posedge clk);
+    endtask
+
+    // [reg][data...]
+    task automatic reg_write(input [7:0] reg_addr, input logic [7:0] data [$],
+                             input bit pec);
+        tx_buf[0] = reg_addr;
+        foreach (data[i]) tx_buf[i+1] = data[i];
+        i2c_transaction(1'b0, data.size() + 1, pec);
+    endtask
+
+    // Pointer write, then current-address read of n bytes
+    task automatic reg_read(input [7:0] reg_addr, input int n, input bit pec,
+                            output logic [7:0] data [$]);
+        tx_buf[0] = reg_addr;
+        i2c_transaction(1'b0, 1, pec);
+        rx_q.delete();
+        i2c_transaction(1'b1, n, pec);
+        data = rx_q;
+    endtask
+
+    //==========================================================================
+    // Fault Injection
+    //==========================================================================
+    // Invert one bit of the next write data byte as seen by the slave. The
+    // forced value is held for a whole SCL period (applied and released
+    // while SCL is low) so no false START/STOP is seen.
+    task automatic corrupt_slave_rx(input int bitpos);
+        logic v;
+        wait (slave.protocol.state == SLV_RX_DATA &&
+              slave.protocol.bit_count == bitpos);
+        @(posedge clk iff slave.protocol.scl_falling_edge);
+        #1;
+        v = slave.protocol.sda_in;
+        force slave.protocol.sda_in = ~v;
+        @(posedge clk iff slave.protocol.scl_falling_edge);
+        #1;
+        release slave.protocol.sda_in;
+    endtask
+
+    // Invert one bit of the next read byte as sampled by the master
+    task automatic corrupt_master_rx(input int bitpos);
+        logic v;
+        wait (master.state == MST_DATA_BIT && master.bit_count == bitpos &&
+              master.scl_phase == SCL_HIGH_1);
+        v = master.sda_in;
+        force master.sda_in = ~v;
+        wait (master.scl_phase == SCL_HIGH_2);
+        release master.sda_in;
+    endtask
+
+    task automatic check(input bit cond, input string msg);
+        if (cond) begin
+            $display("  ✓ %s", msg);
+            test_pass++;
+        end else begin
+            $display("  ✗ %s", msg);
+            test_fail++;
+        end
+    endtask
+
+    //==========================================================================
+    // Test Sequence
+    //==========================================================================
+    initial begin
+        logic [7:0] rd [$];
+
+        $display("========================================");
+        $display("I2C SMBus PEC Test");
+        $display("========================================");
+
+        test_pass  = 0;
+        test_fail  = 0;
+        rst_n      = 0;
+        scl_hold   = 0;
+        abort      = 0;
+        start      = 0;
+        rw_bit     = 0;
+        slave_addr = ADDR_REGMAP;
+        byte_count = 8'd1;
+        pec_en     = 0;
+        tx_idx     = 0;
+        SW         = 16'h00A7;
+        target     = ADDR_REGMAP;
+        scl_fall   = 0;
+        max_scl_low = 0;
+
+        repeat(20) @(posedge clk);
+        rst_n = 1;
+        repeat(20) @(posedge clk);
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 1: Enable PEC in the slave ===", $time);
+        reg_write(REG_PEC_CTRL, '{PEC_CTRL_ON}, 1'b0);
+        check(!ack_error, "PEC_CTRL written without PEC");
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 2: Write + read with PEC ===", $time);
+        reg_write(REG_LED_LOW, '{8'hCD, 8'hAB, 8'h06}, 1'b1);
+        check(!ack_error && LED == 16'hABCD, $sformatf("LED = 0x%04h", LED));
+
+        reg_read(REG_SW_DATA, 4, 1'b1, rd);
+        check(!ack_error && !pec_error, "Read PEC matches");
+        check(rd.size() == 4 && rd[0] == 8'hA7 && rd[1] == 8'hCD &&
+              rd[2] == 8'hAB && rd[3] == 8'h06,
+              $sformatf("SW/LED_LOW/LED_HIGH/FND = %02h %02h %02h %02h",
+                        rd[0], rd[1], rd[2], rd[3]));
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 3: Corrupted write is dropped ===", $time);
+        fork
+            reg_write(REG_LED_LOW, '{8'h11, 8'h22}, 1'b1);
+            corrupt_slave_rx(3);
+        join
+        check(LED == 16'hABCD, $sformatf("LED unchanged (0x%04h)", LED));
+
+        reg_read(REG_PEC_STAT, 4, 1'b1, rd);
+        check(!pec_error && rd[0] == 8'h03 && rd[1] == 8'h01,
+              $sformatf("PEC_STAT = 0x%02h, PEC_ERRS = %0d", rd[0], rd[1]));
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 4: Write without PEC is rejected ===", $time);
+        reg_write(REG_LED_LOW, '{8'h33, 8'h44}, 1'b0);
+        check(LED == 16'hABCD, $sformatf("LED unchanged (0x%04h)", LED));
+
+        reg_read(REG_PEC_STAT, 4, 1'b1, rd);
+        check(rd[1] == 8'h02, $sformatf("PEC_ERRS = %0d", rd[1]));
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 5: Corrupted read sets pec_error ===", $time);
+        tx_buf[0] = REG_SW_DATA;
+        i2c_transaction(1'b0, 1, 1'b1);
+        rx_q.delete();
+        fork
+            i2c_transaction(1'b1, 4, 1'b1);
+            corrupt_master_rx(5);
+        join
+        check(!ack_error && pec_error, "Master flagged PEC mismatch");
+        check(rx_q.size() == 4 && rx_q[0] != 8'hA7, "Corrupted byte delivered, frame flagged");
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 6: Good write after errors, clear counters ===", $time);
+        reg_write(REG_LED_LOW, '{8'h5A}, 1'b1);
+        check(LED == 16'hAB5A, $sformatf("LED = 0x%04h", LED));
+
+        reg_write(REG_PEC_CTRL, '{PEC_CTRL_CLEAR | PEC_CTRL_ON}, 1'b1);
+        reg_read(REG_PEC_CTRL, 4, 1'b1, rd);
+        check(!pec_error && rd[0] == PEC_CTRL_ON && rd[1] == 8'h00 && rd[2] == 8'h00,
+              $sformatf("PEC_CTRL = 0x%02h, PEC_STAT = 0x%02h, PEC_ERRS = %0d",
+                        rd[0], rd[1], rd[2]));
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 7: Slow back end stretches SCL ===", $time);
+        target      = ADDR_SLOW;
+        max_scl_low = 0;
+        reg_write(REG_LED_LOW, '{8'h3C, 8'hC3}, 1'b0);
+        check(!ack_error && LED_slow == 16'hC33C, $sformatf("Slow LED = 0x%04h", LED_slow));
+
+        reg_read(REG_SW_DATA, 3, 1'b0, rd);
+        check(!ack_error && rd.size() == 3 && rd[0] == 8'hA7 && rd[1] == 8'h3C &&
+              rd[2] == 8'hC3,
+              $sformatf("SW/LED_LOW/LED_HIGH = %02h %02h %02h", rd[0], rd[1], rd[2]));
+        check(max_scl_low > SLOW_LATENCY * CLK_PERIOD,
+              $sformatf("Master waited for the stretch (longest SCL low = %0t)", max_scl_low));
+        target = ADDR_REGMAP;
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 8: SCL held low past the stretch timeout ===", $time);
+        begin
+            time t_hold;
+            time t_done;
+
+            // Hold SCL inside the address byte, where no slave drives SDA
+            tx_buf[0] = REG_LED_LOW;
+            tx_buf[1] = 8'h5A;
+            @(posedge clk);
+            tx_idx     = 0;
+            slave_addr = target;
+            rw_bit     = 1'b0;
+            byte_count = 2;
+            pec_en     = 1'b0;
+            start      = 1;
+            @(posedge clk);
+            start      = 0;
+            repeat (3) @(negedge scl);
+            scl_hold = 1;
+            t_hold   = $time;
+            fork
+                wait (done);
+                #(STRETCH_MAX * CLK_PERIOD * 2);
+            join_any
+            disable fork;
+            t_done = $time;
+            check(done && ack_error && timeout && !busy,
+                  $sformatf("Master gave up: done=%0b ack_error=%0b timeout=%0b busy=%0b",
+                            done, ack_error, timeout, busy));
+            check(t_done - t_hold >= STRETCH_MAX * CLK_PERIOD &&
+                  t_done - t_hold < STRETCH_MAX * CLK_PERIOD + 100 * CLK_PERIOD,
+                  $sformatf("After the stretch timeout (%0t)", t_done - t_hold));
+            check(master.scl_reg && master.sda_out,
+                  "SCL and SDA released");
+            scl_hold = 0;
+            repeat (50) @(posedge clk);
+        end
+
+        reg_write(REG_LED_LOW, '{8'hA5, 8'h5A}, 1'b1);
+        check(!ack_error && !timeout && LED == 16'h5AA5,
+              $sformatf("Next transaction clears timeout, LED = 0x%04h", LED));
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 9: Abort a running write ===", $time);
+        tx_buf[0] = REG_LED_LOW;
+        tx_buf[1] = 8'h11;
+        tx_buf[2] = 8'h22;
+        @(posedge clk);
+        tx_idx     = 0;
+        slave_addr = target;
+        rw_bit     = 1'b0;
+        byte_count = 3;
+        pec_en     = 1'b1;
+        start      = 1;
+        @(posedge clk);
+        start      = 0;
+        repeat (12) @(negedge scl);             // Inside the register byte
+        @(posedge clk);
+        abort = 1;
+        @(posedge clk);
+        abort = 0;
+        @(posedge clk);
+        check(!busy && ack_error && !timeout,
+              $sformatf("Aborted: busy=%0b ack_error=%0b timeout=%0b", busy, ack_error, timeout));
+        check(master.scl_reg && master.sda_out, "SCL and SDA released");
+        repeat (50) @(posedge clk);
+
+        reg_write(REG_LED_LOW, '{8'h3C, 8'hC3}, 1'b1);
+        check(!ack_error && LED == 16'hC33C,
+              $sformatf("Next transaction works, LED = 0x%04h", LED));
+
+        //----------------------------------------------------------------------
+        $display("\n========================================");
+        $display("Test Summary:");
+        $display("  PASSED: %0d", test_pass);
+        $display("  FAILED: %0d", test_fail);
+        $display("========================================");
+
+        if (test_fail == 0) begin
+            $display("✓ ALL TESTS PASSED!");
+        end else begin
+            $display("✗ SOME TESTS FAILED!");
+        end
+
+        $finish;
+    end
+
+    //==========================================================================
+    // Waveform
+    //==========================================================================
+    initial begin
+        $dumpfile("i2c_pec_tb.vcd");
+        $dumpvars(0, i2c_pec_tb);
+    end
+
+    //==========================================================================
+    // Timeout
+    //==========================================================================
+    initial begin
+        #50000000;
+        $display("\n✗ ERROR: Simulation timeout!");
+        $finish;
+    end
+
+endmodule
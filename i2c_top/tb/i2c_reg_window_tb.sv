@@ -0,0 +1,413 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// I2C Register Window Testbench
+//==============================================================================
+// AXI4-Lite S00 (registers) + S01 (window) -> i2c_master_v1_0
+//   -> i2c_eeprom_slave (0x50), nothing at 0x51
+// Window offset = {slave, reg, 2'b00}
+// Checks:
+//   - Stalling store: BVALID only after the I2C write, BRESP OKAY
+//   - Load: START, pointer write, repeated START, read, one STOP
+//   - Absent slave: load RRESP SLVERR with RDATA[8] set, store BRESP SLVERR
+//     and STATUS[6], write 1 clears it
+//   - Posted store (REG5[1]): BVALID within a few clk, a following load
+//     still sees the stored value; a NACKed posted store sets STATUS[6]
+//   - Window accesses use the speed table (0x50 at 1 MHz)
+//   - REG0 transactions still work after window traffic
+//==============================================================================
+
+module i2c_reg_window_tb;
+
+    //==========================================================================
+    // Parameters
+    //==========================================================================
+    localparam CLK_PERIOD = 10;         // 100 MHz
+
+    localparam [6:0] ADDR_EE     = 7'h50;
+    localparam [6:0] ADDR_ABSENT = 7'h51;
+
+    // AXI register offsets (i2c_regs.h)
+    localparam [6:0] REG_CONTROL = 7'h00;
+    localparam [6:0] REG_STATUS  = 7'h04;
+    localparam [6:0] REG_RX_DATA = 7'h08;
+    localparam [6:0] REG_CONFIG  = 7'h14;
+    localparam [6:0] REG_SPEED   = 7'h30;
+
+    localparam [31:0] CFG_I2C    = 32'h0000_0500;   // Reset value
+    localparam [31:0] CFG_POSTED = 32'h0000_0502;
+
+    localparam [1:0] RESP_OKAY   = 2'b00;
+    localparam [1:0] RESP_SLVERR = 2'b10;
+
+    //==========================================================================
+    // Signals
+    //==========================================================================
+    logic        clk;
+    logic        rst_n;
+    tri1         scl;
+    tri1         sda;
+
+    // AXI4-Lite S00
+    logic [6:0]  awaddr;
+    logic        awvalid;
+    wire         awready;
+    logic [31:0] wdata;
+    logic [3:0]  wstrb;
+    logic        wvalid;
+    wire         wready;
+    wire  [1:0]  bresp;
+    wire         bvalid;
+    logic        bready;
+    logic [6:0]  araddr;
+    logic        arvalid;
+    wire         arready;
+    wire  [31:0] rdata;
+    wire  [1:0]  rresp;
+    wire         rvalid;
+    logic        rready;
+
+    // AXI4-Lite S01 (window)
+    logic [16:0] w_awaddr;
+    logic        w_awvalid;
+    wire         w_awready;
+    logic [31:0] w_wdata;
+    logic [3:0]  w_wstrb;
+    logic        w_wvalid;
+    wire         w_wready;
+    wire  [1:0]  w_bresp;
+    wire         w_bvalid;
+    logic        w_bready;
+    logic [16:0] w_araddr;
+    logic        w_arvalid;
+    wire         w_arready;
+    wire  [31:0] w_rdata;
+    wire  [1:0]  w_rresp;
+    wire         w_rvalid;
+    logic        w_rready;
+
+    // Bus conditions and SCL period
+    int          starts;
+    int          stops;
+    time         scl_rise;
+    time         scl_period;
+
+    int          test_pass;
+    int          test_fail;
+
+    always @(negedge sda) if (scl === 1'b1) starts++;
+    always @(posedge sda) if (scl === 1'b1) stops++;
+
+    always @(posedge scl) begin
+        if (scl_rise != 0 && $time - scl_rise < scl_period) begin
+            scl_period = $time - scl_rise;
+        end
+        scl_rise = $time;
+    end
+
+    //==========================================================================
+    // DUTs
+    //==========================================================================
+    i2c_master_v1_0 #(
+        .I2C_SCL_FREQ(100_000)
+    ) dut (
+        .sda(sda),
+        .scl(scl),
+        .spi_sck(),
+        .spi_mosi(),
+        .spi_miso(1'b0),
+        .spi_cs_n(),
+        .i2c_clk(clk),
+        .i2c_aresetn(rst_n),
+        .s00_axi_aclk(clk),
+        .s00_axi_aresetn(rst_n),
+        .s00_axi_awaddr(awaddr),
+        .s00_axi_awprot(3'b000),
+        .s00_axi_awvalid(awvalid),
+        .s00_axi_awready(awready),
+        .s00_axi_wdata(wdata),
+        .s00_axi_wstrb(wstrb),
+        .s00_axi_wvalid(wvalid),
+        .s00_axi_wready(wready),
+        .s00_axi_bresp(bresp),
+        .s00_axi_bvalid(bvalid),
+        .s00_axi_bready(bready),
+        .s00_axi_araddr(araddr),
+        .s00_axi_arprot(3'b000),
+        .s00_axi_arvalid(arvalid),
+        .s00_axi_arready(arready),
+        .s00_axi_rdata(rdata),
+        .s00_axi_rresp(rresp),
+        .s00_axi_rvalid(rvalid),
+        .s00_axi_rready(rready),
+        .s01_axi_aclk(clk),
+        .s01_axi_aresetn(rst_n),
+        .s01_axi_awaddr(w_awaddr),
+        .s01_axi_awprot(3'b000),
+        .s01_axi_awvalid(w_awvalid),
+        .s01_axi_awready(w_awready),
+        .s01_axi_wdata(w_wdata),
+        .s01_axi_wstrb(w_wstrb),
+        .s01_axi_wvalid(w_wvalid),
+        .s01_axi_wready(w_wready),
+        .s01_axi_bresp(w_bresp),
+        .s01_axi_bvalid(w_bvalid),
+        .s01_axi_bready(w_bready),
+        .s01_axi_araddr(w_araddr),
+        .s01_axi_arprot(3'b000),
+        .s01_axi_arvalid(w_arvalid),
+        .s01_axi_arready(w_arready),
+        .s01_axi_rdata(w_rdata),
+        .s01_axi_rresp(w_rresp),
+        .s01_axi_rvalid(w_rvalid),
+        .s01_axi_rready(w_rready)
+    );
+
+    i2c_eeprom_slave #(
+        .SLAVE_ADDR(ADDR_EE)
+    ) eeprom (
+        .clk(clk), .rst_n(rst_n), .scl(scl), .sda(sda),
+        .write_busy(), .debug_addr_match(), .debug_state()
+    );
+
+    //==========================================================================
+    // Clock
+    //==========================================================================
+    initial begin
+        clk = 0;
+        forever #(CLK_PERIOD/2) clk = ~clk;
+    end
+
+    //==========================================================================
+    // AXI4-Lite Tasks (S00)
+    //==========================================================================
+    task automatic axi_write(input [6:0] addr, input [31:0] data, input [3:0] strb = 4'hF);
+        @(posedge clk);
+        awaddr  <= addr;
+        awvalid <= 1;
+        wdata   <= data;
+        wstrb   <= strb;
+        wvalid  <= 1;
+        bready  <= 1;
+        @(posedge clk iff (awready && wready));
+        awvalid <= 0;
+        wvalid  <= 0;
+        @(posedge clk iff bvalid);
+        bready  <= 0;
+    endtask
+
+    task automatic axi_read(input [6:0] addr, output [31:0] data);
+        @(posedge clk);
+        araddr  <= addr;
+        arvalid <= 1;
+        rready  <= 1;
+        @(posedge clk iff arready);
+        arvalid <= 0;
+        @(posedge clk iff rvalid);
+        data    = rdata;
+        rready  <= 0;
+    endtask
+
+    //==========================================================================
+    // Window Tasks (S01): store / load one slave register
+    //==========================================================================
+    function automatic [16:0] win_offset(input [6:0] slave, input [7:0] reg_addr);
+        return {slave, reg_addr, 2'b00};
+    endfunction
+
+    // t = AWVALID to BVALID
+    task automatic win_store(input [6:0] slave, input [7:0] reg_addr, input [7:0] data,
+                             output [1:0] resp, output time t);
+        time t0;
+        @(posedge clk);
+        t0        = $time;
+        w_awaddr  <= win_offset(slave, reg_addr);
+        w_awvalid <= 1;
+        w_wdata   <= {24'h0, data};
+        w_wstrb   <= 4'h1;
+        w_wvalid  <= 1;
+        w_bready  <= 1;
+        @(posedge clk iff (w_awready && w_wready));
+        w_awvalid <= 0;
+        w_wvalid  <= 0;
+        @(posedge clk iff w_bvalid);
+        resp      = w_bresp;
+        t         = $time - t0;
+        w_bready  <= 0;
+    endtask
+
+    task automatic win_load(input [6:0] slave, input [7:0] reg_addr,
+                            output [31:0] data, output [1:0] resp);
+        @(posedge clk);
+        w_araddr  <= win_offset(slave, reg_addr);
+        w_arvalid <= 1;
+        w_rready  <= 1;
+        @(posedge clk iff w_arready);
+        w_arvalid <= 0;
+        @(posedge clk iff w_rvalid);
+        data      = w_rdata;
+        resp      = w_rresp;
+        w_rready  <= 0;
+    endtask
+
+    // Poll STATUS.busy and STATUS.bus_busy (window access pending)
+    task automatic wait_idle(output logic [31:0] st);
+        repeat(5) @(posedge clk);
+        do axi_read(REG_STATUS, st); while (st[0] || st[7]);
+    endtask
+
+    task automatic check(input bit cond, input string msg);
+        if (cond) begin
+            $display("  ✓ %s", msg);
+            test_pass++;
+        end else begin
+            $display("  ✗ %s", msg);
+            test_fail++;
+        end
+    endtask
+
+    //==========================================================================
+    // Test Sequence
+    //==========================================================================
+    initial begin
+        logic [31:0] rd, st;
+        logic [1:0]  resp;
+        time         t;
+        int          s0, p0;
+
+        $display("========================================");
+        $display("I2C Register Window Test");
+        $display("========================================");
+
+        test_pass  = 0;
+        test_fail  = 0;
+        rst_n      = 0;
+        awaddr     = 0;
+        awvalid    = 0;
+        wdata      = 0;
+        wstrb      = 0;
+        wvalid     = 0;
+        bready     = 0;
+        araddr     = 0;
+        arvalid    = 0;
+        rready     = 0;
+        w_awaddr   = 0;
+        w_awvalid  = 0;
+        w_wdata    = 0;
+        w_wstrb    = 0;
+        w_wvalid   = 0;
+        w_bready   = 0;
+        w_araddr   = 0;
+        w_arvalid  = 0;
+        w_rready   = 0;
+        starts     = 0;
+        stops      = 0;
+        scl_rise   = 0;
+        scl_period = '1;
+
+        repeat(20) @(posedge clk);
+        rst_n = 1;
+        repeat(20) @(posedge clk);
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 1: Stalling store / load ===", $time);
+        s0 = starts; p0 = stops;
+        win_store(ADDR_EE, 8'h10, 8'hA5, resp, t);
+        check(resp == RESP_OKAY && t > 250_000,
+              $sformatf("Store 0x50[0x10] = A5: OKAY after %0t ns", t));
+        check(starts - s0 == 1 && stops - p0 == 1, "Store: one START, one STOP");
+
+        s0 = starts; p0 = stops;
+        win_load(ADDR_EE, 8'h10, rd, resp);
+        check(resp == RESP_OKAY && rd == 32'h0000_00A5,
+              $sformatf("Load 0x50[0x10] = 0x%08h", rd));
+        check(starts - s0 == 2 && stops - p0 == 1,
+              $sformatf("Load: START + Sr (%0d), one STOP (%0d)", starts - s0, stops - p0));
+
+        win_store(ADDR_EE, 8'h11, 8'h3C, resp, t);
+        win_load(ADDR_EE, 8'h10, rd, resp);
+        check(rd[7:0] == 8'hA5, "Neighbour register untouched");
+        win_load(ADDR_EE, 8'h11, rd, resp);
+        check(resp == RESP_OKAY && rd[7:0] == 8'h3C, "Load 0x50[0x11] = 3C");
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 2: Absent slave ===", $time);
+        win_load(ADDR_ABSENT, 8'h10, rd, resp);
+        check(resp == RESP_SLVERR && rd == 32'h0000_01FF,
+              $sformatf("Load 0x51: SLVERR, RDATA 0x%08h", rd));
+        win_store(ADDR_ABSENT, 8'h10, 8'h00, resp, t);
+        check(resp == RESP_SLVERR, "Store 0x51: SLVERR");
+        axi_read(REG_STATUS, st);
+        check(st[6], "STATUS[6] set by the NACKed store");
+        axi_write(REG_STATUS, 32'h0000_0040);
+        axi_read(REG_STATUS, st);
+        check(!st[6], "STATUS[6] cleared by writing 1");
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 3: Posted stores ===", $time);
+        axi_write(REG_CONFIG, CFG_POSTED);
+        win_store(ADDR_EE, 8'h20, 8'h77, resp, t);
+        check(resp == RESP_OKAY && t < 100, $sformatf("Posted store: OKAY after %0t ns", t));
+        win_load(ADDR_EE, 8'h20, rd, resp);
+        check(resp == RESP_OKAY && rd[7:0] == 8'h77, "Following load sees the posted store");
+
+        win_store(ADDR_ABSENT, 8'h20, 8'h00, resp, t);
+        check(resp == RESP_OKAY, "Posted store to 0x51: OKAY");
+        wait_idle(st);
+        check(st[6], "STATUS[6] set by the NACKed posted store");
+        axi_write(REG_STATUS, 32'h0000_0040);
+        axi_write(REG_CONFIG, CFG_I2C);
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 4: Window uses the speed table ===", $time);
+        axi_write(REG_SPEED, {17'h0, ADDR_EE, 8'd25});
+        scl_rise   = 0;
+        scl_period = '1;
+        win_load(ADDR_EE, 8'h11, rd, resp);
+        check(resp == RESP_OKAY && rd[7:0] == 8'h3C && scl_period >= 950 && scl_period <= 1050,
+              $sformatf("Load at %0t ns SCL", scl_period));
+        axi_write(REG_SPEED, {17'h0, ADDR_EE, 8'd0});
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 5: REG0 transactions after window traffic ===", $time);
+        axi_write(REG_CONTROL, {16'h0001, 8'h10, ADDR_EE, 1'b0});  // Pointer = 0x10
+        wait_idle(st);
+        axi_write(REG_CONTROL, {16'h0001, 8'h00, ADDR_EE, 1'b1});  // Current read
+        wait_idle(st);
+        axi_read(REG_RX_DATA, rd);
+        check(!st[2] && rd[7:0] == 8'hA5, $sformatf("REG0 read 0x%02h", rd[7:0]));
+
+        //----------------------------------------------------------------------
+        $display("\n========================================");
+        $display("Test Summary:");
+        $display("  PASSED: %0d", test_pass);
+        $display("  FAILED: %0d", test_fail);
+        $display("========================================");
+
+        if (test_fail == 0) begin
+            $display("✓ ALL TESTS PASSED!");
+        end else begin
+            $display("✗ SOME TESTS FAILED!");
+        end
+
+        $finish;
+    end
+
+    //==========================================================================
+    // Waveform
+    //==========================================================================
+    initial begin
+        $dumpfile("i2c_reg_window_tb.vcd");
+        $dumpvars(0, i2c_reg_window_tb);
+    end
+
+    //==========================================================================
+    // Timeout
+    //==========================================================================
+    initial begin
+        #20000000;
+        $display("\n✗ ERROR: Simulation timeout!");
+        $finish;
+    end
+
+endmodule
@@ -0,0 +1,350 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// I2C Master SDA Input Filter Testbench
+//==============================================================================
+// Two identical 400 kHz buses run the same transactions in lockstep:
+//   Bus A : i2c_master SDA_FILTER = 5 -> i2c_slave_top (0x55)
+//   Bus B : i2c_master SDA_FILTER = 1 -> i2c_slave_top (0x55)
+// Disturbances are forced on each master's raw SDA input only (sda_pin),
+// so the slaves and the bus itself are unaffected.
+// Checks:
+//   - Clean reads match on both buses
+//   - 2-clk low spikes every 7 clk: bus A reads correct data, bus B does not
+//   - Slow rising edge (SDA reads 0 for 40 clk after SCL rises):
+//     default sample point fails, sample_point = 55 reads correct data
+//==============================================================================
+
+module i2c_sda_filter_tb;
+
+    //==========================================================================
+    // Parameters
+    //==========================================================================
+    localparam CLK_PERIOD = 10;         // 100 MHz
+    localparam SCL_FREQ   = 400_000;
+
+    localparam [6:0] ADDR_REGMAP = 7'h55;
+
+    // slave_register_map registers
+    localparam [7:0] REG_SW_DATA = 8'h00;
+    localparam [7:0] REG_LED_LOW = 8'h01;
+
+    localparam SPIKE_PERIOD = 7;        // clk
+    localparam SPIKE_WIDTH  = 2;        // clk (filter of 5 rejects up to 2)
+    localparam SETTLE_CLKS  = 40;       // clk after SCL rise
+
+    //==========================================================================
+    // Signals
+    //==========================================================================
+    logic        clk;
+    logic        rst_n;
+    tri1         scl_a, scl_b;
+    tri1         sda_a, sda_b;
+
+    // Shared master control
+    logic        start;
+    logic        rw_bit;
+    logic [7:0]  byte_count;
+    logic [7:0]  sample_point_a;
+
+    // Per-bus master signals
+    logic [7:0]  tx_data_a, tx_data_b;
+    logic        tx_next_a, tx_next_b;
+    logic [7:0]  rx_data_a, rx_data_b;
+    logic        rx_valid_a, rx_valid_b;
+    logic        done_a, done_b;
+    logic        ack_error_a, ack_error_b;
+
+    // Slave I/O
+    logic [15:0] SW;
+    logic [15:0] LED_a, LED_b;
+
+    // TX byte source (advanced by tx_next) and RX sinks
+    logic [7:0]  tx_buf [16];
+    int          tx_idx_a, tx_idx_b;
+    logic [7:0]  rx_q_a [$];
+    logic [7:0]  rx_q_b [$];
+
+    // Disturbances
+    logic        spike_en;
+    logic        settle_en;
+    int          spike_cnt;
+    int          high_cnt;
+    logic        spike;
+    logic        settle;
+
+    int          test_pass;
+    int          test_fail;
+
+    assign tx_data_a = tx_buf[tx_idx_a];
+    assign tx_data_b = tx_buf[tx_idx_b];
+
+    always @(posedge clk) begin
+        if (tx_next_a)  tx_idx_a <= tx_idx_a + 1;
+        if (tx_next_b)  tx_idx_b <= tx_idx_b + 1;
+        if (rx_valid_a) rx_q_a.push_back(rx_data_a);
+        if (rx_valid_b) rx_q_b.push_back(rx_data_b);
+    end
+
+    // Spike train and slow-edge window, both clk-aligned
+    always @(posedge clk) begin
+        spike_cnt <= (spike_cnt == SPIKE_PERIOD - 1) ? 0 : spike_cnt + 1;
+        high_cnt  <= scl_a ? high_cnt + 1 : 0;
+    end
+
+    assign spike  = spike_en && (spike_cnt < SPIKE_WIDTH);
+    assign settle = settle_en && scl_a && (high_cnt < SETTLE_CLKS);
+
+    //==========================================================================
+    // DUTs
+    //==========================================================================
+    i2c_master #(
+        .SCL_FREQ(SCL_FREQ),
+        .SDA_FILTER(5)
+    ) master_a (
+        .clk(clk),
+        .rst_n(rst_n),
+        .start(start),
+        .rw_bit(rw_bit),
+        .slave_addr(ADDR_REGMAP),
+        .byte_count(byte_count),
+        .tx_data(tx_data_a),
+        .tx_next(tx_next_a),
+        .rx_data(rx_data_a),
+        .rx_valid(rx_valid_a),
+        .busy(),
+        .done(done_a),
+        .ack_error(ack_error_a),
+        .timeout(),
+        .pec_en(1'b0),
+        .pec_error(),
+        .sample_point(sample_point_a),
+        .scl_quarter(8'd0),
+        .addr_only(1'b0),
+        .hold(1'b0),
+        .abort(1'b0),
+        .sda(sda_a),
+        .scl(scl_a),
+        .debug_busy(),
+        .debug_ack(),
+        .debug_state(),
+        .debug_scl(),
+        .debug_sda_out(),
+        .debug_sda_oe()
+    );
+
+    i2c_master #(
+        .SCL_FREQ(SCL_FREQ),
+        .SDA_FILTER(1)
+    ) master_b (
+        .clk(clk),
+        .rst_n(rst_n),
+        .start(start),
+        .rw_bit(rw_bit),
+        .slave_addr(ADDR_REGMAP),
+        .byte_count(byte_count),
+        .tx_data(tx_data_b),
+        .tx_next(tx_next_b),
+        .rx_data(rx_data_b),
+        .rx_valid(rx_valid_b),
+        .busy(),
+        .done(done_b),
+        .ack_error(ack_error_b),
+        .timeout(),
+        .pec_en(1'b0),
+        .pec_error(),
+        .sample_point(8'd0),
+        .scl_quarter(8'd0),
+        .addr_only(1'b0),
+        .hold(1'b0),
+        .abort(1'b0),
+        .sda(sda_b),
+        .scl(scl_b),
+        .debug_busy(),
+        .debug_ack(),
+        .debug_state(),
+        .debug_scl(),
+        .debug_sda_out(),
+        .debug_sda_oe()
+    );
+
+    i2c_slave_top #(
+        .SLAVE_ADDR(ADDR_REGMAP)
+    ) slave_a (
+        .clk(clk), .rst_n(rst_n), .scl(scl_a), .sda(sda_a),
+        .SW(SW), .LED(LED_a), .SEG(), .AN(),
+        .debug_addr_match(), .debug_state()
+    );
+
+    i2c_slave_top #(
+        .SLAVE_ADDR(ADDR_REGMAP)
+    ) slave_b (
+        .clk(clk), .rst_n(rst_n), .scl(scl_b), .sda(sda_b),
+        .SW(SW), .LED(LED_b), .SEG(), .AN(),
+        .debug_addr_match(), .debug_state()
+    );
+
+    // Disturb what each master sees, not the bus
+    initial begin
+        force master_a.sda_pin = sda_a & ~spike & ~settle;
+        force master_b.sda_pin = sda_b & ~spike;
+    end
+
+    //==========================================================================
+    // Clock
+    //==========================================================================
+    initial begin
+        clk = 0;
+        forever #(CLK_PERIOD/2) clk = ~clk;
+    end
+
+    //==========================================================================
+    // Master Transaction Tasks (both buses)
+    //==========================================================================
+    task automatic i2c_transaction(input bit rw, input int n);
+        @(posedge clk);
+        tx_idx_a   = 0;
+        tx_idx_b   = 0;
+        rw_bit     = rw;
+        byte_count = n;
+        start      = 1;
+        @(posedge clk);
+        start      = 0;
+        fork
+            wait (done_a);
+            wait (done_b);
+        join
+        repeat(50) @(posedge clk);
+    endtask
+
+    // [reg][data...]
+    task automatic reg_write(input [7:0] reg_addr, input logic [7:0] data [$]);
+        tx_buf[0] = reg_addr;
+        foreach (data[i]) tx_buf[i+1] = data[i];
+        i2c_transaction(1'b0, data.size() + 1);
+    endtask
+
+    // Pointer write (undisturbed), then disturbed current-address read
+    task automatic reg_read(input [7:0] reg_addr, input int n,
+                            input bit spikes, input bit slow_edge);
+        tx_buf[0] = reg_addr;
+        i2c_transaction(1'b0, 1);
+        rx_q_a.delete();
+        rx_q_b.delete();
+        spike_en  = spikes;
+        settle_en = slow_edge;
+        i2c_transaction(1'b1, n);
+        spike_en  = 0;
+        settle_en = 0;
+    endtask
+
+    function automatic bit rx_ok(input logic [7:0] q [$], input logic [7:0] exp [$]);
+        return (q.size() == exp.size()) && (q == exp);
+    endfunction
+
+    task automatic check(input bit cond, input string msg);
+        if (cond) begin
+            $display("  ✓ %s", msg);
+            test_pass++;
+        end else begin
+            $display("  ✗ %s", msg);
+            test_fail++;
+        end
+    endtask
+
+    //==========================================================================
+    // Test Sequence
+    //==========================================================================
+    initial begin
+        logic [7:0] exp [$];
+
+        $display("========================================");
+        $display("I2C Master SDA Input Filter Test (400 kHz)");
+        $display("========================================");
+
+        test_pass      = 0;
+        test_fail      = 0;
+        rst_n          = 0;
+        start          = 0;
+        rw_bit         = 0;
+        byte_count     = 8'd1;
+        sample_point_a = 8'd0;
+        tx_idx_a       = 0;
+        tx_idx_b       = 0;
+        spike_en       = 0;
+        settle_en      = 0;
+        spike_cnt      = 0;
+        high_cnt       = 0;
+        SW             = 16'h00FF;
+
+        repeat(20) @(posedge clk);
+        rst_n = 1;
+        repeat(20) @(posedge clk);
+
+        // All-ones data so low-going disturbances show up
+        reg_write(REG_LED_LOW, '{8'hFF, 8'hFF});
+        exp = '{8'hFF, 8'hFF, 8'hFF};
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 1: Clean read at 400 kHz ===", $time);
+        reg_read(REG_SW_DATA, 3, 1'b0, 1'b0);
+        check(!ack_error_a && rx_ok(rx_q_a, exp), "Bus A (filter 5) reads FF FF FF");
+        check(!ack_error_b && rx_ok(rx_q_b, exp), "Bus B (no filter) reads FF FF FF");
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 2: %0d-clk spikes every %0d clk ===",
+                 $time, SPIKE_WIDTH, SPIKE_PERIOD);
+        reg_read(REG_SW_DATA, 3, 1'b1, 1'b0);
+        check(!ack_error_a && rx_ok(rx_q_a, exp), "Bus A: spikes rejected");
+        check(!rx_ok(rx_q_b, exp),
+              $sformatf("Bus B: corrupted (%02h %02h %02h)",
+                        rx_q_b[0], rx_q_b[1], rx_q_b[2]));
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 3: Slow rising edge, sample point ===", $time);
+        reg_read(REG_SW_DATA, 3, 1'b0, 1'b1);
+        check(!rx_ok(rx_q_a, exp),
+              $sformatf("Default sample point reads %02h %02h %02h",
+                        rx_q_a[0], rx_q_a[1], rx_q_a[2]));
+
+        sample_point_a = 8'd55;
+        reg_read(REG_SW_DATA, 3, 1'b0, 1'b1);
+        check(!ack_error_a && rx_ok(rx_q_a, exp), "sample_point = 55 reads FF FF FF");
+
+        reg_read(REG_SW_DATA, 3, 1'b1, 1'b1);
+        check(!ack_error_a && rx_ok(rx_q_a, exp), "Spikes + slow edge: filter + late sample");
+
+        //----------------------------------------------------------------------
+        $display("\n========================================");
+        $display("Test Summary:");
+        $display("  PASSED: %0d", test_pass);
+        $display("  FAILED: %0d", test_fail);
+        $display("========================================");
+
+        if (test_fail == 0) begin
+            $display("✓ ALL TESTS PASSED!");
+        end else begin
+            $display("✗ SOME TESTS FAILED!");
+        end
+
+        $finish;
+    end
+
+    //==========================================================================
+    // Waveform
+    //==========================================================================
+    initial begin
+        $dumpfile("i2c_sda_filter_tb.vcd");
+        $dumpvars(0, i2c_sda_filter_tb);
+    end
+
+    //==========================================================================
+    // Timeout
+    //==========================================================================
+    initial begin
+        #20000000;
+        $display("\n✗ ERROR: Simulation timeout!");
+        $finish;
+    end
+
+endmodule
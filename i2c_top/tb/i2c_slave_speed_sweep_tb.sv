@@ -0,0 +1,353 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// I2C Slave Bus-Speed Sweep Testbench
+//==============================================================================
+// Drives LED (0x55), FND (0x56) and Switch (0x57) slaves on one shared bus
+// at increasing SCL rates and reports the highest rate at which each slave
+// still decodes every transaction:
+//   - Standard  100 kHz
+//   - Fast      400 kHz
+//   - Fast+       1 MHz
+//   - Hs       ~1.7 MHz / ~3.4 MHz (master code 0x08 at 400 kHz, then Sr)
+//   - Hs       ~5 MHz (beyond spec, finds the ceiling)
+// Also checks that a 30 ns SCL spike is rejected by the 50 ns filter.
+//==============================================================================
+
+module i2c_slave_speed_sweep_tb;
+
+    //==========================================================================
+    // Parameters
+    //==========================================================================
+    localparam CLK_PERIOD = 10;         // 100 MHz
+    localparam NUM_SPEEDS = 6;
+    localparam FS_QUARTER = 62;         // 400 kHz quarter bit (master code)
+    localparam [7:0] HS_MASTER_CODE = 8'h08;
+
+    localparam [6:0] ADDR_LED = 7'h55;
+    localparam [6:0] ADDR_FND = 7'h56;
+    localparam [6:0] ADDR_SW  = 7'h57;
+
+    // Quarter-bit length (clk cycles), Hs flag and label per sweep point
+    int    quarter [NUM_SPEEDS] = '{250, 62, 25, 15, 7, 5};
+    bit    hs      [NUM_SPEEDS] = '{0,   0,  0,  1,  1, 1};
+    string label   [NUM_SPEEDS] = '{"100 kHz", "400 kHz", "1 MHz (Fm+)",
+                                    "1.7 MHz (Hs)", "3.4 MHz (Hs)", "5 MHz (Hs)"};
+
+    //==========================================================================
+    // Signals
+    //==========================================================================
+    logic       clk;
+    logic       rst_n;
+    logic       scl;
+    tri1        sda;
+    logic [7:0] LED;
+    logic [6:0] SEG;
+    logic [3:0] AN;
+    logic [7:0] SW;
+
+    logic       master_sda_oe;
+    logic       master_sda_out;
+
+    // Per-slave results: [0]=LED, [1]=FND, [2]=Switch
+    bit         speed_ok [3][NUM_SPEEDS];
+    int         best     [3];
+    int         test_pass;
+    int         test_fail;
+
+    assign sda = master_sda_oe ? master_sda_out : 1'bz;
+
+    //==========================================================================
+    // DUTs (shared bus)
+    //==========================================================================
+    i2c_led_slave led_slave (
+        .clk(clk), .rst_n(rst_n), .scl(scl), .sda(sda),
+        .LED(LED), .debug_addr_match(), .debug_state()
+    );
+
+    i2c_fnd_slave fnd_slave (
+        .clk(clk), .rst_n(rst_n), .scl(scl), .sda(sda),
+        .SEG(SEG), .AN(AN), .debug_addr_match(), .debug_state()
+    );
+
+    i2c_switch_slave switch_slave (
+        .clk(clk), .rst_n(rst_n), .scl(scl), .sda(sda),
+        .SW(SW), .debug_addr_match(), .debug_state()
+    );
+
+    //==========================================================================
+    // Clock
+    //==========================================================================
+    initial begin
+        clk = 0;
+        forever #(CLK_PERIOD/2) clk = ~clk;
+    end
+
+    //==========================================================================
+    // Bit-Level Master (quarter-bit timing, data changes mid SCL low)
+    //==========================================================================
+    task automatic wait_q(input int q);
+        repeat(q) @(posedge clk);
+    endtask
+
+    task automatic bus_start(input int q);
+        if (scl == 1'b0) begin
+            wait_q(q);
+            master_sda_oe  = 1;
+            master_sda_out = 1;
+            wait_q(q);
+            scl = 1;
+            wait_q(2*q);
+        end
+        master_sda_oe  = 1;
+        master_sda_out = 0;
+        wait_q(2*q);
+        scl = 0;
+    endtask
+
+    task automatic bus_stop(input int q);
+        wait_q(q);
+        master_sda_oe  = 1;
+        master_sda_out = 0;
+        wait_q(q);
+        scl = 1;
+        wait_q(2*q);
+        master_sda_out = 1;
+        wait_q(2*q);
+        master_sda_oe  = 0;
+    endtask
+
+    task automatic send_bit(input bit value, input int q);
+        wait_q(q);
+        master_sda_oe  = 1;
+        master_sda_out = value;
+        wait_q(q);
+        scl = 1;
+        wait_q(2*q);
+        scl = 0;
+    endtask
+
+    task automatic recv_bit(output bit value, input int q);
+        wait_q(q);
+        master_sda_oe = 0;
+        wait_q(q);
+        scl = 1;
+        wait_q(q);
+        value = sda;
+        wait_q(q);
+        scl = 0;
+    endtask
+
+    task automatic send_byte(input [7:0] data, input int q, output bit ack);
+        bit b;
+        for (int i = 7; i >= 0; i--) send_bit(data[i], q);
+        recv_bit(b, q);
+        ack = ~b;
+    endtask
+
+    task automatic recv_byte(output [7:0] data, input int q);
+        bit b;
+        for (int i = 7; i >= 0; i--) begin
+            recv_bit(b, q);
+            data[i] = b;
+        end
+        send_bit(1'b1, q);  // NACK (single byte)
+    endtask
+
+    // START (+ Hs-mode entry) and address byte
+    task automatic begin_transfer(input [7:0] addr_rw, input int q, input bit hs_en,
+                                  output bit ack);
+        bit mc_ack;
+        if (hs_en) begin
+            bus_start(FS_QUARTER);
+            send_byte(HS_MASTER_CODE, FS_QUARTER, mc_ack);
+            if (mc_ack) $display("  ✗ Master code was ACKed");
+        end
+        bus_start(q);   // START or Sr (Hs)
+        send_byte(addr_rw, q, ack);
+    endtask
+
+    task automatic write_byte(input [6:0] addr, input [7:0] data, input int q,
+                              input bit hs_en, output bit ok);
+        bit ack_a, ack_d;
+        begin_transfer({addr, 1'b0}, q, hs_en, ack_a);
+        send_byte(data, q, ack_d);
+        bus_stop(q);
+        ok = ack_a & ack_d;
+    endtask
+
+    task automatic read_byte(input [6:0] addr, input int q, input bit hs_en,
+                             output [7:0] data, output bit ok);
+        bit ack_a;
+        begin_transfer({addr, 1'b1}, q, hs_en, ack_a);
+        recv_byte(data, q);
+        bus_stop(q);
+        ok = ack_a;
+    endtask
+
+    //==========================================================================
+    // Expected 7-segment pattern (common anode, active low)
+    //==========================================================================
+    function automatic [6:0] seg_of(input [3:0] d);
+        case (d)
+            4'h0: seg_of = 7'b1000000;  4'h1: seg_of = 7'b1111001;
+            4'h2: seg_of = 7'b0100100;  4'h3: seg_of = 7'b0110000;
+            4'h4: seg_of = 7'b0011001;  4'h5: seg_of = 7'b0010010;
+            4'h6: seg_of = 7'b0000010;  4'h7: seg_of = 7'b1111000;
+            4'h8: seg_of = 7'b0000000;  4'h9: seg_of = 7'b0010000;
+            4'hA: seg_of = 7'b0001000;  4'hB: seg_of = 7'b0000011;
+            4'hC: seg_of = 7'b1000110;  4'hD: seg_of = 7'b0100001;
+            4'hE: seg_of = 7'b0000110;  4'hF: seg_of = 7'b0001110;
+        endcase
+    endfunction
+
+    //==========================================================================
+    // One Sweep Point
+    //==========================================================================
+    task automatic run_speed(input int s);
+        logic [7:0] patterns [4] = '{8'hA5, 8'h3C, 8'hFF, 8'h01};
+        logic [7:0] rd;
+        bit ok;
+        int q = quarter[s];
+
+        speed_ok[0][s] = 1;
+        speed_ok[1][s] = 1;
+        speed_ok[2][s] = 1;
+
+        foreach (patterns[i]) begin
+            // LED
+            write_byte(ADDR_LED, patterns[i], q, hs[s], ok);
+            repeat(20) @(posedge clk);
+            if (!ok || LED !== patterns[i]) speed_ok[0][s] = 0;
+
+            // FND
+            write_byte(ADDR_FND, patterns[i], q, hs[s], ok);
+            repeat(20) @(posedge clk);
+            if (!ok || SEG !== seg_of(patterns[i][3:0])) speed_ok[1][s] = 0;
+
+            // Switch
+            SW = ~patterns[i];
+            repeat(20) @(posedge clk);
+            read_byte(ADDR_SW, q, hs[s], rd, ok);
+            if (!ok || rd !== ~patterns[i]) speed_ok[2][s] = 0;
+
+            repeat(20) @(posedge clk);
+        end
+
+        $display("  %-14s  LED:%s  FND:%s  SW:%s", label[s],
+                 speed_ok[0][s] ? "PASS" : "FAIL",
+                 speed_ok[1][s] ? "PASS" : "FAIL",
+                 speed_ok[2][s] ? "PASS" : "FAIL");
+    endtask
+
+    //==========================================================================
+    // Spike Rejection: 30 ns SCL pulse inside a 400 kHz LED write
+    //==========================================================================
+    task automatic spike_test();
+        bit ack_a, ack_d, b;
+        int q = FS_QUARTER;
+        begin_transfer({ADDR_LED, 1'b0}, q, 1'b0, ack_a);
+        // First data bit with a 3-cycle SCL glitch in the low phase
+        wait_q(q);
+        master_sda_oe  = 1;
+        master_sda_out = 1'b0;
+        scl = 1; repeat(3) @(posedge clk); scl = 0;
+        wait_q(q);
+        scl = 1; wait_q(2*q); scl = 0;
+        // Remaining 7 bits of 0x5A
+        for (int i = 6; i >= 0; i--) send_bit(8'h5A >> i, q);
+        recv_bit(b, q);
+        ack_d = ~b;
+        bus_stop(q);
+        repeat(20) @(posedge clk);
+
+        if (ack_a && ack_d && LED == 8'h5A) begin
+            $display("  ✓ 30 ns SCL spike rejected (LED = 0x5A)");
+            test_pass++;
+        end else begin
+            $display("  ✗ SCL spike corrupted transfer (LED = 0x%02h)", LED);
+            test_fail++;
+        end
+    endtask
+
+    //==========================================================================
+    // Test Sequence
+    //==========================================================================
+    initial begin
+        $display("========================================");
+        $display("I2C Slave Bus-Speed Sweep");
+        $display("========================================");
+
+        test_pass = 0;
+        test_fail = 0;
+
+        rst_n = 0;
+        scl = 1;
+        SW = 8'h00;
+        master_sda_oe = 0;
+        master_sda_out = 1;
+
+        repeat(20) @(posedge clk);
+        rst_n = 1;
+        repeat(20) @(posedge clk);
+
+        $display("\n=== Spike Filter ===");
+        spike_test();
+
+        $display("\n=== Speed Sweep ===");
+        for (int s = 0; s < NUM_SPEEDS; s++) begin
+            run_speed(s);
+        end
+
+        // Highest speed with every lower speed also passing
+        $display("\n=== Highest Reliable Speed ===");
+        foreach (best[d]) begin
+            best[d] = -1;
+            for (int s = 0; s < NUM_SPEEDS; s++) begin
+                if (!speed_ok[d][s]) break;
+                best[d] = s;
+            end
+        end
+        $display("  LED Slave    (0x55): %s", (best[0] >= 0) ? label[best[0]] : "none");
+        $display("  FND Slave    (0x56): %s", (best[1] >= 0) ? label[best[1]] : "none");
+        $display("  Switch Slave (0x57): %s", (best[2] >= 0) ? label[best[2]] : "none");
+
+        // Requirement: every slave up to 3.4 MHz Hs-mode (index 4)
+        foreach (best[d]) begin
+            if (best[d] >= 4) test_pass++;
+            else              test_fail++;
+        end
+
+        $display("\n========================================");
+        $display("Test Summary:");
+        $display("  PASSED: %0d", test_pass);
+        $display("  FAILED: %0d", test_fail);
+        $display("========================================");
+
+        if (test_fail == 0) begin
+            $display("✓ ALL TESTS PASSED!");
+        end else begin
+            $display("✗ SOME TESTS FAILED!");
+        end
+
+        $finish;
+    end
+
+    //==========================================================================
+    // Waveform
+    //==========================================================================
+    initial begin
+        $dumpfile("i2c_slave_speed_sweep_tb.vcd");
+        $dumpvars(0, i2c_slave_speed_sweep_tb);
+    end
+
+    //==========================================================================
+    // Timeout
+    //==========================================================================
+    initial begin
+        #50000000;
+        $display("\n✗ ERROR: Simulation timeout!");
+        $finish;
+    end
+
+endmodule
@@ -0,0 +1,320 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// I2C Per-Address Speed Table Testbench
+//==============================================================================
+// AXI4-Lite -> i2c_master_v1_0 -> i2c_eeprom_slave (0x50) + i2c_switch_slave (0x57)
+// Checks:
+//   - Default entry: both slaves run at I2C_SCL_FREQ (100 kHz)
+//   - REG12 entry 0x50 = 25 (1 MHz): EEPROM transactions at 1 MHz while
+//     the switch slave stays at 100 kHz, back to back
+//   - Entry read-back after a select-only (byte 1) write
+//   - Clearing the entry restores the default speed
+// SCL period = shortest rising-to-rising edge time within each transaction
+//==============================================================================
+
+module i2c_speed_table_tb;
+
+    //==========================================================================
+    // Parameters
+    //==========================================================================
+    localparam CLK_PERIOD = 10;         // 100 MHz
+
+    localparam [6:0] ADDR_EE = 7'h50;
+    localparam [6:0] ADDR_SW = 7'h57;
+
+    // AXI register offsets (i2c_regs.h)
+    localparam [6:0] REG_CONTROL = 7'h00;
+    localparam [6:0] REG_STATUS  = 7'h04;
+    localparam [6:0] REG_RX_DATA = 7'h08;
+    localparam [6:0] REG_SPEED   = 7'h30;
+
+    //==========================================================================
+    // Signals
+    //==========================================================================
+    logic        clk;
+    logic        rst_n;
+    tri1         scl;
+    tri1         sda;
+
+    // AXI4-Lite
+    logic [6:0]  awaddr;
+    logic        awvalid;
+    wire         awready;
+    logic [31:0] wdata;
+    logic [3:0]  wstrb;
+    logic        wvalid;
+    wire         wready;
+    wire  [1:0]  bresp;
+    wire         bvalid;
+    logic        bready;
+    logic [6:0]  araddr;
+    logic        arvalid;
+    wire         arready;
+    wire  [31:0] rdata;
+    wire  [1:0]  rresp;
+    wire         rvalid;
+    logic        rready;
+
+    logic [7:0]  SW;
+
+    // SCL period measurement
+    time         scl_rise;
+    time         scl_period;
+
+    int          test_pass;
+    int          test_fail;
+
+    always @(posedge scl) begin
+        if (scl_rise != 0 && $time - scl_rise < scl_period) begin
+            scl_period = $time - scl_rise;
+        end
+        scl_rise = $time;
+    end
+
+    //==========================================================================
+    // DUTs
+    //==========================================================================
+    i2c_master_v1_0 #(
+        .I2C_SCL_FREQ(100_000)
+    ) dut (
+        .sda(sda),
+        .scl(scl),
+        .spi_sck(),
+        .spi_mosi(),
+        .spi_miso(1'b0),
+        .spi_cs_n(),
+        .i2c_clk(clk),
+        .i2c_aresetn(rst_n),
+        .s00_axi_aclk(clk),
+        .s00_axi_aresetn(rst_n),
+        .s00_axi_awaddr(awaddr),
+        .s00_axi_awprot(3'b000),
+        .s00_axi_awvalid(awvalid),
+        .s00_axi_awready(awready),
+        .s00_axi_wdata(wdata),
+        .s00_axi_wstrb(wstrb),
+        .s00_axi_wvalid(wvalid),
+        .s00_axi_wready(wready),
+        .s00_axi_bresp(bresp),
+        .s00_axi_bvalid(bvalid),
+        .s00_axi_bready(bready),
+        .s00_axi_araddr(araddr),
+        .s00_axi_arprot(3'b000),
+        .s00_axi_arvalid(arvalid),
+        .s00_axi_arready(arready),
+        .s00_axi_rdata(rdata),
+        .s00_axi_rresp(rresp),
+        .s00_axi_rvalid(rvalid),
+        .s00_axi_rready(rready),
+        .s01_axi_aclk(clk),
+        .s01_axi_aresetn(rst_n),
+        .s01_axi_awaddr(17'd0),
+        .s01_axi_awprot(3'b000),
+        .s01_axi_awvalid(1'b0),
+        .s01_axi_awready(),
+        .s01_axi_wdata(32'd0),
+        .s01_axi_wstrb(4'h0),
+        .s01_axi_wvalid(1'b0),
+        .s01_axi_wready(),
+        .s01_axi_bresp(),
+        .s01_axi_bvalid(),
+        .s01_axi_bready(1'b0),
+        .s01_axi_araddr(17'd0),
+        .s01_axi_arprot(3'b000),
+        .s01_axi_arvalid(1'b0),
+        .s01_axi_arready(),
+        .s01_axi_rdata(),
+        .s01_axi_rresp(),
+        .s01_axi_rvalid(),
+        .s01_axi_rready(1'b0)
+    );
+
+    i2c_eeprom_slave #(
+        .SLAVE_ADDR(ADDR_EE)
+    ) eeprom (
+        .clk(clk), .rst_n(rst_n), .scl(scl), .sda(sda),
+        .write_busy(), .debug_addr_match(), .debug_state()
+    );
+
+    i2c_switch_slave switch_slave (
+        .clk(clk), .rst_n(rst_n), .scl(scl), .sda(sda),
+        .SW(SW), .debug_addr_match(), .debug_state()
+    );
+
+    //==========================================================================
+    // Clock
+    //==========================================================================
+    initial begin
+        clk = 0;
+        forever #(CLK_PERIOD/2) clk = ~clk;
+    end
+
+    //==========================================================================
+    // AXI4-Lite Tasks
+    //==========================================================================
+    task automatic axi_write(input [6:0] addr, input [31:0] data, input [3:0] strb = 4'hF);
+        @(posedge clk);
+        awaddr  <= addr;
+        awvalid <= 1;
+        wdata   <= data;
+        wstrb   <= strb;
+        wvalid  <= 1;
+        bready  <= 1;
+        @(posedge clk iff (awready && wready));
+        awvalid <= 0;
+        wvalid  <= 0;
+        @(posedge clk iff bvalid);
+        bready  <= 0;
+    endtask
+
+    task automatic axi_read(input [6:0] addr, output [31:0] data);
+        @(posedge clk);
+        araddr  <= addr;
+        arvalid <= 1;
+        rready  <= 1;
+        @(posedge clk iff arready);
+        arvalid <= 0;
+        @(posedge clk iff rvalid);
+        data    = rdata;
+        rready  <= 0;
+    endtask
+
+    // Write CONTROL, poll STATUS.busy
+    task automatic i2c_xfer(input [6:0] addr, input bit rw, input [7:0] data,
+                            output bit nack);
+        logic [31:0] st;
+        scl_rise   = 0;
+        scl_period = '1;
+        axi_write(REG_CONTROL, {16'h0001, data, addr, rw});
+        repeat(5) @(posedge clk);
+        do axi_read(REG_STATUS, st); while (st[0]);
+        nack = st[2];
+    endtask
+
+    // Within 5% of the nominal SCL period
+    function automatic bit near(input time t, input time nominal);
+        return (t * 100 >= nominal * 95) && (t * 100 <= nominal * 105);
+    endfunction
+
+    task automatic check(input bit cond, input string msg);
+        if (cond) begin
+            $display("  ✓ %s", msg);
+            test_pass++;
+        end else begin
+            $display("  ✗ %s", msg);
+            test_fail++;
+        end
+    endtask
+
+    //==========================================================================
+    // Test Sequence
+    //==========================================================================
+    initial begin
+        logic [31:0] rd;
+        bit          nack;
+        time         t_ee, t_sw;
+
+        $display("========================================");
+        $display("I2C Per-Address Speed Table Test");
+        $display("========================================");
+
+        test_pass  = 0;
+        test_fail  = 0;
+        rst_n      = 0;
+        awaddr     = 0;
+        awvalid    = 0;
+        wdata      = 0;
+        wstrb      = 0;
+        wvalid     = 0;
+        bready     = 0;
+        araddr     = 0;
+        arvalid    = 0;
+        rready     = 0;
+        scl_rise   = 0;
+        scl_period = '1;
+        SW         = 8'h3C;
+
+        repeat(20) @(posedge clk);
+        rst_n = 1;
+        repeat(20) @(posedge clk);
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 1: Default speed for every address ===", $time);
+        i2c_xfer(ADDR_EE, 1'b0, 8'h10, nack);   // EEPROM pointer = 0x10
+        t_ee = scl_period;
+        i2c_xfer(ADDR_SW, 1'b1, 8'h00, nack);
+        t_sw = scl_period;
+        check(!nack && near(t_ee, 10000) && near(t_sw, 10000),
+              $sformatf("0x50: %0t ns, 0x57: %0t ns", t_ee, t_sw));
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 2: 0x50 at 1 MHz, 0x57 at 100 kHz ===", $time);
+        axi_write(REG_SPEED, {17'h0, ADDR_EE, 8'd25});
+
+        i2c_xfer(ADDR_EE, 1'b1, 8'h00, nack);
+        t_ee = scl_period;
+        check(!nack && near(t_ee, 1000), $sformatf("EEPROM read at %0t ns SCL", t_ee));
+
+        i2c_xfer(ADDR_SW, 1'b1, 8'h00, nack);
+        t_sw = scl_period;
+        axi_read(REG_RX_DATA, rd);
+        check(!nack && near(t_sw, 10000) && rd[7:0] == 8'h3C,
+              $sformatf("Switch read 0x%02h at %0t ns SCL", rd[7:0], t_sw));
+
+        i2c_xfer(ADDR_EE, 1'b0, 8'h20, nack);
+        t_ee = scl_period;
+        check(!nack && near(t_ee, 1000), $sformatf("EEPROM write at %0t ns SCL", t_ee));
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 3: Entry read-back ===", $time);
+        axi_write(REG_SPEED, {17'h0, ADDR_SW, 8'h00}, 4'b0010);  // select only
+        axi_read(REG_SPEED, rd);
+        check(rd[14:8] == ADDR_SW && rd[7:0] == 8'd0,
+              $sformatf("0x57 entry = %0d", rd[7:0]));
+        axi_write(REG_SPEED, {17'h0, ADDR_EE, 8'h00}, 4'b0010);
+        axi_read(REG_SPEED, rd);
+        check(rd[14:8] == ADDR_EE && rd[7:0] == 8'd25,
+              $sformatf("0x50 entry = %0d", rd[7:0]));
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 4: Clear entry ===", $time);
+        axi_write(REG_SPEED, {17'h0, ADDR_EE, 8'd0});
+        i2c_xfer(ADDR_EE, 1'b1, 8'h00, nack);
+        t_ee = scl_period;
+        check(!nack && near(t_ee, 10000), $sformatf("EEPROM back to %0t ns SCL", t_ee));
+
+        //----------------------------------------------------------------------
+        $display("\n========================================");
+        $display("Test Summary:");
+        $display("  PASSED: %0d", test_pass);
+        $display("  FAILED: %0d", test_fail);
+        $display("========================================");
+
+        if (test_fail == 0) begin
+            $display("✓ ALL TESTS PASSED!");
+        end else begin
+            $display("✗ SOME TESTS FAILED!");
+        end
+
+        $finish;
+    end
+
+    //==========================================================================
+    // Waveform
+    //==========================================================================
+    initial begin
+        $dumpfile("i2c_speed_table_tb.vcd");
+        $dumpvars(0, i2c_speed_table_tb);
+    end
+
+    //==========================================================================
+    // Timeout
+    //==========================================================================
+    initial begin
+        #20000000;
+        $display("\n✗ ERROR: Simulation timeout!");
+        $finish;
+    end
+
+endmodule
@@ -0,0 +1,348 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// I2C CONTROL Hold (Repeated START) Testbench
+//==============================================================================
+// AXI4-Lite S00 -> i2c_master_v1_0 (400 kHz)
+//   -> i2c_eeprom_slave (0x50), i2c_led_slave (0x55), nothing at 0x51
+// Checks:
+//   - REG0[26] write ends without STOP, STATUS[24] held, the next REG0
+//     read starts with Sr: 2 STARTs, 1 STOP for pointer write + read
+//   - A command port waits while REG0 holds the bus, runs after the STOP
+//   - REG1 write [0] = 1 releases a held bus with a STOP
+//   - NACK under hold ends with STOP, nothing stays held
+//==============================================================================
+
+module i2c_transfer_tb;
+
+    //==========================================================================
+    // Parameters
+    //==========================================================================
+    localparam CLK_PERIOD = 10;         // 100 MHz
+
+    localparam [6:0] ADDR_EE     = 7'h50;
+    localparam [6:0] ADDR_ABSENT = 7'h51;
+    localparam [6:0] ADDR_LED    = 7'h55;
+
+    // AXI register offsets (i2c_regs.h)
+    localparam [6:0] REG_CONTROL = 7'h00;
+    localparam [6:0] REG_STATUS  = 7'h04;
+    localparam [6:0] REG_TX_FIFO = 7'h0C;
+    localparam [6:0] REG_RX_FIFO = 7'h10;
+    localparam [6:0] REG_PORT0   = 7'h48;
+
+    localparam [31:0] CTRL_HOLD  = 32'h0400_0000;
+
+    //==========================================================================
+    // Signals
+    //==========================================================================
+    logic        clk;
+    logic        rst_n;
+    tri1         scl;
+    tri1         sda;
+
+    // AXI4-Lite S00
+    logic [6:0]  awaddr;
+    logic        awvalid;
+    wire         awready;
+    logic [31:0] wdata;
+    logic [3:0]  wstrb;
+    logic        wvalid;
+    wire         wready;
+    wire  [1:0]  bresp;
+    wire         bvalid;
+    logic        bready;
+    logic [6:0]  araddr;
+    logic        arvalid;
+    wire         arready;
+    wire  [31:0] rdata;
+    wire  [1:0]  rresp;
+    wire         rvalid;
+    logic        rready;
+
+    // AXI4-Lite S01 (window, idle)
+    wire         w_awready;
+    wire         w_wready;
+    wire  [1:0]  w_bresp;
+    wire         w_bvalid;
+    wire         w_arready;
+    wire  [31:0] w_rdata;
+    wire  [1:0]  w_rresp;
+    wire         w_rvalid;
+    logic [16:0] w_awaddr  = '0;
+    logic        w_awvalid = 1'b0;
+    logic [31:0] w_wdata   = '0;
+    logic [3:0]  w_wstrb   = '0;
+    logic        w_wvalid  = 1'b0;
+    logic        w_bready  = 1'b0;
+    logic [16:0] w_araddr  = '0;
+    logic        w_arvalid = 1'b0;
+    logic        w_rready  = 1'b0;
+
+    // Slave I/O
+    logic [7:0]  LED;
+
+    // Bus conditions
+    int          starts;
+    int          stops;
+
+    int          test_pass;
+    int          test_fail;
+
+    always @(negedge sda) if (scl === 1'b1) starts++;
+    always @(posedge sda) if (scl === 1'b1) stops++;
+
+    //==========================================================================
+    // DUTs
+    //==========================================================================
+    i2c_master_v1_0 #(
+        .I2C_SCL_FREQ(400_000)
+    ) dut (
+        .sda(sda),
+        .scl(scl),
+        .spi_sck(),
+        .spi_mosi(),
+        .spi_miso(1'b0),
+        .spi_cs_n(),
+        .i2c_clk(clk),
+        .i2c_aresetn(rst_n),
+        .s00_axi_aclk(clk),
+        .s00_axi_aresetn(rst_n),
+        .s00_axi_awaddr(awaddr),
+        .s00_axi_awprot(3'b000),
+        .s00_axi_awvalid(awvalid),
+        .s00_axi_awready(awready),
+        .s00_axi_wdata(wdata),
+        .s00_axi_wstrb(wstrb),
+        .s00_axi_wvalid(wvalid),
+        .s00_axi_wready(wready),
+        .s00_axi_bresp(bresp),
+        .s00_axi_bvalid(bvalid),
+        .s00_axi_bready(bready),
+        .s00_axi_araddr(araddr),
+        .s00_axi_arprot(3'b000),
+        .s00_axi_arvalid(arvalid),
+        .s00_axi_arready(arready),
+        .s00_axi_rdata(rdata),
+        .s00_axi_rresp(rresp),
+        .s00_axi_rvalid(rvalid),
+        .s00_axi_rready(rready),
+        .s01_axi_aclk(clk),
+        .s01_axi_aresetn(rst_n),
+        .s01_axi_awaddr(w_awaddr),
+        .s01_axi_awprot(3'b000),
+        .s01_axi_awvalid(w_awvalid),
+        .s01_axi_awready(w_awready),
+        .s01_axi_wdata(w_wdata),
+        .s01_axi_wstrb(w_wstrb),
+        .s01_axi_wvalid(w_wvalid),
+        .s01_axi_wready(w_wready),
+        .s01_axi_bresp(w_bresp),
+        .s01_axi_bvalid(w_bvalid),
+        .s01_axi_bready(w_bready),
+        .s01_axi_araddr(w_araddr),
+        .s01_axi_arprot(3'b000),
+        .s01_axi_arvalid(w_arvalid),
+        .s01_axi_arready(w_arready),
+        .s01_axi_rdata(w_rdata),
+        .s01_axi_rresp(w_rresp),
+        .s01_axi_rvalid(w_rvalid),
+        .s01_axi_rready(w_rready)
+    );
+
+    i2c_eeprom_slave #(
+        .SLAVE_ADDR(ADDR_EE)
+    ) eeprom (
+        .clk(clk), .rst_n(rst_n), .scl(scl), .sda(sda),
+        .write_busy(), .debug_addr_match(), .debug_state()
+    );
+
+    i2c_led_slave led_slave (
+        .clk(clk), .rst_n(rst_n), .scl(scl), .sda(sda),
+        .LED(LED), .debug_addr_match(), .debug_state()
+    );
+
+    //==========================================================================
+    // Clock Generation
+    //==========================================================================
+    initial begin
+        clk = 0;
+        forever #(CLK_PERIOD/2) clk = ~clk;
+    end
+
+    //==========================================================================
+    // AXI4-Lite Tasks
+    //==========================================================================
+    task automatic axi_write(input [6:0] addr, input [31:0] data, input [3:0] strb = 4'hF);
+        @(posedge clk);
+        awaddr  <= addr;
+        awvalid <= 1;
+        wdata   <= data;
+        wstrb   <= strb;
+        wvalid  <= 1;
+        bready  <= 1;
+        @(posedge clk iff (awready && wready));
+        awvalid <= 0;
+        wvalid  <= 0;
+        @(posedge clk iff bvalid);
+        bready  <= 0;
+    endtask
+
+    task automatic axi_read(input [6:0] addr, output [31:0] data);
+        @(posedge clk);
+        araddr  <= addr;
+        arvalid <= 1;
+        rready  <= 1;
+        @(posedge clk iff arready);
+        arvalid <= 0;
+        @(posedge clk iff rvalid);
+        data    = rdata;
+        rready  <= 0;
+    endtask
+
+    // Poll STATUS.busy (REG0 transaction); a held bus keeps STATUS[7]
+    task automatic wait_done(output logic [31:0] st);
+        repeat(5) @(posedge clk);
+        do axi_read(REG_STATUS, st); while (st[0]);
+    endtask
+
+    // Poll until nobody uses the bus
+    task automatic wait_idle(output logic [31:0] st);
+        repeat(5) @(posedge clk);
+        do axi_read(REG_STATUS, st); while (st[0] || st[7]);
+    endtask
+
+    task automatic check(input bit cond, input string msg);
+        if (cond) begin
+            $display("  ✓ %s", msg);
+            test_pass++;
+        end else begin
+            $display("  ✗ %s", msg);
+            test_fail++;
+        end
+    endtask
+
+    //==========================================================================
+    // Test Sequence
+    //==========================================================================
+    initial begin
+        logic [31:0] rd, st, ps;
+        logic [7:0]  b0, b1;
+
+        $display("========================================");
+        $display("I2C CONTROL Hold (Repeated START) Test");
+        $display("========================================");
+
+        test_pass = 0;
+        test_fail = 0;
+        starts    = 0;
+        stops     = 0;
+        rst_n     = 0;
+        awaddr    = 0;
+        awvalid   = 0;
+        wdata     = 0;
+        wstrb     = 0;
+        wvalid    = 0;
+        bready    = 0;
+        araddr    = 0;
+        arvalid   = 0;
+        rready    = 0;
+
+        #200;
+        rst_n = 1;
+        #200;
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 1: Pointer write, Sr, read ===", $time);
+        axi_write(REG_TX_FIFO, 32'h11);
+        axi_write(REG_TX_FIFO, 32'h22);
+        axi_write(REG_CONTROL, {16'h0003, 8'h20, ADDR_EE, 1'b0});   // [0x20] 11 22
+        wait_idle(st);
+
+        starts = 0;
+        stops  = 0;
+        axi_write(REG_CONTROL, CTRL_HOLD | {16'h0001, 8'h20, ADDR_EE, 1'b0});
+        wait_done(st);
+        check(st[24] && st[7] && !st[2], $sformatf("Held after pointer write (STATUS 0x%08h)", st));
+        check(stops == 0, "No STOP after the hold transaction");
+
+        axi_write(REG_CONTROL, {16'h0002, 8'h00, ADDR_EE, 1'b1});   // Sr read 2
+        wait_idle(st);
+        axi_read(REG_RX_FIFO, rd);
+        b0 = rd[7:0];
+        axi_read(REG_RX_FIFO, rd);
+        b1 = rd[7:0];
+        check(b0 == 8'h11 && b1 == 8'h22, $sformatf("Read back %02h %02h", b0, b1));
+        check(starts == 2 && stops == 1, $sformatf("%0d STARTs, %0d STOP", starts, stops));
+        check(!st[24], "Not held after the last message");
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 2: Held bus keeps other requesters out ===", $time);
+        axi_write(REG_CONTROL, CTRL_HOLD | {16'h0001, 8'h21, ADDR_EE, 1'b0});
+        wait_done(st);
+        axi_write(REG_PORT0, {24'h0, ADDR_LED, 1'b0} | 32'h003C_0000);  // LED = 0x3C
+        #200000;
+        axi_read(REG_PORT0, ps);
+        check(ps[31] && !ps[30] && LED != 8'h3C, "Port 0 waits while CONTROL holds the bus");
+
+        axi_write(REG_CONTROL, {16'h0001, 8'h00, ADDR_EE, 1'b1});   // Sr read 1
+        wait_done(st);
+        axi_read(REG_RX_FIFO, rd);
+        check(rd[7:0] == 8'h22, $sformatf("Sr read 0x%02h", rd[7:0]));
+        do axi_read(REG_PORT0, ps); while (ps[31]);
+        check(ps[9] && !ps[8] && LED == 8'h3C, "Port 0 runs after the STOP");
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 3: Release a held bus ===", $time);
+        wait_idle(st);
+        stops = 0;
+        axi_write(REG_CONTROL, CTRL_HOLD | {16'h0001, 8'h5A, ADDR_LED, 1'b0});
+        wait_done(st);
+        check(st[24] && LED == 8'h5A && stops == 0, "LED written, bus held");
+        axi_write(REG_STATUS, 32'h1);
+        wait_idle(st);
+        check(!st[24] && stops == 1, $sformatf("Released with %0d STOP", stops));
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 4: NACK under hold ===", $time);
+        stops = 0;
+        axi_write(REG_CONTROL, CTRL_HOLD | {16'h0001, 8'h00, ADDR_ABSENT, 1'b0});
+        wait_done(st);
+        check(st[2] && !st[24], "ack_error, not held");
+        wait_idle(st);
+        check(stops == 1, "NACK ended with STOP");
+
+        //----------------------------------------------------------------------
+        $display("\n========================================");
+        $display("Test Summary:");
+        $display("  PASSED: %0d", test_pass);
+        $display("  FAILED: %0d", test_fail);
+        $display("========================================");
+
+        if (test_fail == 0) begin
+            $display("✓ ALL TESTS PASSED!");
+        end else begin
+            $display("✗ SOME TESTS FAILED!");
+        end
+
+        $finish;
+    end
+
+    //==========================================================================
+    // Waveform
+    //==========================================================================
+    initial begin
+        $dumpfile("i2c_transfer_tb.vcd");
+        $dumpvars(0, i2c_transfer_tb);
+    end
+
+    //==========================================================================
+    // Timeout
+    //==========================================================================
+    initial begin
+        #20000000;
+        $display("\n✗ ERROR: Simulation timeout!");
+        $finish;
+    end
+
+endmodule
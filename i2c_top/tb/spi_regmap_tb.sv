@@ -0,0 +1,281 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// SPI Register-Map Transport Testbench
+//==============================================================================
+// spi_master (AXI IP transport) -> spi_slave_top (slave_register_mapped)
+// Checks:
+//   - Burst write LED_LOW, LED_HIGH, FND_DATA in one frame
+//   - Outputs change once, when CS_N rises (same commit as I2C STOP)
+//   - Burst read SW_DATA..FND_DATA with auto-increment
+//   - Atomic CLR / TOGGLE aliases over SPI
+// Reports frame time and payload rate at 10 MHz / 12.5 MHz SCK
+//==============================================================================
+
+module spi_regmap_tb;
+
+    //==========================================================================
+    // Parameters
+    //==========================================================================
+    localparam CLK_PERIOD = 10;         // 100 MHz
+    localparam NUM_SPEEDS = 2;
+    localparam BURST_LEN  = 16;         // AXI FIFO depth
+
+    // Register map (slave_register_map.sv)
+    localparam [7:0] REG_SW_DATA    = 8'h00;
+    localparam [7:0] REG_LED_LOW    = 8'h01;
+    localparam [7:0] REG_FND_DATA   = 8'h03;
+    localparam [7:0] REG_LED_LO_CLR = 8'h21;
+    localparam [7:0] REG_FND_TOGGLE = 8'h33;
+
+    // SCK half period (clk cycles) and label per speed
+    int    div   [NUM_SPEEDS] = '{5, 4};
+    string label [NUM_SPEEDS] = '{"10 MHz", "12.5 MHz"};
+
+    //==========================================================================
+    // Signals
+    //==========================================================================
+    logic        clk;
+    logic        rst_n;
+
+    // Master control
+    logic        start;
+    logic        rw_bit;
+    logic [7:0]  byte_count;
+    logic [7:0]  clk_div;
+    logic [7:0]  tx_data;
+    logic        tx_next;
+    logic [7:0]  rx_data;
+    logic        rx_valid;
+    logic        busy;
+    logic        done;
+
+    // SPI bus
+    logic        sck;
+    logic        mosi;
+    wire         miso;
+    logic        cs_n;
+
+    // Slave I/O
+    logic [15:0] SW;
+    logic [15:0] LED;
+    logic [6:0]  SEG;
+    logic [3:0]  AN;
+
+    // TX byte source (advanced by tx_next) and RX sink
+    logic [7:0]  tx_buf [32];
+    int          tx_idx;
+    logic [7:0]  rx_q [$];
+
+    // LED output changes while CS_N is low / high
+    int          led_changes_cs_low;
+    int          led_changes_cs_high;
+
+    int          test_pass;
+    int          test_fail;
+
+    assign tx_data = tx_buf[tx_idx];
+
+    always @(posedge clk) begin
+        if (tx_next)  tx_idx <= tx_idx + 1;
+        if (rx_valid) rx_q.push_back(rx_data);
+    end
+
+    always @(LED) begin
+        if (cs_n) led_changes_cs_high++;
+        else      led_changes_cs_low++;
+    end
+
+    //==========================================================================
+    // DUTs
+    //==========================================================================
+    spi_master master (
+        .clk(clk),
+        .rst_n(rst_n),
+        .start(start),
+        .rw_bit(rw_bit),
+        .byte_count(byte_count),
+        .clk_div(clk_div),
+        .tx_data(tx_data),
+        .tx_next(tx_next),
+        .rx_data(rx_data),
+        .rx_valid(rx_valid),
+        .busy(busy),
+        .done(done),
+        .sck(sck),
+        .mosi(mosi),
+        .miso(miso),
+        .cs_n(cs_n),
+        .debug_state()
+    );
+
+    spi_slave_top slave (
+        .clk(clk),
+        .rst_n(rst_n),
+        .sck(sck),
+        .mosi(mosi),
+        .miso(miso),
+        .cs_n(cs_n),
+        .SW(SW),
+        .LED(LED),
+        .SEG(SEG),
+        .AN(AN),
+        .debug_addr_match(),
+        .debug_state()
+    );
+
+    //==========================================================================
+    // Clock
+    //==========================================================================
+    initial begin
+        clk = 0;
+        forever #(CLK_PERIOD/2) clk = ~clk;
+    end
+
+    //==========================================================================
+    // Frame Tasks
+    //==========================================================================
+    // One frame; returns its length from start to done
+    task automatic spi_frame(input bit rw, input int n, output time t);
+        time t0;
+        @(posedge clk);
+        tx_idx     = 0;
+        rw_bit     = rw;
+        byte_count = n;
+        start      = 1;
+        t0         = $time;
+        @(posedge clk);
+        start      = 0;
+        wait (done);
+        t = $time - t0;
+        repeat(10) @(posedge clk);
+    endtask
+
+    // [0x02][reg][data...]
+    task automatic reg_write(input [7:0] reg_addr, input logic [7:0] data [$]);
+        time t;
+        tx_buf[0] = reg_addr;
+        foreach (data[i]) tx_buf[i+1] = data[i];
+        spi_frame(1'b0, data.size() + 1, t);
+    endtask
+
+    // [0x03][reg][dummy][data...]
+    task automatic reg_read(input [7:0] reg_addr, input int n,
+                            output logic [7:0] data [$], output time t);
+        rx_q.delete();
+        tx_buf[0] = reg_addr;
+        spi_frame(1'b1, n, t);
+        data = rx_q;
+    endtask
+
+    task automatic check(input bit cond, input string msg);
+        if (cond) begin
+            $display("  ✓ %s", msg);
+            test_pass++;
+        end else begin
+            $display("  ✗ %s", msg);
+            test_fail++;
+        end
+    endtask
+
+    //==========================================================================
+    // Test Sequence
+    //==========================================================================
+    initial begin
+        logic [7:0] rd [$];
+        time        t;
+        real        mbps;
+
+        $display("========================================");
+        $display("SPI Register-Map Transport Test");
+        $display("========================================");
+
+        test_pass  = 0;
+        test_fail  = 0;
+        rst_n      = 0;
+        start      = 0;
+        rw_bit     = 0;
+        byte_count = 8'd1;
+        clk_div    = 8'd5;
+        tx_idx     = 0;
+        SW         = 16'h005A;
+
+        repeat(20) @(posedge clk);
+        rst_n = 1;
+        repeat(20) @(posedge clk);
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 1: Burst write, commit at CS_N rise ===", $time);
+        led_changes_cs_low  = 0;
+        led_changes_cs_high = 0;
+        reg_write(REG_LED_LOW, '{8'hEF, 8'hBE, 8'h07});
+        check(LED == 16'hBEEF, $sformatf("LED = 0x%04h", LED));
+        check(led_changes_cs_low == 0 && led_changes_cs_high == 1,
+              "LED_LOW/LED_HIGH updated together after CS_N rise");
+        check(cs_n && !busy, "CS_N released after frame");
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 2: Burst read with auto-increment ===", $time);
+        reg_read(REG_SW_DATA, 4, rd, t);
+        check(rd.size() == 4, $sformatf("%0d bytes received", rd.size()));
+        check(rd[0] == 8'h5A && rd[1] == 8'hEF && rd[2] == 8'hBE && rd[3] == 8'h07,
+              $sformatf("SW/LED_LOW/LED_HIGH/FND = %02h %02h %02h %02h",
+                        rd[0], rd[1], rd[2], rd[3]));
+        check(miso === 1'bz, "MISO released after frame");
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 3: Atomic aliases ===", $time);
+        reg_write(REG_LED_LO_CLR, '{8'h0F});
+        check(LED == 16'hBEE0, $sformatf("LED_LOW_CLR 0x0F -> LED = 0x%04h", LED));
+        reg_write(REG_FND_TOGGLE, '{8'h03});
+        reg_read(REG_FND_DATA, 1, rd, t);
+        check(rd[0] == 8'h04, $sformatf("FND_DATA_TOGGLE 0x03 -> 0x%02h", rd[0]));
+
+        //----------------------------------------------------------------------
+        $display("\n[%0t] === Test 4: Throughput (%0d-byte read) ===", $time, BURST_LEN);
+        for (int s = 0; s < NUM_SPEEDS; s++) begin
+            clk_div = div[s];
+            SW      = 16'h00C0 + s;
+            reg_read(REG_SW_DATA, BURST_LEN, rd, t);
+            mbps = BURST_LEN * 8.0 * 1.0e3 / real'(t);
+            check(rd.size() == BURST_LEN && rd[0] == 8'hC0 + s && rd[1] == 8'hE0,
+                  $sformatf("%-9s SCK: %0t ns/frame, %0.2f Mbit/s payload",
+                            label[s], t, mbps));
+        end
+        // 12.5 MHz SCK must carry >= 10 Mbit/s of register data
+        check(mbps >= 10.0, "Payload >= 10 Mbit/s at 12.5 MHz SCK");
+
+        //----------------------------------------------------------------------
+        $display("\n========================================");
+        $display("Test Summary:");
+        $display("  PASSED: %0d", test_pass);
+        $display("  FAILED: %0d", test_fail);
+        $display("========================================");
+
+        if (test_fail == 0) begin
+            $display("✓ ALL TESTS PASSED!");
+        end else begin
+            $display("✗ SOME TESTS FAILED!");
+        end
+
+        $finish;
+    end
+
+    //==========================================================================
+    // Waveform
+    //==========================================================================
+    initial begin
+        $dumpfile("spi_regmap_tb.vcd");
+        $dumpvars(0, spi_regmap_tb);
+    end
+
+    //==========================================================================
+    // Timeout
+    //==========================================================================
+    initial begin
+        #1000000;
+        $display("\n✗ ERROR: Simulation timeout!");
+        $finish;
+    end
+
+endmodule
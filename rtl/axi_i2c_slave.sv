@@ -5,11 +5,19 @@
 //==============================================================================
 // AXI-Lite slave interface wrapper for I2C Slave core
 // Compatible with MicroBlaze and other AXI masters
+//
+// Multi-byte frames are buffered so the CPU does not have to service every
+// byte in real time:
+//  - RX FIFO: received bytes plus START / STOP markers (frame boundaries)
+//  - TX FIFO: bytes returned to the master on read, one per tx_load
+//  - Interrupt: level output, RX threshold / STOP / TX underrun / overflow
 //==============================================================================
 
 module axi_i2c_slave #(
     parameter C_S_AXI_DATA_WIDTH = 32,
-    parameter C_S_AXI_ADDR_WIDTH = 6
+    parameter C_S_AXI_ADDR_WIDTH = 6,
+    parameter RX_FIFO_DEPTH      = 32,   // Entries (power of 2)
+    parameter TX_FIFO_DEPTH      = 16    // Entries (power of 2)
 )(
     //==========================================================================
     // AXI-Lite Interface
@@ -63,16 +71,44 @@ module axi_i2c_slave #(
     // Register Map
     //==========================================================================
     // 0x00: CTRL   - Control Register (W)
+    //               [0] RX FIFO flush (self-clearing)
+    //               [1] TX FIFO flush (self-clearing)
     // 0x04: STAT   - Status Register (R)
+    //               [0] addr_match  [1] ack_sent  [2] RX FIFO not empty
+    //               [3] rx_full     [4] tx_empty  [5] tx_full
+    //               [15:8] rx_level [23:16] tx_level
     // 0x08: ADDR   - Own Slave Address (W)
-    // 0x0C: TXDATA - Transmit Data (W) - data to send to master on read
-    // 0x10: RXDATA - Receive Data (R) - data received from master on write
+    // 0x0C: TXDATA - Transmit Data (W) - byte sent when TX FIFO is empty
+    // 0x10: RXDATA - Receive Data (R) - last data byte received
+    // 0x14: RXFIFO - RX FIFO Pop (R)
+    //               [7:0] data  [9:8] tag (0=DATA, 1=START, 2=STOP)
+    //               [31] valid (0 = FIFO was empty, nothing popped)
+    //               START entry data = {addr, rw}
+    // 0x18: TXFIFO - TX FIFO Push (W) [7:0]
+    // 0x1C: IER    - Interrupt Enable (R/W)
+    //               [3:0] enables (same bits as ISR)
+    //               [15:8] RX threshold (IRQ when rx_level >= threshold)
+    // 0x20: ISR    - Interrupt Status (R, write 1 to clear [3:1])
+    //               [0] RX level >= threshold (level)
+    //               [1] STOP received   [2] TX underrun   [3] RX overflow
 
     localparam ADDR_CTRL   = 6'h00;
     localparam ADDR_STAT   = 6'h04;
     localparam ADDR_ADDR   = 6'h08;
     localparam ADDR_TXDATA = 6'h0C;
     localparam ADDR_RXDATA = 6'h10;
+    localparam ADDR_RXFIFO = 6'h14;
+    localparam ADDR_TXFIFO = 6'h18;
+    localparam ADDR_IER    = 6'h1C;
+    localparam ADDR_ISR    = 6'h20;
+
+    // RX FIFO entry tags
+    localparam logic [1:0] TAG_DATA  = 2'd0;
+    localparam logic [1:0] TAG_START = 2'd1;
+    localparam logic [1:0] TAG_STOP  = 2'd2;
+
+    localparam RX_AW = $clog2(RX_FIFO_DEPTH);
+    localparam TX_AW = $clog2(TX_FIFO_DEPTH);
 
     //==========================================================================
     // Internal Registers
@@ -82,6 +118,8 @@ module axi_i2c_slave #(
     logic [31:0] addr_reg;
     logic [31:0] txdata_reg;
     logic [31:0] rxdata_reg;
+    logic [31:0] ier_reg;
+    logic [3:0]  isr_reg;
 
     // AXI signals
     logic        axi_awready;
@@ -100,9 +138,29 @@ module axi_i2c_slave #(
     logic        i2c_data_valid;
     logic        i2c_addr_match;
     logic        i2c_ack_sent;
+    logic        i2c_tx_load;
+    logic        i2c_frame_start;
+    logic        i2c_frame_stop;
+    logic        i2c_frame_rw;
+
+    // RX FIFO ({tag, data})
+    logic [9:0]       rx_fifo [RX_FIFO_DEPTH];
+    logic [RX_AW-1:0] rx_wr_ptr, rx_rd_ptr;
+    logic [RX_AW:0]   rx_level;
+    logic             rx_empty, rx_full;
+    logic             rx_push, rx_pop, rx_flush;
+    logic [9:0]       rx_push_data;
 
-    // Control signals
-    logic        data_valid_prev;
+    // TX FIFO
+    logic [7:0]       tx_fifo [TX_FIFO_DEPTH];
+    logic [TX_AW-1:0] tx_wr_ptr, tx_rd_ptr;
+    logic [TX_AW:0]   tx_level;
+    logic             tx_empty, tx_full;
+    logic             tx_push, tx_pop, tx_flush;
+
+    // Register access strobes
+    logic             reg_wr;
+    logic             reg_rd;
 
     //==========================================================================
     // AXI Interface Assignments
@@ -116,17 +174,13 @@ module axi_i2c_slave #(
     assign S_AXI_RRESP   = axi_rresp;
     assign S_AXI_RVALID  = axi_rvalid;
 
+    assign reg_wr = axi_awready && axi_wready;
+    assign reg_rd = axi_arready && ~axi_rvalid;
+
     //==========================================================================
-    // Interrupt Generation (data valid pulse)
+    // Interrupt Generation (level, cleared by draining RX FIFO / writing ISR)
     //==========================================================================
-    assign interrupt = i2c_data_valid & ~data_valid_prev;
-
-    always_ff @(posedge S_AXI_ACLK) begin
-        if (!S_AXI_ARESETN)
-            data_valid_prev <= 1'b0;
-        else
-            data_valid_prev <= i2c_data_valid;
-    end
+    assign interrupt = |(isr_reg & ier_reg[3:0]);
 
     //==========================================================================
     // AXI Write Logic
@@ -140,6 +194,7 @@ module axi_i2c_slave #(
             ctrl_reg    <= 32'd0;
             addr_reg    <= {25'd0, 7'b1010101}; // Default: 0x55
             txdata_reg  <= 32'd0;
+            ier_reg     <= {16'd0, 8'd1, 8'd0}; // Threshold 1, all disabled
         end else begin
             // Default ready states
             if (S_AXI_AWVALID && ~axi_awready)
@@ -161,11 +216,12 @@ module axi_i2c_slave #(
             end
 
             // Register writes
-            if (axi_awready && axi_wready) begin
+            if (reg_wr) begin
                 case (S_AXI_AWADDR[5:2])
-                    ADDR_CTRL[5:2]:   ctrl_reg   <= S_AXI_WDATA;
+                    ADDR_CTRL[5:2]:   ctrl_reg   <= S_AXI_WDATA & ~32'h3;
                     ADDR_ADDR[5:2]:   addr_reg   <= S_AXI_WDATA;
                     ADDR_TXDATA[5:2]: txdata_reg <= S_AXI_WDATA;
+                    ADDR_IER[5:2]:    ier_reg    <= S_AXI_WDATA;
                     default: ;
                 endcase
             end
@@ -189,7 +245,7 @@ module axi_i2c_slave #(
                 axi_arready <= 1'b0;
 
             // Read data valid
-            if (axi_arready && ~axi_rvalid) begin
+            if (reg_rd) begin
                 axi_rvalid <= 1'b1;
                 axi_rresp  <= 2'b00; // OKAY
 
@@ -200,6 +256,10 @@ module axi_i2c_slave #(
                     ADDR_ADDR[5:2]:   axi_rdata <= addr_reg;
                     ADDR_TXDATA[5:2]: axi_rdata <= txdata_reg;
                     ADDR_RXDATA[5:2]: axi_rdata <= rxdata_reg;
+                    ADDR_RXFIFO[5:2]: axi_rdata <= rx_empty ? 32'd0 :
+                                                   {1'b1, 21'd0, rx_fifo[rx_rd_ptr]};
+                    ADDR_IER[5:2]:    axi_rdata <= ier_reg;
+                    ADDR_ISR[5:2]:    axi_rdata <= {28'd0, isr_reg};
                     default:          axi_rdata <= 32'd0;
                 endcase
             end else if (S_AXI_RREADY && axi_rvalid) begin
@@ -215,9 +275,103 @@ module axi_i2c_slave #(
         if (!S_AXI_ARESETN) begin
             stat_reg <= 32'd0;
         end else begin
-            stat_reg[0] <= i2c_addr_match;  // Address matched
-            stat_reg[1] <= i2c_ack_sent;    // ACK sent
-            stat_reg[2] <= i2c_data_valid;  // Data valid (new data received)
+            stat_reg[0]     <= i2c_addr_match;  // Address matched
+            stat_reg[1]     <= i2c_ack_sent;    // ACK sent
+            stat_reg[2]     <= ~rx_empty;       // RX FIFO has entries
+            stat_reg[3]     <= rx_full;
+            stat_reg[4]     <= tx_empty;
+            stat_reg[5]     <= tx_full;
+            stat_reg[15:8]  <= 8'(rx_level);
+            stat_reg[23:16] <= 8'(tx_level);
+        end
+    end
+
+    //==========================================================================
+    // Interrupt Status
+    //==========================================================================
+    // [0] follows the RX level; [3:1] are sticky until written with 1
+    always_ff @(posedge S_AXI_ACLK) begin
+        if (!S_AXI_ARESETN) begin
+            isr_reg <= 4'd0;
+        end else begin
+            isr_reg[0] <= (rx_level != 0) && (rx_level >= ier_reg[15:8]);
+
+            if (reg_wr && S_AXI_AWADDR[5:2] == ADDR_ISR[5:2])
+                isr_reg[3:1] <= isr_reg[3:1] & ~S_AXI_WDATA[3:1];
+
+            if (i2c_frame_stop)                   isr_reg[1] <= 1'b1;
+            if (i2c_tx_load && tx_empty)          isr_reg[2] <= 1'b1;
+            if (rx_push && rx_full && !rx_pop)    isr_reg[3] <= 1'b1;
+        end
+    end
+
+    //==========================================================================
+    // RX FIFO: START marker, data bytes, STOP marker (one event per cycle)
+    //==========================================================================
+    assign rx_flush = reg_wr && (S_AXI_AWADDR[5:2] == ADDR_CTRL[5:2]) && S_AXI_WDATA[0];
+    assign rx_pop   = reg_rd && (S_AXI_ARADDR[5:2] == ADDR_RXFIFO[5:2]) && !rx_empty;
+    assign rx_push  = i2c_frame_start | i2c_data_valid | i2c_frame_stop;
+    assign rx_empty = (rx_level == 0);
+    assign rx_full  = (rx_level == RX_FIFO_DEPTH);
+
+    always_comb begin
+        if (i2c_frame_start)
+            rx_push_data = {TAG_START, i2c_slave_addr, i2c_frame_rw};
+        else if (i2c_frame_stop)
+            rx_push_data = {TAG_STOP, 8'd0};
+        else
+            rx_push_data = {TAG_DATA, i2c_rx_data};
+    end
+
+    always_ff @(posedge S_AXI_ACLK) begin
+        if (!S_AXI_ARESETN || rx_flush) begin
+            rx_wr_ptr <= '0;
+            rx_rd_ptr <= '0;
+            rx_level  <= '0;
+        end else begin
+            // Full FIFO drops the new entry (flagged by ISR[3])
+            if (rx_push && !rx_full) begin
+                rx_fifo[rx_wr_ptr] <= rx_push_data;
+                rx_wr_ptr          <= rx_wr_ptr + 1;
+            end
+
+            if (rx_pop)
+                rx_rd_ptr <= rx_rd_ptr + 1;
+
+            if ((rx_push && !rx_full) && !rx_pop)
+                rx_level <= rx_level + 1;
+            else if (!(rx_push && !rx_full) && rx_pop)
+                rx_level <= rx_level - 1;
+        end
+    end
+
+    //==========================================================================
+    // TX FIFO: popped each time the core latches a read byte
+    //==========================================================================
+    assign tx_flush = reg_wr && (S_AXI_AWADDR[5:2] == ADDR_CTRL[5:2]) && S_AXI_WDATA[1];
+    assign tx_push  = reg_wr && (S_AXI_AWADDR[5:2] == ADDR_TXFIFO[5:2]) && !tx_full;
+    assign tx_pop   = i2c_tx_load && !tx_empty;
+    assign tx_empty = (tx_level == 0);
+    assign tx_full  = (tx_level == TX_FIFO_DEPTH);
+
+    always_ff @(posedge S_AXI_ACLK) begin
+        if (!S_AXI_ARESETN || tx_flush) begin
+            tx_wr_ptr <= '0;
+            tx_rd_ptr <= '0;
+            tx_level  <= '0;
+        end else begin
+            if (tx_push) begin
+                tx_fifo[tx_wr_ptr] <= S_AXI_WDATA[7:0];
+                tx_wr_ptr          <= tx_wr_ptr + 1;
+            end
+
+            if (tx_pop)
+                tx_rd_ptr <= tx_rd_ptr + 1;
+
+            if (tx_push && !tx_pop)
+                tx_level <= tx_level + 1;
+            else if (!tx_push && tx_pop)
+                tx_level <= tx_level - 1;
         end
     end
 
@@ -236,7 +390,7 @@ module axi_i2c_slave #(
     // I2C Core Signal Mapping
     //==========================================================================
     assign i2c_slave_addr = addr_reg[6:0];
-    assign i2c_tx_data    = txdata_reg[7:0];
+    assign i2c_tx_data    = tx_empty ? txdata_reg[7:0] : tx_fifo[tx_rd_ptr];
 
     //==========================================================================
     // I2C Slave Core Instance
@@ -248,6 +402,10 @@ module axi_i2c_slave #(
         .tx_data            (i2c_tx_data),
         .rx_data            (i2c_rx_data),
         .data_valid         (i2c_data_valid),
+        .tx_load            (i2c_tx_load),
+        .frame_start        (i2c_frame_start),
+        .frame_stop         (i2c_frame_stop),
+        .frame_rw           (i2c_frame_rw),
         .scl                (scl),
         .sda                (sda),
         .debug_addr_match   (i2c_addr_match),
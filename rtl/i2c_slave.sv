@@ -6,7 +6,8 @@
 // Features:
 //  - 100 MHz system clock for edge detection
 //  - 7-bit addressing (0x55 default)
-//  - Single byte read/write operations
+//  - Multi-byte read/write (write: ACK every byte, read: until master NACK)
+//  - Frame events (own-address START / STOP) and tx_load request for FIFOs
 //  - Proper I2C protocol: Detects START, receives ADDR, sends ACK, handles DATA
 //  - Tri-state SDA control
 //==============================================================================
@@ -23,6 +24,12 @@ module i2c_slave (
     input  logic [7:0] tx_data,          // Data to transmit (for read operations)
     output logic [7:0] rx_data,          // Received data (from write operations)
     output logic       data_valid,       // Pulse when new data received
+    output logic       tx_load,          // Pulse when tx_data is latched (read)
+
+    // Frame Events
+    output logic       frame_start,      // Pulse when own address matched (START / Sr)
+    output logic       frame_stop,       // Pulse on STOP ending an addressed frame
+    output logic       frame_rw,         // R/W bit of the current frame
 
     // I2C Bus
     input  logic       scl,              // I2C clock line (input)
@@ -87,6 +94,13 @@ module i2c_slave (
     logic       rw_bit;                          // Read/Write bit from address
     logic       ack_sent, ack_sent_next;         // ACK sent flag
     logic       data_valid_reg, data_valid_next; // Data valid pulse
+    logic       tx_load_reg, tx_load_next;       // TX byte latched pulse
+    logic       rd_ack, rd_ack_next;             // Master ACKed last read byte
+
+    // Frame tracking
+    logic       in_frame, in_frame_next;         // Own address ACKed, no STOP yet
+    logic       frame_start_reg, frame_start_next;
+    logic       frame_stop_reg, frame_stop_next;
 
     // START/STOP detection
     logic       start_detected;
@@ -102,6 +116,10 @@ module i2c_slave (
     //==========================================================================
     assign rx_data          = rx_shift;
     assign data_valid       = data_valid_reg;
+    assign tx_load          = tx_load_reg;
+    assign frame_start      = frame_start_reg;
+    assign frame_stop       = frame_stop_reg;
+    assign frame_rw         = rw_bit;
     assign debug_addr_match = addr_match;
     assign debug_ack_sent   = ack_sent;
     assign debug_state      = state[1:0];  // Lower 2 bits for LED display
@@ -165,6 +183,11 @@ module i2c_slave (
             addr_match     <= 1'b0;
             ack_sent       <= 1'b0;
             data_valid_reg <= 1'b0;
+            tx_load_reg    <= 1'b0;
+            rd_ack         <= 1'b0;
+            in_frame       <= 1'b0;
+            frame_start_reg <= 1'b0;
+            frame_stop_reg <= 1'b0;
         end else begin
             state          <= state_next;
             addr_rw_reg    <= addr_rw_next;
@@ -176,6 +199,11 @@ module i2c_slave (
             addr_match     <= addr_match_next;
             ack_sent       <= ack_sent_next;
             data_valid_reg <= data_valid_next;
+            tx_load_reg    <= tx_load_next;
+            rd_ack         <= rd_ack_next;
+            in_frame       <= in_frame_next;
+            frame_start_reg <= frame_start_next;
+            frame_stop_reg <= frame_stop_next;
         end
     end
 
@@ -194,6 +222,11 @@ module i2c_slave (
         addr_match_next  = addr_match;
         ack_sent_next    = ack_sent;
         data_valid_next  = 1'b0;  // Pulse signal
+        tx_load_next     = 1'b0;  // Pulse signal
+        rd_ack_next      = rd_ack;
+        in_frame_next    = in_frame;
+        frame_start_next = 1'b0;  // Pulse signal
+        frame_stop_next  = 1'b0;  // Pulse signal
 
         // Detect STOP condition globally (except in IDLE)
         if (stop_detected && (state != IDLE)) begin
@@ -202,6 +235,12 @@ module i2c_slave (
             bit_count_next  = 3'd0;
             ack_sent_next   = 1'b0;
             addr_match_next = 1'b0;
+            rd_ack_next     = 1'b0;
+
+            if (in_frame) begin
+                in_frame_next   = 1'b0;
+                frame_stop_next = 1'b1;
+            end
         end else begin
             case (state)
                 //==============================================================
@@ -226,7 +265,9 @@ module i2c_slave (
                     sda_oe_next    = 1'b0;  // Tri-state (receive mode)
                     bit_count_next = 3'd0;
 
-                    if (scl_rising_edge) begin
+                    // START completes when the master pulls SCL low; the
+                    // next rising edge already carries the address MSB
+                    if (scl_falling_edge) begin
                         state_next = ADDR_RCV;
                     end
                 end
@@ -249,7 +290,9 @@ module i2c_slave (
 
                             // Check if address matches (compare upper 7 bits)
                             if ({addr_rw_reg[6:0], sda_in}[7:1] == slave_addr) begin
-                                addr_match_next = 1'b1;
+                                addr_match_next  = 1'b1;
+                                in_frame_next    = 1'b1;
+                                frame_start_next = 1'b1;
                             end else begin
                                 addr_match_next = 1'b0;
                             end
@@ -280,9 +323,14 @@ module i2c_slave (
                             sda_oe_next = 1'b0;  // Release SDA
 
                             if (rw_bit == I2C_READ) begin
-                                // Master wants to read - slave transmits
-                                tx_shift_next = tx_data;
-                                state_next    = DATA_SEND;
+                                // Master wants to read - slave transmits,
+                                // MSB is driven on this same falling edge
+                                tx_shift_next  = tx_data;
+                                tx_load_next   = 1'b1;
+                                sda_oe_next    = 1'b1;
+                                sda_out_next   = tx_data[7];
+                                bit_count_next = 3'd0;
+                                state_next     = DATA_SEND;
                             end else begin
                                 // Master wants to write - slave receives
                                 state_next = DATA_RCV;
@@ -301,7 +349,12 @@ module i2c_slave (
                 DATA_RCV: begin
                     sda_oe_next = 1'b0;  // Tri-state (receive mode)
 
-                    if (scl_rising_edge) begin
+                    if (start_detected) begin
+                        // Repeated START instead of another data byte
+                        state_next     = START;
+                        bit_count_next = 3'd0;
+                        ack_sent_next  = 1'b0;
+                    end else if (scl_rising_edge) begin
                         // Sample data bit on SCL rising edge
                         rx_shift_next = {rx_shift[6:0], sda_in};
                         bit_count_next = bit_count + 1;
@@ -357,13 +410,17 @@ module i2c_slave (
                         end
 
                         if (scl_falling_edge && sda_oe) begin
-                            // ACK sent, go to WAIT_STOP or receive more data
-                            sda_oe_next = 1'b0;
-                            state_next  = WAIT_STOP;  // Single byte transfer
+                            // ACK sent, receive next byte (STOP / Sr end it)
+                            sda_oe_next    = 1'b0;
+                            bit_count_next = 3'd0;
+                            state_next     = DATA_RCV;
                         end
                     end else begin
-                        // Read: Wait for master's ACK/NACK
-                        sda_oe_next = 1'b0;  // Release SDA
+                        // Read: Release SDA after the last bit, then wait
+                        // for master's ACK/NACK
+                        if (scl_falling_edge) begin
+                            sda_oe_next = 1'b0;
+                        end
 
                         if (scl_rising_edge) begin
                             // Sample master's ACK/NACK
@@ -371,11 +428,21 @@ module i2c_slave (
                                 // NACK received - master done reading
                                 state_next = WAIT_STOP;
                             end else begin
-                                // ACK received - could send more bytes
-                                // For single byte transfer, still go to WAIT_STOP
-                                state_next = WAIT_STOP;
+                                // ACK received - send another byte
+                                rd_ack_next = 1'b1;
                             end
                         end
+
+                        if (scl_falling_edge && rd_ack) begin
+                            // ACK slot over, load and drive next byte MSB
+                            rd_ack_next    = 1'b0;
+                            tx_shift_next  = tx_data;
+                            tx_load_next   = 1'b1;
+                            sda_oe_next    = 1'b1;
+                            sda_out_next   = tx_data[7];
+                            bit_count_next = 3'd0;
+                            state_next     = DATA_SEND;
+                        end
                     end
                 end
 
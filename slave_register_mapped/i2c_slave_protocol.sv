@@ -9,27 +9,53 @@
 //  - Device address matching (7-bit)
 //  - Register address reception
 //  - Repeated START support
-//  - Write: [ADDR][REG_ADDR][DATA]
-//  - Read:  [ADDR][REG_ADDR][R_START][ADDR|R][DATA]
+//  - Write: [ADDR][REG_ADDR][DATA][DATA]...
+//  - Read:  [ADDR][REG_ADDR][R_START][ADDR|R][DATA][DATA]...
+//           or [ADDR][REG_ADDR][STOP] then [ADDR|R][DATA]... (pointer kept)
+//  - Auto-increment: reg_addr advances after every data byte, so a burst
+//    walks consecutive registers (read continues while the master ACKs)
+//  - reg_commit pulses on the STOP that ends a transaction containing
+//    writes, so the register map can apply a whole burst at once
+//  - Clock stretching: SCL is held low after reg_ren / reg_wen until the
+//    back end asserts reg_ready, so registered or multi-cycle register
+//    files (BRAM, CDC, slow peripherals) can sit behind this engine.
+//    Tie reg_ready high for a combinational back end.
+//    After STRETCH_TIMEOUT clocks SCL is released and the engine waits for
+//    STOP: a read returns 0xFF, a write NACKs the next byte and the burst
+//    is dropped at STOP (reg_abort instead of reg_commit).
+//  - Optional SMBus PEC (CRC-8, x^8+x^2+x+1) over every byte since START:
+//    * Write: the last byte before STOP is the PEC. Each byte is held back
+//      one byte time before reg_wen; at STOP a bad or missing PEC raises
+//      pec_error instead of reg_commit, so the burst is dropped
+//    * Read: after pec_rd_len+1 data bytes the slave sends the PEC byte
+//    * pec_en is sampled at START (takes effect on the next transaction)
 //==============================================================================
 
-module i2c_slave_protocol (
+module i2c_slave_protocol #(
+    parameter int STRETCH_TIMEOUT = 100_000     // Max SCL hold (clk cycles, 1 ms)
+)(
     // Global signals
     input  logic       clk,              // 100 MHz system clock
     input  logic       rst_n,            // Active-low reset
 
     // Configuration
     input  logic [6:0] slave_addr,       // 7-bit device address
+    input  logic       pec_en,           // SMBus PEC on (sampled at START)
+    input  logic [2:0] pec_rd_len,       // Read data bytes before PEC, minus 1
 
     // Register interface
     output logic [7:0] reg_addr,         // Register address
     output logic [7:0] reg_wdata,        // Write data
     output logic       reg_wen,          // Write enable (1 clk pulse)
     output logic       reg_ren,          // Read enable (1 clk pulse)
+    output logic       reg_commit,       // STOP after writes (1 clk pulse)
     input  logic [7:0] reg_rdata,        // Read data
+    input  logic       reg_ready,        // Read data valid / write accepted
+    output logic       pec_error,        // Bad/missing PEC at STOP (1 clk pulse)
+    output logic       reg_abort,        // Write timed out, STOP drops burst (1 clk pulse)
 
     // I2C bus
-    input  logic       scl,
+    inout  logic       scl,              // Open-drain: held low while stretching
     inout  logic       sda,
 
     // Debug
@@ -52,7 +78,11 @@ module i2c_slave_protocol (
         TX_DATA      = 4'd8,    // Transmit read data
         TX_DATA_ACK  = 4'd9,    // Receive ACK from master
         WAIT_STOP    = 4'd10,   // Wait for STOP or repeated START
-        ERROR        = 4'd11
+        ERROR        = 4'd11,
+        RD_WAIT      = 4'd12,   // Stretch SCL until read data ready
+        WR_WAIT      = 4'd13,   // Stretch SCL until write accepted
+        TX_NEXT      = 4'd14,   // Master ACKed: fetch next byte after SCL falls
+        TX_PEC       = 4'd15    // Master ACKed: send PEC after SCL falls
     } state_t;
 
     //==========================================================================
@@ -92,17 +122,42 @@ module i2c_slave_protocol (
     // Register interface
     logic       reg_wen_reg, reg_wen_next;
     logic       reg_ren_reg, reg_ren_next;
+    logic       reg_commit_reg, reg_commit_next;
+    logic       wr_pending, wr_pending_next;     // Writes since last STOP
+    logic [7:0] wr_data, wr_data_next;           // Byte driven on reg_wdata
+
+    // SMBus PEC
+    logic       pec_on, pec_on_next;             // pec_en latched at START
+    logic [7:0] crc_reg, crc_next;               // CRC-8 since START
+    logic [7:0] hold_byte, hold_byte_next;       // Last byte (PEC candidate)
+    logic       hold_valid, hold_valid_next;
+    logic       wr_frame, wr_frame_next;         // Addressed for write
+    logic [3:0] tx_count, tx_count_next;         // Data bytes since PEC
+    logic       tx_is_pec, tx_is_pec_next;       // Byte on SDA is the PEC
+    logic       pec_error_reg, pec_error_next;
+    logic       pec_bad;
+
+    // Clock stretching
+    localparam int STRETCH_W = $clog2(STRETCH_TIMEOUT + 1);
+    logic                 scl_hold, scl_hold_next;
+    logic [STRETCH_W-1:0] stretch_cnt, stretch_cnt_next;
+    logic                 wr_timeout, wr_timeout_next;  // Write not accepted
+    logic                 reg_abort_reg, reg_abort_next;
 
     //==========================================================================
     // Output Assignments
     //==========================================================================
     assign sda = sda_oe ? sda_out : 1'bz;
+    assign scl = scl_hold ? 1'b0 : 1'bz;
     assign rw_bit = dev_addr_reg[0];
 
     assign reg_addr  = reg_addr_reg;
-    assign reg_wdata = rx_shift;
+    assign reg_wdata = wr_data;
     assign reg_wen   = reg_wen_reg;
     assign reg_ren   = reg_ren_reg;
+    assign reg_commit = reg_commit_reg;
+    assign pec_error  = pec_error_reg;
+    assign reg_abort  = reg_abort_reg;
 
     assign debug_addr_match = addr_match;
     assign debug_state = state;
@@ -133,6 +188,24 @@ module i2c_slave_protocol (
     // STOP: SDA rises while SCL high
     assign stop_detected = (~sda_prev & sda_in) & scl_high;
 
+    //==========================================================================
+    // SMBus PEC (CRC-8, polynomial 0x07, init 0x00, MSB first)
+    //==========================================================================
+    function automatic logic [7:0] crc8(input logic [7:0] crc,
+                                        input logic [7:0] data);
+        logic [7:0] c;
+        c = crc ^ data;
+        for (int i = 0; i < 8; i++) begin
+            c = c[7] ? {c[6:0], 1'b0} ^ 8'h07 : {c[6:0], 1'b0};
+        end
+        return c;
+    endfunction
+
+    // Running CRC over data + PEC is zero when the PEC matches. A write
+    // that set a register pointer must end with a PEC byte.
+    assign pec_bad = pec_on && wr_frame && reg_addr_valid &&
+                     (!hold_valid || crc_reg != 8'h00);
+
     //==========================================================================
     // Sequential Logic
     //==========================================================================
@@ -150,6 +223,21 @@ module i2c_slave_protocol (
             reg_addr_valid  <= 1'b0;
             reg_wen_reg     <= 1'b0;
             reg_ren_reg     <= 1'b0;
+            reg_commit_reg  <= 1'b0;
+            wr_pending      <= 1'b0;
+            wr_data         <= 8'd0;
+            pec_on          <= 1'b0;
+            crc_reg         <= 8'd0;
+            hold_byte       <= 8'd0;
+            hold_valid      <= 1'b0;
+            wr_frame        <= 1'b0;
+            tx_count        <= 4'd0;
+            tx_is_pec       <= 1'b0;
+            pec_error_reg   <= 1'b0;
+            scl_hold        <= 1'b0;
+            stretch_cnt     <= '0;
+            wr_timeout      <= 1'b0;
+            reg_abort_reg   <= 1'b0;
         end else begin
             state           <= state_next;
             dev_addr_reg    <= dev_addr_next;
@@ -163,6 +251,21 @@ module i2c_slave_protocol (
             reg_addr_valid  <= reg_addr_valid_next;
             reg_wen_reg     <= reg_wen_next;
             reg_ren_reg     <= reg_ren_next;
+            reg_commit_reg  <= reg_commit_next;
+            wr_pending      <= wr_pending_next;
+            wr_data         <= wr_data_next;
+            pec_on          <= pec_on_next;
+            crc_reg         <= crc_next;
+            hold_byte       <= hold_byte_next;
+            hold_valid      <= hold_valid_next;
+            wr_frame        <= wr_frame_next;
+            tx_count        <= tx_count_next;
+            tx_is_pec       <= tx_is_pec_next;
+            pec_error_reg   <= pec_error_next;
+            scl_hold        <= scl_hold_next;
+            stretch_cnt     <= stretch_cnt_next;
+            wr_timeout      <= wr_timeout_next;
+            reg_abort_reg   <= reg_abort_next;
         end
     end
 
@@ -183,6 +286,21 @@ module i2c_slave_protocol (
         reg_addr_valid_next = reg_addr_valid;
         reg_wen_next        = 1'b0;  // Pulse
         reg_ren_next        = 1'b0;  // Pulse
+        reg_commit_next     = 1'b0;  // Pulse
+        wr_pending_next     = wr_pending;
+        wr_data_next        = wr_data;
+        pec_on_next         = pec_on;
+        crc_next            = crc_reg;
+        hold_byte_next      = hold_byte;
+        hold_valid_next     = hold_valid;
+        wr_frame_next       = wr_frame;
+        tx_count_next       = tx_count;
+        tx_is_pec_next      = tx_is_pec;
+        pec_error_next      = 1'b0;  // Pulse
+        scl_hold_next       = scl_hold;
+        stretch_cnt_next    = stretch_cnt;
+        wr_timeout_next     = wr_timeout;
+        reg_abort_next      = 1'b0;  // Pulse
 
         // Global STOP detection
         if (stop_detected && (state != IDLE)) begin
@@ -191,6 +309,17 @@ module i2c_slave_protocol (
             bit_count_next      = 3'd0;
             addr_match_next     = 1'b0;
             reg_addr_valid_next = 1'b0;
+            scl_hold_next       = 1'b0;
+
+            // Apply every register written in this transaction, unless
+            // the PEC check failed or a write timed out (then the register
+            // map drops them)
+            reg_commit_next     = wr_pending && !pec_bad && !wr_timeout;
+            pec_error_next      = pec_bad && !wr_timeout;
+            reg_abort_next      = wr_timeout;
+            wr_timeout_next     = 1'b0;
+            wr_pending_next     = 1'b0;
+            wr_frame_next       = 1'b0;
         end else begin
             case (state)
                 //==============================================================
@@ -203,7 +332,12 @@ module i2c_slave_protocol (
                     reg_addr_valid_next = 1'b0;
 
                     if (start_detected) begin
-                        state_next = START;
+                        // PEC covers everything up to STOP, including Sr
+                        pec_on_next     = pec_en;
+                        crc_next        = 8'h00;
+                        hold_valid_next = 1'b0;
+                        wr_frame_next   = 1'b0;
+                        state_next      = START;
                     end
                 end
 
@@ -214,7 +348,10 @@ module i2c_slave_protocol (
                     sda_oe_next = 1'b0;
 
                     if (scl_rising_edge) begin
-                        state_next = RX_DEV_ADDR;
+                        // First rising edge carries address MSB
+                        dev_addr_next  = {7'd0, sda_in};
+                        bit_count_next = 3'd1;
+                        state_next     = RX_DEV_ADDR;
                     end
                 end
 
@@ -230,6 +367,7 @@ module i2c_slave_protocol (
 
                         if (bit_count == 7) begin
                             bit_count_next = 3'd0;
+                            crc_next = crc8(crc_reg, {dev_addr_reg[6:0], sda_in});
                             state_next = DEV_ADDR_ACK;
 
                             // Check address match
@@ -258,13 +396,18 @@ module i2c_slave_protocol (
                         end
 
                         if (scl_falling_edge && sda_oe) begin
-                            sda_oe_next = 1'b0;
-
-                            // If Read bit and reg_addr already valid: go to TX
-                            if (rw_bit == 1'b1 && reg_addr_valid) begin
-                                reg_ren_next = 1'b1;  // Pulse read enable
-                                tx_shift_next = reg_rdata;
-                                state_next = TX_DATA;
+                            sda_oe_next   = 1'b0;
+                            wr_frame_next = (rw_bit == 1'b0);
+                            tx_count_next = 4'd0;
+
+                            // Read: fetch data while holding SCL low, from
+                            // the pointer set after Sr or by an earlier
+                            // write (current-address read, no Sr needed)
+                            if (rw_bit == 1'b1) begin
+                                reg_ren_next     = 1'b1;  // Pulse read enable
+                                scl_hold_next    = 1'b1;
+                                stretch_cnt_next = '0;
+                                state_next       = RD_WAIT;
                             end else begin
                                 // Write or first access: receive register address
                                 state_next = RX_REG_ADDR;
@@ -289,6 +432,7 @@ module i2c_slave_protocol (
                         if (bit_count == 7) begin
                             bit_count_next = 3'd0;
                             reg_addr_next = {rx_shift[6:0], sda_in};
+                            crc_next = crc8(crc_reg, {rx_shift[6:0], sda_in});
                             reg_addr_valid_next = 1'b1;
                             state_next = REG_ADDR_ACK;
                         end
@@ -321,12 +465,17 @@ module i2c_slave_protocol (
                 RX_DATA: begin
                     sda_oe_next = 1'b0;
 
-                    if (scl_rising_edge) begin
+                    if (start_detected) begin
+                        // Repeated START after register address (read)
+                        state_next     = START;
+                        bit_count_next = 3'd0;
+                    end else if (scl_rising_edge) begin
                         rx_shift_next = {rx_shift[6:0], sda_in};
                         bit_count_next = bit_count + 1;
 
                         if (bit_count == 7) begin
                             bit_count_next = 3'd0;
+                            crc_next = crc8(crc_reg, {rx_shift[6:0], sda_in});
                             state_next = RX_DATA_ACK;
                         end
                     end
@@ -348,8 +497,70 @@ module i2c_slave_protocol (
 
                     if (scl_falling_edge && sda_oe) begin
                         sda_oe_next = 1'b0;
-                        reg_wen_next = 1'b1;  // Trigger write!
-                        state_next = WAIT_STOP;
+
+                        if (pec_on) begin
+                            // Hold this byte (may be the PEC), write the
+                            // previous one
+                            hold_byte_next  = rx_shift;
+                            hold_valid_next = 1'b1;
+                        end
+
+                        if (!pec_on || hold_valid) begin
+                            wr_data_next     = pec_on ? hold_byte : rx_shift;
+                            reg_wen_next     = 1'b1;  // Trigger write!
+                            wr_pending_next  = 1'b1;
+                            scl_hold_next    = 1'b1;  // Stretch until accepted
+                            stretch_cnt_next = '0;
+                            state_next       = WR_WAIT;
+                        end else begin
+                            state_next       = RX_DATA;
+                        end
+                    end
+                end
+
+                //==============================================================
+                // RD_WAIT: Hold SCL low until back end returns read data
+                //==============================================================
+                RD_WAIT: begin
+                    stretch_cnt_next = stretch_cnt + 1;
+
+                    if (reg_ready) begin
+                        // Load data and drive MSB before releasing SCL
+                        crc_next       = crc8(crc_reg, reg_rdata);
+                        tx_count_next  = tx_count + 1;
+                        tx_is_pec_next = 1'b0;
+                        tx_shift_next  = reg_rdata;
+                        sda_oe_next    = 1'b1;
+                        sda_out_next   = reg_rdata[7];
+                        bit_count_next = 3'd0;
+                        scl_hold_next  = 1'b0;
+                        state_next     = TX_DATA;
+                    end else if (stretch_cnt == STRETCH_W'(STRETCH_TIMEOUT)) begin
+                        // Back end stuck: release bus, master reads 0xFF
+                        sda_oe_next   = 1'b0;
+                        scl_hold_next = 1'b0;
+                        state_next    = WAIT_STOP;
+                    end
+                end
+
+                //==============================================================
+                // WR_WAIT: Hold SCL low until back end accepts write
+                //==============================================================
+                WR_WAIT: begin
+                    stretch_cnt_next = stretch_cnt + 1;
+
+                    if (reg_ready) begin
+                        // Next byte of the burst goes to the next register
+                        reg_addr_next = reg_addr_reg + 1;
+                        scl_hold_next = 1'b0;
+                        state_next    = RX_DATA;
+                    end else if (stretch_cnt == STRETCH_W'(STRETCH_TIMEOUT)) begin
+                        // Back end stuck: release bus, NACK the next byte,
+                        // drop the burst at STOP
+                        sda_oe_next     = 1'b0;
+                        scl_hold_next   = 1'b0;
+                        wr_timeout_next = 1'b1;
+                        state_next      = WAIT_STOP;
                     end
                 end
 
@@ -378,20 +589,67 @@ module i2c_slave_protocol (
                 // TX_DATA_ACK: Wait for master ACK/NACK
                 //==============================================================
                 TX_DATA_ACK: begin
-                    sda_oe_next = 1'b0;  // Release for master
+                    // Hold last bit through SCL high, release on falling edge
+                    if (scl_falling_edge) begin
+                        sda_oe_next = 1'b0;  // Release for master
+                    end
 
                     if (scl_rising_edge) begin
                         // Sample master's ACK
                         if (sda_in == 1'b1) begin
                             // NACK - master done
                             state_next = WAIT_STOP;
+                        end else if (pec_on && !tx_is_pec &&
+                                     tx_count == {1'b0, pec_rd_len} + 4'd1) begin
+                            // ACK after the last data byte: PEC follows
+                            state_next    = TX_PEC;
                         end else begin
-                            // ACK - could read more (single byte for now)
-                            state_next = WAIT_STOP;
+                            // ACK - master wants the next register
+                            reg_addr_next = reg_addr_reg + 1;
+                            state_next    = TX_NEXT;
                         end
                     end
                 end
 
+                //==============================================================
+                // TX_NEXT: After ACK clock falls, fetch next byte (stretch)
+                //==============================================================
+                TX_NEXT: begin
+                    sda_oe_next = 1'b0;
+
+                    if (start_detected) begin
+                        // Repeated START instead of another clock
+                        state_next     = START;
+                        bit_count_next = 3'd0;
+                    end else if (scl_falling_edge) begin
+                        reg_ren_next     = 1'b1;
+                        scl_hold_next    = 1'b1;
+                        stretch_cnt_next = '0;
+                        state_next       = RD_WAIT;
+                    end
+                end
+
+                //==============================================================
+                // TX_PEC: After ACK clock falls, drive the PEC byte
+                //==============================================================
+                TX_PEC: begin
+                    sda_oe_next = 1'b0;
+
+                    if (start_detected) begin
+                        state_next     = START;
+                        bit_count_next = 3'd0;
+                    end else if (scl_falling_edge) begin
+                        tx_shift_next  = crc_reg;
+                        sda_oe_next    = 1'b1;
+                        sda_out_next   = crc_reg[7];
+                        bit_count_next = 3'd0;
+                        crc_next       = 8'h00;   // crc8(crc, crc)
+                        tx_count_next  = 4'd0;
+                        tx_is_pec_next = 1'b1;
+                        state_next     = TX_DATA;
+                    end
+                end
+
                 //==============================================================
                 // WAIT_STOP: Wait for STOP or repeated START
                 //==============================================================
@@ -7,13 +7,17 @@
 // For Basys3 FPGA board
 //==============================================================================
 
-module i2c_slave_top (
+module i2c_slave_top #(
+    parameter logic [6:0] SLAVE_ADDR      = 7'h55,    // 7-bit device address
+    parameter int          ACCESS_LATENCY  = 1,        // Register map latency (clk)
+    parameter int          STRETCH_TIMEOUT = 100_000   // Max SCL hold (clk)
+)(
     // System
     input  logic       clk,              // 100 MHz system clock
     input  logic       rst_n,            // Active-low reset (BTN)
 
     // I2C Bus
-    input  logic       scl,              // I2C clock from master
+    inout  logic       scl,              // I2C clock (stretched by slave)
     inout  logic       sda,              // I2C data (bidirectional)
 
     // External I/O
@@ -35,16 +39,19 @@ module i2c_slave_top (
     logic       reg_wen;
     logic       reg_ren;
     logic [7:0] reg_rdata;
-
-    //==========================================================================
-    // I2C Slave Address Configuration
-    //==========================================================================
-    localparam logic [6:0] SLAVE_ADDR = 7'h55;
+    logic       reg_ready;
+    logic       reg_commit;
+    logic       pec_error;
+    logic       reg_abort;
+    logic       pec_en;
+    logic [2:0] pec_rd_len;
 
     //==========================================================================
     // I2C Protocol Engine
     //==========================================================================
-    i2c_slave_protocol protocol (
+    i2c_slave_protocol #(
+        .STRETCH_TIMEOUT(STRETCH_TIMEOUT)
+    ) protocol (
         .clk(clk),
         .rst_n(rst_n),
         .slave_addr(SLAVE_ADDR),
@@ -52,7 +59,13 @@ module i2c_slave_top (
         .reg_wdata(reg_wdata),
         .reg_wen(reg_wen),
         .reg_ren(reg_ren),
+        .reg_commit(reg_commit),
         .reg_rdata(reg_rdata),
+        .reg_ready(reg_ready),
+        .pec_en(pec_en),
+        .pec_rd_len(pec_rd_len),
+        .pec_error(pec_error),
+        .reg_abort(reg_abort),
         .scl(scl),
         .sda(sda),
         .debug_addr_match(debug_addr_match),
@@ -62,14 +75,22 @@ module i2c_slave_top (
     //==========================================================================
     // Register Map (LED/FND Control)
     //==========================================================================
-    slave_register_map registers (
+    slave_register_map #(
+        .ACCESS_LATENCY(ACCESS_LATENCY)
+    ) registers (
         .clk(clk),
         .rst_n(rst_n),
         .reg_addr(reg_addr),
         .reg_wdata(reg_wdata),
         .reg_wen(reg_wen),
         .reg_ren(reg_ren),
+        .reg_commit(reg_commit),
+        .pec_error(pec_error),
+        .reg_abort(reg_abort),
         .reg_rdata(reg_rdata),
+        .reg_ready(reg_ready),
+        .pec_en(pec_en),
+        .pec_rd_len(pec_rd_len),
         .SW(SW),
         .LED(LED),
         .SEG(SEG),
@@ -4,6 +4,9 @@
 // Testbench for I2C Slave Top (Register-mapped)
 //==============================================================================
 // Tests register-mapped I2C slave with LED/FND control
+// A second instance (0x56) with a slow back end checks clock stretching,
+// a third (0x57) with a back end slower than STRETCH_TIMEOUT checks that a
+// write that was never accepted NACKs the next byte and is dropped
 //==============================================================================
 
 module i2c_slave_top_tb;
@@ -15,6 +18,11 @@ module i2c_slave_top_tb;
     localparam CLK_PER_BIT  = 250;      // Quarter bit period
     localparam HALF_PERIOD  = 500;      // Half SCL period
     localparam SLAVE_ADDR   = 7'h55;
+    localparam SLOW_ADDR    = 7'h56;    // Slow back end instance
+    localparam SLOW_LATENCY = 1000;     // 10 us > SCL low phase (5 us)
+    localparam STUCK_ADDR   = 7'h57;    // Back end slower than the timeout
+    localparam STUCK_LATENCY = 5000;    // 50 us
+    localparam STUCK_TIMEOUT = 2000;    // 20 us stretch limit
 
     // Register addresses
     localparam [7:0] ADDR_SW_DATA  = 8'h00;
@@ -22,12 +30,18 @@ module i2c_slave_top_tb;
     localparam [7:0] ADDR_LED_HIGH = 8'h02;
     localparam [7:0] ADDR_FND_DATA = 8'h03;
 
+    // Atomic alias registers
+    localparam [7:0] ADDR_LED_LOW_SET    = 8'h11;
+    localparam [7:0] ADDR_FND_DATA_SET   = 8'h13;
+    localparam [7:0] ADDR_LED_HIGH_CLR   = 8'h22;
+    localparam [7:0] ADDR_LED_LOW_TOGGLE = 8'h31;
+
     //==========================================================================
     // Signals
     //==========================================================================
     logic       clk;
     logic       rst_n;
-    logic       scl;
+    tri1        scl;                    // Open-drain with pull-up
     wire        sda;
     logic [15:0] SW;
     logic [15:0] LED;
@@ -35,6 +49,8 @@ module i2c_slave_top_tb;
     logic [3:0]  AN;
     logic       debug_addr_match;
     logic [3:0] debug_state;
+    logic [15:0] LED_slow;
+    logic [15:0] LED_stuck;
 
     // Master simulator
     logic       master_scl;
@@ -44,11 +60,21 @@ module i2c_slave_top_tb;
     // Test control
     int         test_pass;
     int         test_fail;
+    logic [6:0] target_addr;
+
+    // Output change monitor (burst commit)
+    time        led_change_time;
+    time        seg_change_time;
+    time        stop_time;
+
+    // Clock stretch monitor
+    time        scl_fall_time;
+    time        max_scl_low;
 
     //==========================================================================
     // I2C Bus
     //==========================================================================
-    assign scl = master_scl;
+    assign scl = master_scl ? 1'bz : 1'b0;
     assign sda = master_sda_oe ? master_sda_out : 1'bz;
 
     //==========================================================================
@@ -67,6 +93,51 @@ module i2c_slave_top_tb;
         .debug_state(debug_state)
     );
 
+    i2c_slave_top #(
+        .SLAVE_ADDR(SLOW_ADDR),
+        .ACCESS_LATENCY(SLOW_LATENCY)
+    ) dut_slow (
+        .clk(clk),
+        .rst_n(rst_n),
+        .scl(scl),
+        .sda(sda),
+        .SW(SW),
+        .LED(LED_slow),
+        .SEG(),
+        .AN(),
+        .debug_addr_match(),
+        .debug_state()
+    );
+
+    i2c_slave_top #(
+        .SLAVE_ADDR(STUCK_ADDR),
+        .ACCESS_LATENCY(STUCK_LATENCY),
+        .STRETCH_TIMEOUT(STUCK_TIMEOUT)
+    ) dut_stuck (
+        .clk(clk),
+        .rst_n(rst_n),
+        .scl(scl),
+        .sda(sda),
+        .SW(SW),
+        .LED(LED_stuck),
+        .SEG(),
+        .AN(),
+        .debug_addr_match(),
+        .debug_state()
+    );
+
+    //==========================================================================
+    // Clock Stretch Monitor (longest SCL low period)
+    //==========================================================================
+    always @(LED) led_change_time = $time;
+    always @(SEG) seg_change_time = $time;
+
+    always @(negedge scl) scl_fall_time = $time;
+    always @(posedge scl) begin
+        if (rst_n && ($time - scl_fall_time) > max_scl_low)
+            max_scl_low = $time - scl_fall_time;
+    end
+
     //==========================================================================
     // Clock
     //==========================================================================
@@ -86,6 +157,9 @@ module i2c_slave_top_tb;
 
         test_pass = 0;
         test_fail = 0;
+        target_addr = SLAVE_ADDR;
+        max_scl_low = 0;
+        scl_fall_time = 0;
 
         // Initialize
         rst_n = 0;
@@ -153,6 +227,118 @@ module i2c_slave_top_tb;
 
         repeat(200) @(posedge clk);
 
+        $display("\n[%0t] === Test 6: Clock Stretching (slow back end) ===", $time);
+        target_addr = SLOW_ADDR;
+        max_scl_low = 0;
+        test_write_reg(ADDR_LED_LOW, 8'h5A);
+        repeat(100) @(posedge clk);
+        if (LED_slow[7:0] == 8'h5A) begin
+            $display("  ✓ Slow LED[7:0] = 0x5A");
+            test_pass++;
+        end else begin
+            $display("  ✗ Slow LED[7:0] != 0x5A (got 0x%02h)", LED_slow[7:0]);
+            test_fail++;
+        end
+        test_read_reg(ADDR_LED_LOW, 8'h5A);
+        if (max_scl_low > SLOW_LATENCY * CLK_PERIOD) begin
+            $display("  ✓ SCL stretched (longest low = %0t)", max_scl_low);
+            test_pass++;
+        end else begin
+            $display("  ✗ No stretch seen (longest low = %0t)", max_scl_low);
+            test_fail++;
+        end
+        target_addr = SLAVE_ADDR;
+
+        repeat(200) @(posedge clk);
+
+        $display("\n[%0t] === Test 7: Atomic SET/CLR/TOGGLE ===", $time);
+        // LED = 0x3412, FND = 0x05 from earlier tests
+        test_write_reg(ADDR_LED_LOW_SET, 8'h81);       // 0x12 | 0x81 = 0x93
+        test_write_reg(ADDR_LED_HIGH_CLR, 8'h30);      // 0x34 & ~0x30 = 0x04
+        test_write_reg(ADDR_LED_LOW_TOGGLE, 8'hFF);    // 0x93 ^ 0xFF = 0x6C
+        test_write_reg(ADDR_FND_DATA_SET, 8'h02);      // 0x05 | 0x02 = 0x07
+        repeat(100) @(posedge clk);
+        if (LED == 16'h046C) begin
+            $display("  ✓ LED = 0x046C");
+            test_pass++;
+        end else begin
+            $display("  ✗ LED != 0x046C (got 0x%04h)", LED);
+            test_fail++;
+        end
+        test_read_reg(ADDR_FND_DATA, 8'h07);
+        test_read_reg(ADDR_LED_LOW_TOGGLE, 8'h6C);     // Alias reads target
+
+        repeat(200) @(posedge clk);
+
+        $display("\n[%0t] === Test 8: Burst Write (auto-increment, commit at STOP) ===", $time);
+        begin
+            logic [7:0] burst [3] = '{8'hC3, 8'h5A, 8'h09};
+            logic [7:0] rd    [4];
+            test_write_burst(ADDR_LED_LOW, burst, 3);
+            repeat(100) @(posedge clk);
+            if (LED == 16'h5AC3) begin
+                $display("  ✓ LED = 0x5AC3");
+                test_pass++;
+            end else begin
+                $display("  ✗ LED != 0x5AC3 (got 0x%04h)", LED);
+                test_fail++;
+            end
+            if (led_change_time == seg_change_time && led_change_time >= stop_time) begin
+                $display("  ✓ LED and FND changed together at STOP");
+                test_pass++;
+            end else begin
+                $display("  ✗ Outputs not committed together (LED %0t, SEG %0t, STOP %0t)",
+                         led_change_time, seg_change_time, stop_time);
+                test_fail++;
+            end
+
+            $display("\n[%0t] === Test 9: Burst Read (auto-increment) ===", $time);
+            test_read_burst(ADDR_SW_DATA, rd, 4);
+            if (rd[0] == SW[7:0] && rd[1] == 8'hC3 && rd[2] == 8'h5A && rd[3] == 8'h09) begin
+                $display("  ✓ Read 0x00-0x03: %02h %02h %02h %02h", rd[0], rd[1], rd[2], rd[3]);
+                test_pass++;
+            end else begin
+                $display("  ✗ Read 0x00-0x03: %02h %02h %02h %02h", rd[0], rd[1], rd[2], rd[3]);
+                test_fail++;
+            end
+        end
+
+        repeat(200) @(posedge clk);
+
+        $display("\n[%0t] === Test 10: Stretch Timeout on Write (stuck back end) ===", $time);
+        begin
+            bit ack0, ack1;
+
+            i2c_start();
+            i2c_send_byte({STUCK_ADDR, 1'b0});
+            i2c_receive_ack(ack0);
+            i2c_send_byte(ADDR_LED_LOW);
+            i2c_receive_ack(ack0);
+            i2c_send_byte(8'hA5);                   // ACKed, then never accepted
+            i2c_receive_ack(ack0);
+            i2c_send_byte(8'h5A);                   // Engine waits for STOP
+            i2c_receive_ack(ack1);
+            i2c_stop();
+            repeat(STUCK_LATENCY) @(posedge clk);
+
+            if (ack0 && !ack1) begin
+                $display("  ✓ Byte after the timed-out write NACKed");
+                test_pass++;
+            end else begin
+                $display("  ✗ ACKs after timeout: data %0b, next %0b", ack0, ack1);
+                test_fail++;
+            end
+            if (LED_stuck == 16'h0000) begin
+                $display("  ✓ Burst dropped at STOP (LED = 0x0000)");
+                test_pass++;
+            end else begin
+                $display("  ✗ Burst applied after timeout (LED = 0x%04h)", LED_stuck);
+                test_fail++;
+            end
+        end
+
+        repeat(200) @(posedge clk);
+
         // Summary
         $display("\n========================================");
         $display("Test Summary:");
@@ -173,12 +359,20 @@ module i2c_slave_top_tb;
     // Master Simulator Tasks
     //==========================================================================
 
+    // Release SCL and wait while a slave stretches it
+    task scl_release();
+        begin
+            master_scl = 1;
+            wait (scl === 1'b1);
+        end
+    endtask
+
     task i2c_start();
         begin
             $display("  [%0t] START", $time);
             master_sda_oe = 1;
             master_sda_out = 1;
-            master_scl = 1;
+            scl_release();
             repeat(HALF_PERIOD) @(posedge clk);
 
             master_sda_out = 0;
@@ -197,10 +391,11 @@ module i2c_slave_top_tb;
             master_scl = 0;
             repeat(HALF_PERIOD) @(posedge clk);
 
-            master_scl = 1;
+            scl_release();
             repeat(HALF_PERIOD) @(posedge clk);
 
             master_sda_out = 1;
+            stop_time = $time;
             repeat(HALF_PERIOD) @(posedge clk);
 
             master_sda_oe = 0;
@@ -216,7 +411,7 @@ module i2c_slave_top_tb;
             repeat(CLK_PER_BIT) @(posedge clk);
             repeat(CLK_PER_BIT) @(posedge clk);
 
-            master_scl = 1;
+            scl_release();
             repeat(CLK_PER_BIT) @(posedge clk);
             repeat(CLK_PER_BIT) @(posedge clk);
         end
@@ -238,7 +433,7 @@ module i2c_slave_top_tb;
             repeat(CLK_PER_BIT) @(posedge clk);
             repeat(CLK_PER_BIT) @(posedge clk);
 
-            master_scl = 1;
+            scl_release();
             repeat(CLK_PER_BIT/2) @(posedge clk);
             ack = ~sda;
             repeat(CLK_PER_BIT/2) @(posedge clk);
@@ -248,15 +443,16 @@ module i2c_slave_top_tb;
 
     task i2c_receive_byte(output [7:0] data);
         begin
-            master_sda_oe = 0;
             data = 8'h00;
 
             for (int i = 7; i >= 0; i--) begin
                 master_scl = 0;
-                repeat(CLK_PER_BIT) @(posedge clk);
+                repeat(2) @(posedge clk);
+                master_sda_oe = 0;      // Release (after a master ACK) with SCL low
+                repeat(CLK_PER_BIT - 2) @(posedge clk);
                 repeat(CLK_PER_BIT) @(posedge clk);
 
-                master_scl = 1;
+                scl_release();
                 repeat(CLK_PER_BIT/2) @(posedge clk);
                 data[i] = sda;
                 repeat(CLK_PER_BIT/2) @(posedge clk);
@@ -265,6 +461,22 @@ module i2c_slave_top_tb;
         end
     endtask
 
+    task i2c_send_ack();
+        begin
+            master_sda_oe = 1;
+            master_sda_out = 0;
+
+            master_scl = 0;
+            repeat(CLK_PER_BIT) @(posedge clk);
+            repeat(CLK_PER_BIT) @(posedge clk);
+
+            scl_release();
+            repeat(CLK_PER_BIT) @(posedge clk);
+            repeat(CLK_PER_BIT) @(posedge clk);
+            // Keep SDA low until SCL falls (next i2c_receive_byte releases it)
+        end
+    endtask
+
     task i2c_send_nack();
         begin
             master_sda_oe = 1;
@@ -274,7 +486,7 @@ module i2c_slave_top_tb;
             repeat(CLK_PER_BIT) @(posedge clk);
             repeat(CLK_PER_BIT) @(posedge clk);
 
-            master_scl = 1;
+            scl_release();
             repeat(CLK_PER_BIT) @(posedge clk);
             repeat(CLK_PER_BIT) @(posedge clk);
 
@@ -294,7 +506,7 @@ module i2c_slave_top_tb;
             i2c_start();
 
             // Device address + Write
-            i2c_send_byte({SLAVE_ADDR, 1'b0});
+            i2c_send_byte({target_addr, 1'b0});
             i2c_receive_ack(ack);
             if (!ack) $display("  ✗ No ACK for device addr");
 
@@ -321,7 +533,7 @@ module i2c_slave_top_tb;
             i2c_start();
 
             // Device address + Write
-            i2c_send_byte({SLAVE_ADDR, 1'b0});
+            i2c_send_byte({target_addr, 1'b0});
             i2c_receive_ack(ack);
 
             // Register address
@@ -332,7 +544,7 @@ module i2c_slave_top_tb;
             i2c_start();
 
             // Device address + Read
-            i2c_send_byte({SLAVE_ADDR, 1'b1});
+            i2c_send_byte({target_addr, 1'b1});
             i2c_receive_ack(ack);
 
             // Read data
@@ -351,6 +563,52 @@ module i2c_slave_top_tb;
         end
     endtask
 
+    task test_write_burst(input [7:0] reg_addr, input logic [7:0] data [3], input int n);
+        bit ack;
+        begin
+            $display("  Burst write: Reg[0x%02h..] x %0d", reg_addr, n);
+
+            i2c_start();
+            i2c_send_byte({target_addr, 1'b0});
+            i2c_receive_ack(ack);
+            i2c_send_byte(reg_addr);
+            i2c_receive_ack(ack);
+
+            for (int i = 0; i < n; i++) begin
+                i2c_send_byte(data[i]);
+                i2c_receive_ack(ack);
+                if (!ack) $display("  ✗ No ACK for byte %0d", i);
+            end
+
+            i2c_stop();
+        end
+    endtask
+
+    task test_read_burst(input [7:0] reg_addr, output logic [7:0] data [4], input int n);
+        bit ack;
+        begin
+            $display("  Burst read: Reg[0x%02h..] x %0d", reg_addr, n);
+
+            i2c_start();
+            i2c_send_byte({target_addr, 1'b0});
+            i2c_receive_ack(ack);
+            i2c_send_byte(reg_addr);
+            i2c_receive_ack(ack);
+
+            i2c_start();
+            i2c_send_byte({target_addr, 1'b1});
+            i2c_receive_ack(ack);
+
+            for (int i = 0; i < n; i++) begin
+                i2c_receive_byte(data[i]);
+                if (i == n - 1) i2c_send_nack();
+                else            i2c_send_ack();
+            end
+
+            i2c_stop();
+        end
+    endtask
+
     //==========================================================================
     // Waveform
     //==========================================================================
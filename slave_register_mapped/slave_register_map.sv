@@ -9,9 +9,38 @@
 //   0x01: LED_LOW   (Read/Write) - LED[7:0]
 //   0x02: LED_HIGH  (Read/Write) - LED[15:8]
 //   0x03: FND_DATA  (Read/Write) - FND display data
+//   0x04: PEC_CTRL  (Read/Write) - [0] SMBus PEC enable, [6:4] read bytes-1
+//                                  before the slave appends PEC,
+//                                  [7] clear PEC_STAT/PEC_ERRS (reads 0)
+//   0x05: PEC_STAT  (Read-only)  - [0] last checked write failed,
+//                                  [1] sticky error since clear
+//   0x06: PEC_ERRS  (Read-only)  - Bad-PEC write counter (saturates at 0xFF)
+//
+// Double buffering:
+//   Writes land in shadow registers (marked dirty); reg_commit (STOP) copies
+//   every dirty shadow to the outputs in the same cycle, so a burst such
+//   as LED_LOW, LED_HIGH, FND_DATA changes all outputs together.
+//   Reads always return the live (output) value.
+//   pec_error (bad PEC at STOP) drops every dirty shadow instead, so a
+//   corrupted burst never reaches the outputs. reg_abort (a write the back
+//   end did not accept in time) drops them the same way.
+//
+// Atomic bit aliases (write = read-modify-write on the shadow, read = target):
+//   0x11-0x13: *_SET    - target |=  data
+//   0x21-0x23: *_CLR    - target &= ~data
+//   0x31-0x33: *_TOGGLE - target ^=  data
+//   e.g. 0x21 = LED_LOW_CLR, 0x33 = FND_DATA_TOGGLE
+//
+// Access timing:
+//   reg_rdata is registered on reg_ren (no combinational path from
+//   reg_addr to the protocol engine) and reg_ready pulses ACCESS_LATENCY
+//   cycles after reg_ren / reg_wen. The protocol engine stretches SCL
+//   until then, so slower back ends only need a larger ACCESS_LATENCY.
 //==============================================================================
 
-module slave_register_map (
+module slave_register_map #(
+    parameter int ACCESS_LATENCY = 1          // reg_ren/wen -> reg_ready (>= 1)
+)(
     input  logic       clk,
     input  logic       rst_n,
 
@@ -20,7 +49,15 @@ module slave_register_map (
     input  logic [7:0] reg_wdata,
     input  logic       reg_wen,
     input  logic       reg_ren,
+    input  logic       reg_commit,    // Apply shadow registers (STOP)
+    input  logic       pec_error,     // Bad PEC at STOP: drop shadow, count
+    input  logic       reg_abort,     // Write timed out: drop shadow
     output logic [7:0] reg_rdata,
+    output logic       reg_ready,     // Pulse: read data valid / write done
+
+    // PEC configuration to protocol
+    output logic       pec_en,        // PEC_CTRL[0]
+    output logic [2:0] pec_rd_len,    // PEC_CTRL[6:4]
 
     // External I/O
     input  logic [15:0] SW,           // Switch input
@@ -36,30 +73,111 @@ module slave_register_map (
     localparam logic [7:0] ADDR_LED_LOW  = 8'h01;
     localparam logic [7:0] ADDR_LED_HIGH = 8'h02;
     localparam logic [7:0] ADDR_FND_DATA = 8'h03;
+    localparam logic [7:0] ADDR_PEC_CTRL = 8'h04;
+    localparam logic [7:0] ADDR_PEC_STAT = 8'h05;
+    localparam logic [7:0] ADDR_PEC_ERRS = 8'h06;
+
+    // Alias blocks: reg_addr[7:4] = operation, reg_addr[3:0] = target
+    localparam logic [3:0] OP_WRITE  = 4'h0;
+    localparam logic [3:0] OP_SET    = 4'h1;
+    localparam logic [3:0] OP_CLR    = 4'h2;
+    localparam logic [3:0] OP_TOGGLE = 4'h3;
 
     //==========================================================================
     // Internal Registers
     //==========================================================================
     logic [15:0] led_reg;
     logic [7:0]  fnd_data_reg;
+    logic [7:0]  pec_ctrl_reg;
+
+    // Shadow (burst) registers
+    logic [15:0] led_shadow;
+    logic [7:0]  fnd_shadow;
+    logic [7:0]  pec_ctrl_shadow;
+    logic [3:0]  dirty;           // {PEC_CTRL, FND_DATA, LED_HIGH, LED_LOW}
+    logic [7:0]  led_low_cur;     // Shadow if dirty, else live
+    logic [7:0]  led_high_cur;
+    logic [7:0]  fnd_cur;
+    logic [7:0]  pec_ctrl_cur;
+
+    // PEC error status
+    logic        pec_last_err;
+    logic        pec_sticky_err;
+    logic [7:0]  pec_err_cnt;
+    logic [7:0]  rdata_mux;
+    logic [7:0]  rdata_reg;
+
+    // Alias decode
+    logic [3:0]  reg_op;
+    logic [7:0]  reg_target;
+    logic        op_valid;
+
+    // Access latency counter
+    localparam int LAT_W = $clog2(ACCESS_LATENCY + 1);
+    logic [LAT_W-1:0] lat_cnt;
 
     //==========================================================================
     // LED Output
     //==========================================================================
     assign LED = led_reg;
 
+    assign pec_en     = pec_ctrl_reg[0];
+    assign pec_rd_len = pec_ctrl_reg[6:4];
+
     //==========================================================================
-    // Register Write
+    // Alias Decode
     //==========================================================================
+    assign reg_op     = reg_addr[7:4];
+    assign reg_target = {4'h0, reg_addr[3:0]};
+    assign op_valid   = (reg_op == OP_WRITE) || (reg_op == OP_SET) ||
+                        (reg_op == OP_CLR)   || (reg_op == OP_TOGGLE);
+
+    function automatic logic [7:0] apply_op(input logic [3:0] op,
+                                            input logic [7:0] cur,
+                                            input logic [7:0] data);
+        case (op)
+            OP_SET:    apply_op = cur | data;
+            OP_CLR:    apply_op = cur & ~data;
+            OP_TOGGLE: apply_op = cur ^ data;
+            default:   apply_op = data;
+        endcase
+    endfunction
+
+    //==========================================================================
+    // Register Write (into shadow)
+    //==========================================================================
+    // Later writes in the same burst build on earlier ones
+    assign led_low_cur  = dirty[0] ? led_shadow[7:0]  : led_reg[7:0];
+    assign led_high_cur = dirty[1] ? led_shadow[15:8] : led_reg[15:8];
+    assign fnd_cur      = dirty[2] ? fnd_shadow       : fnd_data_reg;
+    assign pec_ctrl_cur = dirty[3] ? pec_ctrl_shadow  : pec_ctrl_reg;
+
     always_ff @(posedge clk or negedge rst_n) begin
         if (!rst_n) begin
-            led_reg      <= 16'h0000;
-            fnd_data_reg <= 8'h00;
-        end else if (reg_wen) begin
-            case (reg_addr)
-                ADDR_LED_LOW:  led_reg[7:0]  <= reg_wdata;
-                ADDR_LED_HIGH: led_reg[15:8] <= reg_wdata;
-                ADDR_FND_DATA: fnd_data_reg  <= reg_wdata;
+            led_shadow      <= 16'h0000;
+            fnd_shadow      <= 8'h00;
+            pec_ctrl_shadow <= 8'h00;
+            dirty           <= 4'b0000;
+        end else if (reg_commit || pec_error || reg_abort) begin
+            dirty           <= 4'b0000;
+        end else if (reg_wen && op_valid) begin
+            case (reg_target)
+                ADDR_LED_LOW: begin
+                    led_shadow[7:0]  <= apply_op(reg_op, led_low_cur, reg_wdata);
+                    dirty[0]         <= 1'b1;
+                end
+                ADDR_LED_HIGH: begin
+                    led_shadow[15:8] <= apply_op(reg_op, led_high_cur, reg_wdata);
+                    dirty[1]         <= 1'b1;
+                end
+                ADDR_FND_DATA: begin
+                    fnd_shadow       <= apply_op(reg_op, fnd_cur, reg_wdata);
+                    dirty[2]         <= 1'b1;
+                end
+                ADDR_PEC_CTRL: begin
+                    pec_ctrl_shadow  <= apply_op(reg_op, pec_ctrl_cur, reg_wdata);
+                    dirty[3]         <= 1'b1;
+                end
                 default: begin
                     // No write to read-only registers
                 end
@@ -68,18 +186,88 @@ module slave_register_map (
     end
 
     //==========================================================================
-    // Register Read
+    // Commit (shadow -> outputs, all in one cycle)
+    //==========================================================================
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            led_reg      <= 16'h0000;
+            fnd_data_reg <= 8'h00;
+            pec_ctrl_reg <= 8'h00;
+        end else if (reg_commit) begin
+            if (dirty[0]) led_reg[7:0]  <= led_shadow[7:0];
+            if (dirty[1]) led_reg[15:8] <= led_shadow[15:8];
+            if (dirty[2]) fnd_data_reg  <= fnd_shadow;
+            if (dirty[3]) pec_ctrl_reg  <= {1'b0, pec_ctrl_shadow[6:0]};
+        end
+    end
+
+    //==========================================================================
+    // PEC Error Status
+    //==========================================================================
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            pec_last_err   <= 1'b0;
+            pec_sticky_err <= 1'b0;
+            pec_err_cnt    <= 8'h00;
+        end else if (pec_error) begin
+            pec_last_err   <= 1'b1;
+            pec_sticky_err <= 1'b1;
+            if (pec_err_cnt != 8'hFF) pec_err_cnt <= pec_err_cnt + 1;
+        end else if (reg_commit) begin
+            pec_last_err   <= 1'b0;
+            if (dirty[3] && pec_ctrl_shadow[7]) begin
+                pec_sticky_err <= 1'b0;
+                pec_err_cnt    <= 8'h00;
+            end
+        end
+    end
+
+    //==========================================================================
+    // Register Read (registered on reg_ren)
     //==========================================================================
     always_comb begin
-        case (reg_addr)
-            ADDR_SW_DATA:  reg_rdata = SW[7:0];        // Switch input
-            ADDR_LED_LOW:  reg_rdata = led_reg[7:0];
-            ADDR_LED_HIGH: reg_rdata = led_reg[15:8];
-            ADDR_FND_DATA: reg_rdata = fnd_data_reg;
-            default:       reg_rdata = 8'h00;
+        case (op_valid ? reg_target : 8'hFF)
+            ADDR_SW_DATA:  rdata_mux = SW[7:0];        // Switch input
+            ADDR_LED_LOW:  rdata_mux = led_reg[7:0];
+            ADDR_LED_HIGH: rdata_mux = led_reg[15:8];
+            ADDR_FND_DATA: rdata_mux = fnd_data_reg;
+            ADDR_PEC_CTRL: rdata_mux = pec_ctrl_reg;
+            ADDR_PEC_STAT: rdata_mux = {6'h00, pec_sticky_err, pec_last_err};
+            ADDR_PEC_ERRS: rdata_mux = pec_err_cnt;
+            default:       rdata_mux = 8'h00;
         endcase
     end
 
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            rdata_reg <= 8'h00;
+        end else if (reg_ren) begin
+            rdata_reg <= rdata_mux;
+        end
+    end
+
+    assign reg_rdata = rdata_reg;
+
+    //==========================================================================
+    // Ready Handshake
+    //==========================================================================
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            lat_cnt   <= '0;
+            reg_ready <= 1'b0;
+        end else begin
+            reg_ready <= 1'b0;  // Pulse
+
+            if (reg_ren || reg_wen) begin
+                if (ACCESS_LATENCY <= 1) reg_ready <= 1'b1;
+                else                     lat_cnt   <= LAT_W'(ACCESS_LATENCY - 1);
+            end else if (lat_cnt != 0) begin
+                lat_cnt <= lat_cnt - 1;
+                if (lat_cnt == 1) reg_ready <= 1'b1;
+            end
+        end
+    end
+
     //==========================================================================
     // 7-Segment Display Controller
     //==========================================================================
@@ -0,0 +1,301 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// SPI Slave Protocol Engine
+//==============================================================================
+// Alternate transport for slave_register_map (same reg_* interface as
+// i2c_slave_protocol), for refresh paths where I2C is the bottleneck
+// Features:
+//  - SPI mode 0 (CPOL=0, CPHA=0), MSB first, CS_N active low
+//  - Write: [0x02][REG_ADDR][DATA][DATA]...
+//  - Read:  [0x03][REG_ADDR][DUMMY][DATA][DATA]...
+//  - Auto-increment: reg_addr advances after every data byte
+//  - reg_commit pulses when CS_N rises after writes (same role as STOP)
+//  - Unknown command: rest of the frame is ignored, MISO stays released
+//
+// Timing (100 MHz clk, SCK/MOSI/CS_N sampled through 2-FF synchronizers):
+//  - SCK high and low phases must each be >= 4 clk (SCK <= 12.5 MHz)
+//  - SPI cannot stretch the clock: read data is fetched one byte ahead
+//    (the dummy byte covers the first fetch), so the back end must answer
+//    reg_ren within 8 SCK periods (ACCESS_LATENCY < 64 clk at 12.5 MHz)
+//  - MISO changes on the falling SCK edge; master samples late in the
+//    high phase
+//==============================================================================
+
+module spi_slave_protocol (
+    // Global signals
+    input  logic       clk,              // 100 MHz system clock
+    input  logic       rst_n,            // Active-low reset
+
+    // Register interface
+    output logic [7:0] reg_addr,         // Register address
+    output logic [7:0] reg_wdata,        // Write data
+    output logic       reg_wen,          // Write enable (1 clk pulse)
+    output logic       reg_ren,          // Read enable (1 clk pulse)
+    output logic       reg_commit,       // CS_N rise after writes (1 clk pulse)
+    input  logic [7:0] reg_rdata,        // Read data
+    input  logic       reg_ready,        // Read data valid / write accepted
+
+    // SPI bus
+    input  logic       sck,
+    input  logic       mosi,
+    output logic       miso,             // High-Z while CS_N is high
+    input  logic       cs_n,
+
+    // Debug
+    output logic       debug_addr_match, // Frame in progress
+    output logic [3:0] debug_state
+);
+
+    //==========================================================================
+    // Commands
+    //==========================================================================
+    localparam logic [7:0] CMD_WRITE = 8'h02;
+    localparam logic [7:0] CMD_READ  = 8'h03;
+
+    //==========================================================================
+    // FSM States
+    //==========================================================================
+    typedef enum logic [3:0] {
+        IDLE      = 4'd0,    // CS_N high
+        RX_CMD    = 4'd1,    // Receive command byte
+        RX_REG    = 4'd2,    // Receive register address
+        RX_DATA   = 4'd3,    // Receive write data
+        RD_DUMMY  = 4'd4,    // Dummy byte while the first read is fetched
+        TX_DATA   = 4'd5,    // Transmit read data
+        SKIP      = 4'd6     // Unknown command, wait for CS_N high
+    } state_t;
+
+    //==========================================================================
+    // Internal Signals
+    //==========================================================================
+    state_t state, state_next;
+
+    // SCK/MOSI/CS_N synchronization
+    logic [2:0] sck_sync;
+    logic [1:0] mosi_sync;
+    logic [1:0] cs_sync;
+    logic       sck_rising_edge;
+    logic       sck_falling_edge;
+    logic       mosi_in;
+    logic       cs_active;
+
+    // Data registers
+    logic [7:0] cmd_reg, cmd_next;
+    logic [7:0] reg_addr_reg, reg_addr_next;
+    logic [7:0] rx_shift, rx_shift_next;
+    logic [7:0] tx_shift, tx_shift_next;
+    logic [2:0] bit_count, bit_count_next;
+    logic [7:0] rx_byte;                         // Byte completed this edge
+
+    // MISO control
+    logic       miso_out, miso_out_next;
+    logic       miso_oe, miso_oe_next;
+
+    // Register interface
+    logic       reg_wen_reg, reg_wen_next;
+    logic       reg_ren_reg, reg_ren_next;
+    logic       reg_commit_reg, reg_commit_next;
+    logic       wr_pending, wr_pending_next;     // Writes since CS_N fell
+    logic       wr_busy, wr_busy_next;           // Waiting for reg_ready
+
+    //==========================================================================
+    // Output Assignments
+    //==========================================================================
+    assign miso = miso_oe ? miso_out : 1'bz;
+
+    assign reg_addr   = reg_addr_reg;
+    assign reg_wdata  = rx_shift;
+    assign reg_wen    = reg_wen_reg;
+    assign reg_ren    = reg_ren_reg;
+    assign reg_commit = reg_commit_reg;
+
+    assign debug_addr_match = (state != IDLE) && (state != SKIP);
+    assign debug_state      = state;
+
+    //==========================================================================
+    // Synchronization
+    //==========================================================================
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            sck_sync  <= 3'b000;     // Mode 0: SCK idles low
+            mosi_sync <= 2'b00;
+            cs_sync   <= 2'b11;
+        end else begin
+            sck_sync  <= {sck_sync[1:0], sck};
+            mosi_sync <= {mosi_sync[0], mosi};
+            cs_sync   <= {cs_sync[0], cs_n};
+        end
+    end
+
+    // mosi_sync[1] lines up with sck_sync[2:1] edge detection
+    assign sck_rising_edge  = (sck_sync[2:1] == 2'b01);
+    assign sck_falling_edge = (sck_sync[2:1] == 2'b10);
+    assign mosi_in          = mosi_sync[1];
+    assign cs_active        = ~cs_sync[1];
+    assign rx_byte          = {rx_shift[6:0], mosi_in};
+
+    //==========================================================================
+    // Sequential Logic
+    //==========================================================================
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            state          <= IDLE;
+            cmd_reg        <= 8'd0;
+            reg_addr_reg   <= 8'd0;
+            rx_shift       <= 8'd0;
+            tx_shift       <= 8'd0;
+            bit_count      <= 3'd0;
+            miso_out       <= 1'b1;
+            miso_oe        <= 1'b0;
+            reg_wen_reg    <= 1'b0;
+            reg_ren_reg    <= 1'b0;
+            reg_commit_reg <= 1'b0;
+            wr_pending     <= 1'b0;
+            wr_busy        <= 1'b0;
+        end else begin
+            state          <= state_next;
+            cmd_reg        <= cmd_next;
+            reg_addr_reg   <= reg_addr_next;
+            rx_shift       <= rx_shift_next;
+            tx_shift       <= tx_shift_next;
+            bit_count      <= bit_count_next;
+            miso_out       <= miso_out_next;
+            miso_oe        <= miso_oe_next;
+            reg_wen_reg    <= reg_wen_next;
+            reg_ren_reg    <= reg_ren_next;
+            reg_commit_reg <= reg_commit_next;
+            wr_pending     <= wr_pending_next;
+            wr_busy        <= wr_busy_next;
+        end
+    end
+
+    //==========================================================================
+    // Combinational FSM
+    //==========================================================================
+    always_comb begin
+        // Defaults
+        state_next      = state;
+        cmd_next        = cmd_reg;
+        reg_addr_next   = reg_addr_reg;
+        rx_shift_next   = rx_shift;
+        tx_shift_next   = tx_shift;
+        bit_count_next  = bit_count;
+        miso_out_next   = miso_out;
+        miso_oe_next    = miso_oe;
+        reg_wen_next    = 1'b0;  // Pulse
+        reg_ren_next    = 1'b0;  // Pulse
+        reg_commit_next = 1'b0;  // Pulse
+        wr_pending_next = wr_pending;
+        wr_busy_next    = wr_busy;
+
+        // Write accepted: next byte of the burst goes to the next register
+        if (wr_busy && reg_ready) begin
+            wr_busy_next  = 1'b0;
+            reg_addr_next = reg_addr_reg + 1;
+        end
+
+        if (!cs_active) begin
+            // CS_N high ends the frame (SPI counterpart of STOP)
+            state_next      = IDLE;
+            bit_count_next  = 3'd0;
+            miso_oe_next    = 1'b0;
+            reg_commit_next = wr_pending && (state != IDLE);
+            if (state != IDLE) wr_pending_next = 1'b0;
+        end else begin
+            // Byte framing shared by every state
+            if (sck_rising_edge) begin
+                rx_shift_next  = rx_byte;
+                bit_count_next = bit_count + 1;
+            end
+
+            case (state)
+                //==============================================================
+                // IDLE: CS_N just fell
+                //==============================================================
+                IDLE: begin
+                    bit_count_next = 3'd0;
+                    state_next     = RX_CMD;
+                end
+
+                //==============================================================
+                // RX_CMD: Command byte
+                //==============================================================
+                RX_CMD: begin
+                    if (sck_rising_edge && bit_count == 7) begin
+                        cmd_next   = rx_byte;
+                        state_next = (rx_byte == CMD_WRITE || rx_byte == CMD_READ) ?
+                                     RX_REG : SKIP;
+                    end
+                end
+
+                //==============================================================
+                // RX_REG: Register address (read: start first fetch now)
+                //==============================================================
+                RX_REG: begin
+                    if (sck_rising_edge && bit_count == 7) begin
+                        reg_addr_next = rx_byte;
+
+                        if (cmd_reg == CMD_READ) begin
+                            reg_ren_next = 1'b1;
+                            state_next   = RD_DUMMY;
+                        end else begin
+                            state_next   = RX_DATA;
+                        end
+                    end
+                end
+
+                //==============================================================
+                // RX_DATA: Write data, one register per byte
+                //==============================================================
+                RX_DATA: begin
+                    if (sck_rising_edge && bit_count == 7) begin
+                        reg_wen_next    = 1'b1;   // reg_wdata = rx_shift next cycle
+                        wr_pending_next = 1'b1;
+                        wr_busy_next    = 1'b1;
+                    end
+                end
+
+                //==============================================================
+                // RD_DUMMY: Turnaround byte, first fetch completes meanwhile
+                //==============================================================
+                RD_DUMMY: begin
+                    if (sck_rising_edge && bit_count == 7) begin
+                        state_next = TX_DATA;
+                    end
+                end
+
+                //==============================================================
+                // TX_DATA: Drive read data on falling SCK edges
+                //==============================================================
+                TX_DATA: begin
+                    if (sck_falling_edge) begin
+                        if (bit_count == 0) begin
+                            // Byte boundary: load fetched byte, prefetch next
+                            tx_shift_next = reg_rdata;
+                            miso_oe_next  = 1'b1;
+                            miso_out_next = reg_rdata[7];
+                            reg_addr_next = reg_addr_reg + 1;
+                            reg_ren_next  = 1'b1;
+                        end else begin
+                            tx_shift_next = {tx_shift[6:0], 1'b0};
+                            miso_out_next = tx_shift[6];
+                        end
+                    end
+                end
+
+                //==============================================================
+                // SKIP: Unknown command
+                //==============================================================
+                SKIP: begin
+                    miso_oe_next = 1'b0;
+                end
+
+                default: begin
+                    state_next = IDLE;
+                end
+            endcase
+        end
+    end
+
+endmodule
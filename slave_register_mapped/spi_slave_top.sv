@@ -0,0 +1,102 @@
+`timescale 1ns / 1ps
+
+//==============================================================================
+// SPI Slave Top Module
+//==============================================================================
+// Same register map as i2c_slave_top, reached over SPI (mode 0) instead of
+// I2C for high-rate LED/FND refresh
+// For Basys3 FPGA board
+//==============================================================================
+
+module spi_slave_top #(
+    parameter int ACCESS_LATENCY = 1       // Register map latency (clk)
+)(
+    // System
+    input  logic       clk,              // 100 MHz system clock
+    input  logic       rst_n,            // Active-low reset (BTN)
+
+    // SPI Bus
+    input  logic       sck,              // SPI clock (mode 0)
+    input  logic       mosi,             // Master out, slave in
+    output logic       miso,             // Master in, slave out (Z when idle)
+    input  logic       cs_n,             // Chip select (active low)
+
+    // External I/O
+    input  logic [15:0] SW,              // Switches
+    output logic [15:0] LED,             // LEDs
+    output logic [6:0]  SEG,             // 7-segment cathodes
+    output logic [3:0]  AN,              // 7-segment anodes
+
+    // Debug (optional - map to LEDs if needed)
+    output logic       debug_addr_match,
+    output logic [3:0] debug_state
+);
+
+    //==========================================================================
+    // Internal Signals - Protocol <-> Register Map
+    //==========================================================================
+    logic [7:0] reg_addr;
+    logic [7:0] reg_wdata;
+    logic       reg_wen;
+    logic       reg_ren;
+    logic [7:0] reg_rdata;
+    logic       reg_ready;
+    logic       reg_commit;
+    logic       pec_error;
+    logic       reg_abort;
+    logic       pec_en;
+    logic [2:0] pec_rd_len;
+
+    // SMBus PEC is I2C-only: SPI frames are never checked
+    assign pec_error = 1'b0;
+
+    // No stretch timeout on SPI: writes are always accepted
+    assign reg_abort = 1'b0;
+
+    //==========================================================================
+    // SPI Protocol Engine
+    //==========================================================================
+    spi_slave_protocol protocol (
+        .clk(clk),
+        .rst_n(rst_n),
+        .reg_addr(reg_addr),
+        .reg_wdata(reg_wdata),
+        .reg_wen(reg_wen),
+        .reg_ren(reg_ren),
+        .reg_commit(reg_commit),
+        .reg_rdata(reg_rdata),
+        .reg_ready(reg_ready),
+        .sck(sck),
+        .mosi(mosi),
+        .miso(miso),
+        .cs_n(cs_n),
+        .debug_addr_match(debug_addr_match),
+        .debug_state(debug_state)
+    );
+
+    //==========================================================================
+    // Register Map (LED/FND Control)
+    //==========================================================================
+    slave_register_map #(
+        .ACCESS_LATENCY(ACCESS_LATENCY)
+    ) registers (
+        .clk(clk),
+        .rst_n(rst_n),
+        .reg_addr(reg_addr),
+        .reg_wdata(reg_wdata),
+        .reg_wen(reg_wen),
+        .reg_ren(reg_ren),
+        .reg_commit(reg_commit),
+        .pec_error(pec_error),
+        .reg_abort(reg_abort),
+        .reg_rdata(reg_rdata),
+        .reg_ready(reg_ready),
+        .pec_en(pec_en),
+        .pec_rd_len(pec_rd_len),
+        .SW(SW),
+        .LED(LED),
+        .SEG(SEG),
+        .AN(AN)
+    );
+
+endmodule
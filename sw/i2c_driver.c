@@ -128,6 +128,11 @@ void i2c_slave_init(uint32_t base_addr, uint8_t slave_addr)
 
     // Initialize TX data to 0
     I2C_SLAVE_WRITE_REG(base_addr, I2C_SLAVE_TXDATA_REG, 0x00);
+
+    // Start with empty FIFOs and no pending interrupts
+    I2C_SLAVE_WRITE_REG(base_addr, I2C_SLAVE_CTRL_REG,
+                        I2C_SLAVE_CTRL_RX_FLUSH | I2C_SLAVE_CTRL_TX_FLUSH);
+    I2C_SLAVE_WRITE_REG(base_addr, I2C_SLAVE_ISR_REG, 0xF);
 }
 
 void i2c_slave_set_tx_data(uint32_t base_addr, uint8_t data)
@@ -137,15 +142,13 @@ void i2c_slave_set_tx_data(uint32_t base_addr, uint8_t data)
 
 bool i2c_slave_get_rx_data(uint32_t base_addr, uint8_t *data)
 {
-    uint32_t status;
-
-    // Check if new data available
-    status = I2C_SLAVE_READ_REG(base_addr, I2C_SLAVE_STAT_REG);
+    uint8_t tag;
 
-    if (status & I2C_SLAVE_STAT_DATA_VALID) {
-        // Read received data
-        *data = (uint8_t)(I2C_SLAVE_READ_REG(base_addr, I2C_SLAVE_RXDATA_REG) & 0xFF);
-        return true;
+    // Pop entries until a data byte, skipping START/STOP markers
+    while (i2c_slave_read_fifo(base_addr, data, &tag)) {
+        if (tag == I2C_SLAVE_TAG_DATA) {
+            return true;
+        }
     }
 
     return false;
@@ -156,3 +159,62 @@ bool i2c_slave_data_available(uint32_t base_addr)
     uint32_t status = I2C_SLAVE_READ_REG(base_addr, I2C_SLAVE_STAT_REG);
     return (status & I2C_SLAVE_STAT_DATA_VALID) != 0;
 }
+
+bool i2c_slave_read_fifo(uint32_t base_addr, uint8_t *data, uint8_t *tag)
+{
+    // One read pops one entry; VALID is clear if the FIFO was empty
+    uint32_t entry = I2C_SLAVE_READ_REG(base_addr, I2C_SLAVE_RXFIFO_REG);
+
+    if (!(entry & I2C_SLAVE_RXF_VALID)) {
+        return false;
+    }
+
+    *data = (uint8_t)I2C_SLAVE_RXF_DATA(entry);
+    *tag  = (uint8_t)I2C_SLAVE_RXF_TAG(entry);
+    return true;
+}
+
+int i2c_slave_write_tx_fifo(uint32_t base_addr, const uint8_t *data, int len)
+{
+    int i;
+
+    for (i = 0; i < len; i++) {
+        if (I2C_SLAVE_READ_REG(base_addr, I2C_SLAVE_STAT_REG) & I2C_SLAVE_STAT_TX_FULL) {
+            break;
+        }
+        I2C_SLAVE_WRITE_REG(base_addr, I2C_SLAVE_TXFIFO_REG, data[i]);
+    }
+
+    return i;
+}
+
+bool i2c_slave_read_frame(uint32_t base_addr, uint8_t *buf, int max_len, int *len)
+{
+    uint8_t data, tag;
+
+    while (i2c_slave_read_fifo(base_addr, &data, &tag)) {
+        if (tag == I2C_SLAVE_TAG_STOP) {
+            return true;
+        }
+        if (tag == I2C_SLAVE_TAG_DATA && *len < max_len) {
+            buf[(*len)++] = data;
+        }
+    }
+
+    return false;
+}
+
+void i2c_slave_enable_irq(uint32_t base_addr, uint32_t mask, uint8_t rx_threshold)
+{
+    I2C_SLAVE_WRITE_REG(base_addr, I2C_SLAVE_IER_REG,
+                        I2C_SLAVE_IER_THRESH(rx_threshold) | (mask & 0xF));
+}
+
+uint32_t i2c_slave_irq_ack(uint32_t base_addr)
+{
+    uint32_t isr = I2C_SLAVE_READ_REG(base_addr, I2C_SLAVE_ISR_REG);
+
+    // Sticky bits are write-1-to-clear; RX_THRESH follows the FIFO level
+    I2C_SLAVE_WRITE_REG(base_addr, I2C_SLAVE_ISR_REG, isr);
+    return isr;
+}
@@ -82,4 +82,47 @@ bool i2c_slave_get_rx_data(uint32_t base_addr, uint8_t *data);
  */
 bool i2c_slave_data_available(uint32_t base_addr);
 
+/**
+ * @brief Pop one RX FIFO entry (data byte or START/STOP marker)
+ * @param base_addr Base address of I2C Slave peripheral
+ * @param data Pointer to store entry data (START: {addr, rw})
+ * @param tag Pointer to store entry tag (I2C_SLAVE_TAG_*)
+ * @return true if an entry was popped, false if FIFO empty
+ */
+bool i2c_slave_read_fifo(uint32_t base_addr, uint8_t *data, uint8_t *tag);
+
+/**
+ * @brief Queue bytes to return on master reads
+ * @param base_addr Base address of I2C Slave peripheral
+ * @param data Bytes to queue
+ * @param len Number of bytes
+ * @return Number of bytes queued (stops when TX FIFO is full)
+ */
+int i2c_slave_write_tx_fifo(uint32_t base_addr, const uint8_t *data, int len);
+
+/**
+ * @brief Drain RX FIFO entries of one frame up to its STOP marker
+ * @param base_addr Base address of I2C Slave peripheral
+ * @param buf Buffer for data bytes
+ * @param max_len Buffer size
+ * @param len Pointer to store number of data bytes (accumulates across calls)
+ * @return true if the STOP marker was reached, false if FIFO ran empty first
+ */
+bool i2c_slave_read_frame(uint32_t base_addr, uint8_t *buf, int max_len, int *len);
+
+/**
+ * @brief Enable slave interrupts
+ * @param base_addr Base address of I2C Slave peripheral
+ * @param mask I2C_SLAVE_IRQ_* bits
+ * @param rx_threshold RX FIFO level that raises I2C_SLAVE_IRQ_RX_THRESH
+ */
+void i2c_slave_enable_irq(uint32_t base_addr, uint32_t mask, uint8_t rx_threshold);
+
+/**
+ * @brief Read and clear latched interrupt status
+ * @param base_addr Base address of I2C Slave peripheral
+ * @return I2C_SLAVE_IRQ_* bits that were set
+ */
+uint32_t i2c_slave_irq_ack(uint32_t base_addr);
+
 #endif // I2C_DRIVER_H
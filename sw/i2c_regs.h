@@ -38,12 +38,46 @@
 #define I2C_SLAVE_STAT_REG      0x04    // Status Register (R)
 #define I2C_SLAVE_ADDR_REG      0x08    // Own Address (W)
 #define I2C_SLAVE_TXDATA_REG    0x0C    // Transmit Data (W)
-#define I2C_SLAVE_RXDATA_REG    0x10    // Receive Data (R)
+#define I2C_SLAVE_RXDATA_REG    0x10    // Receive Data (R) - last byte
+#define I2C_SLAVE_RXFIFO_REG    0x14    // RX FIFO Pop (R)
+#define I2C_SLAVE_TXFIFO_REG    0x18    // TX FIFO Push (W)
+#define I2C_SLAVE_IER_REG       0x1C    // Interrupt Enable (R/W)
+#define I2C_SLAVE_ISR_REG       0x20    // Interrupt Status (R/W1C)
+
+// CTRL Register Bits
+#define I2C_SLAVE_CTRL_RX_FLUSH     (1 << 0)    // Flush RX FIFO
+#define I2C_SLAVE_CTRL_TX_FLUSH     (1 << 1)    // Flush TX FIFO
 
 // STAT Register Bits
 #define I2C_SLAVE_STAT_ADDR_MATCH   (1 << 0)    // Address matched
 #define I2C_SLAVE_STAT_ACK_SENT     (1 << 1)    // ACK sent
-#define I2C_SLAVE_STAT_DATA_VALID   (1 << 2)    // New data received
+#define I2C_SLAVE_STAT_DATA_VALID   (1 << 2)    // RX FIFO not empty
+#define I2C_SLAVE_STAT_RX_FULL      (1 << 3)    // RX FIFO full
+#define I2C_SLAVE_STAT_TX_EMPTY     (1 << 4)    // TX FIFO empty
+#define I2C_SLAVE_STAT_TX_FULL      (1 << 5)    // TX FIFO full
+#define I2C_SLAVE_STAT_RX_LEVEL(s)  (((s) >> 8) & 0xFF)
+#define I2C_SLAVE_STAT_TX_LEVEL(s)  (((s) >> 16) & 0xFF)
+
+// RXFIFO Entry Fields
+#define I2C_SLAVE_RXF_VALID         (1u << 31)  // Entry popped (FIFO was not empty)
+#define I2C_SLAVE_RXF_TAG(e)        (((e) >> 8) & 0x3)
+#define I2C_SLAVE_RXF_DATA(e)       ((e) & 0xFF)
+
+// RXFIFO Entry Tags
+#define I2C_SLAVE_TAG_DATA          0   // Data byte
+#define I2C_SLAVE_TAG_START         1   // START / Sr, data = {addr, rw}
+#define I2C_SLAVE_TAG_STOP          2   // STOP, end of frame
+
+// IER / ISR Bits
+#define I2C_SLAVE_IRQ_RX_THRESH     (1 << 0)    // RX level >= threshold
+#define I2C_SLAVE_IRQ_STOP          (1 << 1)    // STOP received
+#define I2C_SLAVE_IRQ_TX_UNDERRUN   (1 << 2)    // Read with TX FIFO empty
+#define I2C_SLAVE_IRQ_RX_OVERFLOW   (1 << 3)    // RX entry dropped
+#define I2C_SLAVE_IER_THRESH(n)     (((n) & 0xFF) << 8)
+
+// FIFO Depths (match axi_i2c_slave parameters)
+#define I2C_SLAVE_RX_FIFO_DEPTH     32
+#define I2C_SLAVE_TX_FIFO_DEPTH     16
 
 //==============================================================================
 // Register Access Macros
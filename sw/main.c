@@ -36,18 +36,35 @@
 static volatile uint8_t slave_rx_data = 0;
 static volatile int slave_data_received = 0;
 
+// Frame assembled by the interrupt handler (RX FIFO drained up to STOP)
+static uint8_t slave_frame[I2C_SLAVE_RX_FIFO_DEPTH];
+static int slave_frame_len = 0;
+
 //==============================================================================
 // Interrupt Handler (if using interrupts)
 //==============================================================================
+// Enable with:
+//   i2c_slave_enable_irq(I2C_SLAVE_BASEADDR,
+//                        I2C_SLAVE_IRQ_RX_THRESH | I2C_SLAVE_IRQ_STOP, 16);
+// The handler runs once per frame (STOP) or when the RX FIFO is half full,
+// instead of once per byte.
 void i2c_slave_interrupt_handler(void *callback_ref)
 {
-    uint8_t data;
+    uint32_t isr = i2c_slave_irq_ack(I2C_SLAVE_BASEADDR);
+
+    if (isr & I2C_SLAVE_IRQ_RX_OVERFLOW) {
+        xil_printf("Slave Interrupt: RX FIFO overflow\r\n");
+    }
 
-    // Read data from slave
-    if (i2c_slave_get_rx_data(I2C_SLAVE_BASEADDR, &data)) {
-        slave_rx_data = data;
-        slave_data_received = 1;
-        xil_printf("Slave Interrupt: Received 0x%02X\r\n", data);
+    // Drain everything received so far; print the frame at its STOP
+    while (i2c_slave_read_frame(I2C_SLAVE_BASEADDR, slave_frame,
+                                sizeof(slave_frame), &slave_frame_len)) {
+        if (slave_frame_len > 0) {
+            slave_rx_data = slave_frame[slave_frame_len - 1];
+            slave_data_received = 1;
+        }
+        xil_printf("Slave Interrupt: Frame of %d bytes\r\n", slave_frame_len);
+        slave_frame_len = 0;
     }
 }
 